@@ -0,0 +1,188 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <asiodnp3/DNP3Manager.h>
+#include <asiodnp3/ConsoleLogger.h>
+
+#include <opendnp3/LogLevels.h>
+
+#include <asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace openpal;
+using namespace asiopal;
+using namespace asiodnp3;
+using namespace opendnp3;
+
+/*
+* Loopback connection-storm benchmark for the master listener.
+*
+* Opens many TCP connections at once, as happens when cellular outstations reconnect after a carrier outage,
+* and reports how long the listener takes to work through them.
+*
+* usage: listener-storm-demo [clients] [acceptors] [max accept rate] [max pending first frame]
+*
+* Raise the open file limit (ulimit -n) above twice the number of clients before running.
+*/
+
+class StormCallbacks final : public IListenCallbacks
+{
+public:
+
+	std::atomic<uint32_t> admitted;
+
+	StormCallbacks() : admitted(0)
+	{}
+
+	virtual bool AcceptConnection(uint64_t sessionid, const std::string& ipaddress) override
+	{
+		++admitted;
+		return true;
+	}
+
+	virtual bool AcceptCertificate(uint64_t sessionid, const X509Info& info) override
+	{
+		return true;
+	}
+
+	virtual TimeDuration GetFirstFrameTimeout() override
+	{
+		return TimeDuration::Seconds(60);
+	}
+
+	virtual void OnFirstFrame(uint64_t sessionid, const LinkHeaderFields& header, ISessionAcceptor& acceptor) override {}
+
+	virtual void OnConnectionClose(uint64_t sessionid, const std::shared_ptr<IMasterSession>& session) override {}
+
+	virtual void OnCertificateError(uint64_t sessionid, const X509Info& info, int error) override {}
+};
+
+int main(int argc, char* argv[])
+{
+	const uint16_t PORT = 20000;
+	const auto TIMEOUT = std::chrono::seconds(60);
+
+	const uint32_t NUM_CLIENTS = (argc > 1) ? std::stoul(argv[1]) : 10000;
+
+	ListenConfig config;
+	config.numAcceptors = (argc > 2) ? static_cast<uint16_t>(std::stoul(argv[2])) : static_cast<uint16_t>(std::thread::hardware_concurrency());
+	config.maxAcceptRate = (argc > 3) ? std::stoul(argv[3]) : 0;
+	config.maxPendingFirstFrame = (argc > 4) ? std::stoul(argv[4]) : 0;
+
+	const auto NUM_THREAD = std::max<unsigned int>(std::thread::hardware_concurrency(), 2);
+
+	auto callbacks = std::make_shared<StormCallbacks>();
+
+	DNP3Manager manager(NUM_THREAD, ConsoleLogger::Create());
+
+	std::error_code ec;
+	auto listener = manager.CreateListener("storm", levels::NORMAL, IPEndpoint::Localhost(PORT), config, callbacks, ec);
+
+	if (ec)
+	{
+		std::cout << ec.message() << std::endl;
+		return ec.value();
+	}
+
+	// the clients run on their own io_service so that they don't compete with the listener for the manager's threads
+	asio::io_service clientService;
+	std::vector<std::unique_ptr<asio::ip::tcp::socket>> clients;
+	std::atomic<uint32_t> connected(0);
+	std::atomic<uint32_t> failed(0);
+	std::atomic<uint32_t> shed(0);
+
+	const asio::ip::tcp::endpoint destination(asio::ip::address::from_string("127.0.0.1"), PORT);
+
+	// a connection completes in the kernel before the listener accepts it, so each client
+	// also waits for a read that only finishes if the listener closes the connection
+	char discard[1];
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (uint32_t i = 0; i < NUM_CLIENTS; ++i)
+	{
+		clients.push_back(std::make_unique<asio::ip::tcp::socket>(clientService));
+		auto socket = clients.back().get();
+		socket->async_connect(destination, [&, socket](const std::error_code & err)
+		{
+			if (err)
+			{
+				++failed;
+				return;
+			}
+
+			++connected;
+			socket->async_read_some(asio::buffer(discard), [&](const std::error_code & readErr, std::size_t)
+			{
+				if (readErr)
+				{
+					++shed;
+				}
+			});
+		});
+	}
+
+	std::vector<std::thread> threads;
+	for (unsigned int i = 0; i < NUM_THREAD; ++i)
+	{
+		threads.emplace_back([&]()
+		{
+			clientService.run();
+		});
+	}
+
+	// wait until every connection has either been admitted or shed by the listener
+	while ((connected + failed) < NUM_CLIENTS || (callbacks->admitted + shed) < connected)
+	{
+		if ((std::chrono::steady_clock::now() - start) > TIMEOUT)
+		{
+			std::cout << "timed out" << std::endl;
+			break;
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+	clientService.stop();
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	std::cout << "clients: " << NUM_CLIENTS << " acceptors: " << config.numAcceptors << std::endl;
+	std::cout << "connected: " << connected << " failed: " << failed << std::endl;
+	std::cout << "admitted: " << callbacks->admitted << " shed: " << shed << std::endl;
+	std::cout << "elapsed: " << elapsed << " ms (" << ((elapsed > 0) ? (1000 * static_cast<uint64_t>(connected) / elapsed) : 0) << " connections/sec)" << std::endl;
+
+	listener->Shutdown();
+
+	return 0;
+}
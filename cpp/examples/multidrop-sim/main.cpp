@@ -0,0 +1,237 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <opendnp3/master/MultidropTaskLock.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <queue>
+#include <vector>
+
+using namespace std;
+using namespace openpal;
+using namespace opendnp3;
+
+/*
+* Simulated 9600 baud multidrop line shared by several masters.
+*
+* Each master polls its outstation periodically through the channel's task lock, exactly as the masters on
+* a serial channel do. Some outstations are offline and only ever time out. The simulation runs in virtual
+* time and reports how much of the bus carried useful traffic and how stale the healthy outstations' data got,
+* first with the FIFO lock and then with fair queuing.
+*
+* usage: multidrop-sim-demo [outstations] [offline] [hours]
+*/
+
+namespace
+{
+
+const int64_t BAUD = 9600;
+const int64_t REQUEST_BYTES = 20;
+const int64_t RESPONSE_BYTES = 250;
+const int64_t TURNAROUND_MS = 20;
+const int64_t POLL_PERIOD_MS = 2000;
+const int64_t RESPONSE_TIMEOUT_MS = 5000;
+
+int64_t TransmitMs(int64_t bytes)
+{
+	// 8N1 framing is 10 bits per byte
+	return (bytes * 10 * 1000) / BAUD;
+}
+
+class Simulation;
+
+class SimulatedMaster final : public IScheduleCallback
+{
+public:
+
+	SimulatedMaster(Simulation& sim, bool online) : sim(&sim), online(online)
+	{}
+
+	void Poll();
+
+	virtual void OnPendingTask() override;
+
+	Simulation* sim;
+	bool online;
+	int64_t lastSuccess = 0;
+	bool waiting = false;
+};
+
+class Simulation
+{
+	struct Event
+	{
+		int64_t time;
+		uint64_t order;
+		std::function<void()> action;
+
+		bool operator>(const Event& other) const
+		{
+			return (time == other.time) ? (order > other.order) : (time > other.time);
+		}
+	};
+
+public:
+
+	Simulation(const MultidropSchedulerConfig& config, int numOutstations, int numOffline) : lock(config)
+	{
+		lock.SetOnline();
+		for (int i = 0; i < numOutstations; ++i)
+		{
+			masters.push_back(std::unique_ptr<SimulatedMaster>(new SimulatedMaster(*this, i >= numOffline)));
+		}
+	}
+
+	void At(int64_t time, const std::function<void()>& action)
+	{
+		events.push(Event { time, ++order, action });
+	}
+
+	void Run(int64_t duration)
+	{
+		for (auto& master : masters)
+		{
+			At(0, [m = master.get()]() { m->Poll(); });
+		}
+
+		while (!events.empty() && events.top().time <= duration)
+		{
+			auto event = events.top();
+			events.pop();
+			now = event.time;
+			event.action();
+		}
+
+		this->duration = duration;
+	}
+
+	void Transact(SimulatedMaster& master)
+	{
+		const auto busTime = master.online ? (TransmitMs(REQUEST_BYTES) + TURNAROUND_MS + TransmitMs(RESPONSE_BYTES)) : RESPONSE_TIMEOUT_MS;
+
+		At(now + busTime, [this, &master, busTime]()
+		{
+			lock.OnRequestComplete(master, MonotonicTimestamp(now), TimeDuration::Milliseconds(busTime), master.online);
+
+			if (master.online)
+			{
+				usefulMs += busTime;
+				ages.push_back(now - master.lastSuccess);
+				master.lastSuccess = now;
+			}
+			else
+			{
+				wastedMs += busTime;
+			}
+
+			At(now + POLL_PERIOD_MS, [&master]()
+			{
+				master.Poll();
+			});
+
+			lock.Release(master);
+		});
+	}
+
+	void Report(const char* name)
+	{
+		std::sort(ages.begin(), ages.end());
+
+		auto percentile = [this](double p) -> double
+		{
+			if (ages.empty())
+			{
+				return 0;
+			}
+			auto index = static_cast<size_t>(p * (ages.size() - 1));
+			return ages[index] / 1000.0;
+		};
+
+		cout << std::left << std::setw(14) << name << std::fixed << std::setprecision(1)
+		     << " bus useful " << std::setw(5) << (100.0 * usefulMs / duration) << "%"
+		     << " wasted " << std::setw(5) << (100.0 * wastedMs / duration) << "%"
+		     << " | poll age p50 " << std::setprecision(2) << percentile(0.5) << "s"
+		     << " p90 " << percentile(0.9) << "s"
+		     << " p99 " << percentile(0.99) << "s"
+		     << " max " << percentile(1.0) << "s" << endl;
+	}
+
+	MultidropTaskLock lock;
+	int64_t now = 0;
+
+private:
+
+	std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+	std::vector<std::unique_ptr<SimulatedMaster>> masters;
+	uint64_t order = 0;
+	int64_t duration = 0;
+	int64_t usefulMs = 0;
+	int64_t wastedMs = 0;
+	std::vector<int64_t> ages;
+};
+
+void SimulatedMaster::Poll()
+{
+	if (sim->lock.Acquire(*this))
+	{
+		sim->Transact(*this);
+	}
+}
+
+void SimulatedMaster::OnPendingTask()
+{
+	// the lock was handed over while releasing, so start on the next event like the master's executor would
+	sim->At(sim->now, [this]()
+	{
+		sim->Transact(*this);
+	});
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+	const int numOutstations = (argc > 1) ? std::atoi(argv[1]) : 8;
+	const int numOffline = (argc > 2) ? std::atoi(argv[2]) : 1;
+	const int64_t hours = (argc > 3) ? std::atoi(argv[3]) : 1;
+
+	cout << numOutstations << " outstations (" << numOffline << " offline) at " << BAUD << " baud, polled every "
+	     << POLL_PERIOD_MS << " ms, " << hours << " simulated hour(s)" << endl;
+
+	MultidropSchedulerConfig fifo;
+
+	MultidropSchedulerConfig fair;
+	fair.fairQueuing = true;
+
+	Simulation a(fifo, numOutstations, numOffline);
+	a.Run(hours * 3600 * 1000);
+	a.Report("fifo");
+
+	Simulation b(fair, numOutstations, numOffline);
+	b.Run(hours * 3600 * 1000);
+	b.Report("fair queuing");
+
+	return 0;
+}
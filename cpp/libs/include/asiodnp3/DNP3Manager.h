@@ -29,14 +29,17 @@
 #include <asiodnp3/IChannel.h>
 #include <asiodnp3/IChannelListener.h>
 #include <asiodnp3/IListenCallbacks.h>
+#include <asiodnp3/ListenConfig.h>
 
 #include <asiopal/SerialTypes.h>
 #include <asiopal/ChannelRetry.h>
 #include <asiopal/TLSConfig.h>
 #include <asiopal/IListener.h>
 #include <asiopal/IPEndpoint.h>
+#include <asiopal/ExecutorMetrics.h>
 
 #include <memory>
+#include <vector>
 #include <system_error>
 
 namespace asiodnp3
@@ -77,6 +80,20 @@ public:
 	*/
 	void Shutdown();
 
+	/**
+	* Report handlers that block a thread pool thread for longer than a budget. Only active when the
+	* libraries are built with OPENDNP3_EXECUTOR_METRICS (cmake -DDNP3_EXECUTOR_METRICS=ON).
+	*
+	* @param budget Longest time a single handler may run, zero disables the watchdog
+	* @param callback Invoked on the thread that ran the handler. When empty, stalls are logged as warnings.
+	*/
+	void SetHandlerWatchdog(openpal::TimeDuration budget, asiopal::stall_callback_t callback = nullptr);
+
+	/**
+	* @return the busy time of each thread pool thread, only measured when built with OPENDNP3_EXECUTOR_METRICS
+	*/
+	std::vector<asiopal::ThreadStatistics> GetThreadStatistics() const;
+
 	/**
 	* Add a persistent TCP client channel. Automatically attempts to reconnect.
 	*
@@ -134,6 +151,28 @@ public:
 	    asiopal::SerialSettings settings,
 	    std::shared_ptr<IChannelListener> listener);
 
+	/**
+	* Add a UDP channel. Each link frame is carried in its own datagram.
+	*
+	* Frames are sent to the endpoint from which their destination link address was last heard,
+	* or to the remote endpoint if that address hasn't been heard from yet.
+	*
+	* @param id Alias that will be used for logging purposes with this channel
+	* @param levels Bitfield that describes the logging level for this channel and associated sessions
+	* @param retry Retry parameters for failed channels
+	* @param local Adapter and port the socket is bound to, i.e. 0.0.0.0:20000
+	* @param remote Default destination for frames (use an empty address to only answer endpoints that have been heard from)
+	* @param listener optional callback interface (can be nullptr) for info about the running channel
+	* @return shared_ptr to a channel interface
+	*/
+	std::shared_ptr<IChannel> AddUDPChannel(
+	    const std::string& id,
+	    uint32_t levels,
+	    const asiopal::ChannelRetry& retry,
+	    const asiopal::IPEndpoint& local,
+	    const asiopal::IPEndpoint& remote,
+	    std::shared_ptr<IChannelListener> listener);
+
 	/**
 	* Add a TLS client channel
 	*
@@ -198,6 +237,19 @@ public:
 	    std::error_code& ec
 	);
 
+	/**
+	* Create a TCP listener that will be used to accept incoming connections from many outstations,
+	* optionally with multiple SO_REUSEPORT acceptors and admission limits
+	*/
+	std::shared_ptr<asiopal::IListener> CreateListener(
+	    std::string loggerid,
+	    openpal::LogFilters loglevel,
+	    asiopal::IPEndpoint endpoint,
+	    const ListenConfig& config,
+	    std::shared_ptr<IListenCallbacks> callbacks,
+	    std::error_code& ec
+	);
+
 	/**
 	* Create a TLS listener that will be used to accept incoming connections
 	*/
@@ -26,14 +26,20 @@
 
 #include <opendnp3/master/ISOEHandler.h>
 #include <opendnp3/master/IMasterApplication.h>
+#include <opendnp3/master/MultidropSchedulerConfig.h>
+#include <opendnp3/master/BroadcastCallbackT.h>
+#include <opendnp3/master/CommandSet.h>
 
 #include <opendnp3/outstation/ICommandHandler.h>
+#include <opendnp3/outstation/IAsyncCommandHandler.h>
 #include <opendnp3/outstation/IOutstationApplication.h>
 
 #include <openpal/logging/LogFilters.h>
 #include <openpal/executor/IExecutor.h>
+#include <openpal/executor/UTCTimestamp.h>
 
 #include "asiopal/IResourceManager.h"
+#include "asiopal/ExecutorMetrics.h"
 
 #include "IMaster.h"
 #include "IOutstation.h"
@@ -59,6 +65,12 @@ public:
 	*/
 	virtual opendnp3::LinkStatistics GetStatistics() = 0;
 
+	/**
+	* Synchronously read the statistics of the handlers run on the channel's strand, which is shared by the
+	* channel and all of its stacks. Only collected when built with OPENDNP3_EXECUTOR_METRICS.
+	*/
+	virtual asiopal::ExecutorStatistics GetExecutorStatistics() = 0;
+
 	/**
 	*  @return The current logger settings for this channel
 	*/
@@ -69,6 +81,32 @@ public:
 	*/
 	virtual void SetLogFilters(const openpal::LogFilters& filters) = 0;
 
+	/**
+	*  @param config Controls how the masters on this channel share it, only relevant when there's more than one
+	*/
+	virtual void SetMultidropScheduling(const opendnp3::MultidropSchedulerConfig& config) = 0;
+
+	/**
+	* Send a request to every outstation on the channel using the broadcast address 0xFFFD.
+	* Outstations process the request without responding and set IIN1.0 in their next response.
+	*
+	* @param source Link address of the master sending the request
+	* @param function Function code of the request, e.g. WRITE or DIRECT_OPERATE_NR
+	* @param headers Object headers written to the request
+	* @param callback Invoked once every frame of the request has been written to the channel, or it failed
+	*/
+	virtual void Broadcast(uint16_t source, opendnp3::FunctionCode function, const std::vector<opendnp3::Header>& headers, const opendnp3::BroadcastCallbackT& callback) = 0;
+
+	/**
+	* Broadcast a time synchronization (WRITE of g50v1). The time is sent as given, the transmission delay isn't compensated.
+	*/
+	virtual void BroadcastTimeSync(uint16_t source, const openpal::UTCTimestamp& time, const opendnp3::BroadcastCallbackT& callback) = 0;
+
+	/**
+	* Broadcast controls using DIRECT_OPERATE_NR
+	*/
+	virtual void BroadcastDirectOperate(uint16_t source, opendnp3::CommandSet&& commands, const opendnp3::BroadcastCallbackT& callback) = 0;
+
 	/**
 	* Add a master to the channel
 	*
@@ -98,6 +136,20 @@ public:
 	        std::shared_ptr<opendnp3::IOutstationApplication> application,
 	        const OutstationStackConfig& config) = 0;
 
+	/**
+	* Add an outstation to the channel whose command handler completes commands asynchronously
+	*
+	* @param id An ID that gets used for logging
+	* @param commandHandler Callback object for handling command requests, may complete them from any thread
+	* @param application Callback object for user code
+	* @param config Configuration object that controls how the outstation behaves
+	* @return shared_ptr to the running outstation
+	*/
+	virtual std::shared_ptr<IOutstation>  AddOutstation( const std::string& id,
+	        std::shared_ptr<opendnp3::IAsyncCommandHandler> commandHandler,
+	        std::shared_ptr<opendnp3::IOutstationApplication> application,
+	        const OutstationStackConfig& config) = 0;
+
 };
 
 }
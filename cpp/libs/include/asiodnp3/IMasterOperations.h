@@ -29,6 +29,8 @@
 #include <opendnp3/master/TaskConfig.h>
 #include <opendnp3/master/ICommandProcessor.h>
 #include <opendnp3/master/RestartOperationResult.h>
+#include <opendnp3/master/MeasurementCache.h>
+#include <opendnp3/master/MasterLatencies.h>
 
 #include <opendnp3/gen/FunctionCode.h>
 #include <opendnp3/gen/RestartType.h>
@@ -58,6 +60,17 @@ public:
 	*/
 	virtual void SetLogFilters(const openpal::LogFilters& filters) = 0;
 
+	/**
+	* @return the last-value cache enabled via MasterParams::cacheSizes, or nullptr if it is disabled.
+	* The cache may be read from any thread for as long as the pointer is held.
+	*/
+	virtual std::shared_ptr<const opendnp3::MeasurementCache> GetMeasurementCache() = 0;
+
+	/**
+	* @return a snapshot of the latency histograms enabled via MasterParams::latencyHistograms, empty if they are disabled
+	*/
+	virtual opendnp3::MasterLatencies GetLatencies() = 0;
+
 	/**
 	* Add a recurring user-defined scan from a vector of headers
 	* @ return A proxy class used to manipulate the scan
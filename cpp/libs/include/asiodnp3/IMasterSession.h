@@ -22,6 +22,7 @@
 #define ASIODNP3_IMASTERSESSION_H
 
 #include "asiodnp3/IMasterOperations.h"
+#include "asiodnp3/MemoryUsage.h"
 
 namespace asiodnp3
 {
@@ -37,6 +38,9 @@ public:
 
 	virtual opendnp3::StackStatistics GetStackStatistics() = 0;
 
+	/// Memory currently held by the session. Share MasterParams::bufferPool between sessions to keep idle sessions small.
+	virtual MemoryUsage GetMemoryUsage() = 0;
+
 	virtual void BeginShutdown() = 0;
 
 };
@@ -24,6 +24,8 @@
 #include "asiodnp3/IStack.h"
 #include "asiodnp3/Updates.h"
 
+#include <opendnp3/outstation/OutstationLatencies.h>
+
 #include <openpal/logging/LogFilters.h>
 
 namespace asiodnp3
@@ -51,11 +53,31 @@ public:
 	*/
 	virtual void SetRestartIIN() = 0;
 
+	/**
+	* @return a snapshot of the latency histograms enabled via OutstationParams::latencyHistograms
+	*/
+	virtual opendnp3::OutstationLatencies GetLatencies() = 0;
+
 	/**
 	* Apply a set of measurement updates to the outstation
 	*/
 	virtual void Apply(const Updates& updates) = 0;
 
+	/**
+	* Enqueue a single measurement update into the lock-free ingestion ring. Safe to call from
+	* any number of threads, updates are applied in bulk by the outstation.
+	*
+	* @return false if the ring is disabled, or full and the overflow policy is IngestionOverflowPolicy::Drop
+	*/
+	virtual bool Enqueue(const opendnp3::Binary& meas, uint16_t index, opendnp3::EventMode mode = opendnp3::EventMode::Detect) = 0;
+	virtual bool Enqueue(const opendnp3::DoubleBitBinary& meas, uint16_t index, opendnp3::EventMode mode = opendnp3::EventMode::Detect) = 0;
+	virtual bool Enqueue(const opendnp3::Analog& meas, uint16_t index, opendnp3::EventMode mode = opendnp3::EventMode::Detect) = 0;
+	virtual bool Enqueue(const opendnp3::Counter& meas, uint16_t index, opendnp3::EventMode mode = opendnp3::EventMode::Detect) = 0;
+	virtual bool Enqueue(const opendnp3::FrozenCounter& meas, uint16_t index, opendnp3::EventMode mode = opendnp3::EventMode::Detect) = 0;
+	virtual bool Enqueue(const opendnp3::BinaryOutputStatus& meas, uint16_t index, opendnp3::EventMode mode = opendnp3::EventMode::Detect) = 0;
+	virtual bool Enqueue(const opendnp3::AnalogOutputStatus& meas, uint16_t index, opendnp3::EventMode mode = opendnp3::EventMode::Detect) = 0;
+	virtual bool Enqueue(const opendnp3::TimeAndInterval& meas, uint16_t index) = 0;
+
 };
 
 }
@@ -0,0 +1,59 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_INGESTIONCONFIG_H
+#define ASIODNP3_INGESTIONCONFIG_H
+
+#include <openpal/executor/TimeDuration.h>
+
+#include <cstdint>
+
+namespace asiodnp3
+{
+
+/**
+* What IOutstation::Enqueue does when the ingestion ring is full
+*/
+enum class IngestionOverflowPolicy : uint8_t
+{
+	/// Drop the update and return false
+	Drop,
+	/// Yield until the outstation drains the ring. Never use this from the thread pool running the outstation.
+	Wait
+};
+
+/**
+* Configuration of the optional lock-free ring used to ingest measurements from producer threads
+*/
+struct IngestionConfig
+{
+	/// Number of update records in the ring, rounded up to a power of 2 and limited to 2^30. 0 disables the ring.
+	uint32_t capacity = 0;
+
+	/// How long the outstation waits after an update is enqueued before draining the ring, so that bursts are applied together
+	openpal::TimeDuration coalesceDelay = openpal::TimeDuration::Zero();
+
+	/// Behavior when the ring is full
+	IngestionOverflowPolicy overflowPolicy = IngestionOverflowPolicy::Drop;
+};
+
+}
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_LISTENCONFIG_H
+#define ASIODNP3_LISTENCONFIG_H
+
+#include <cstdint>
+
+namespace asiodnp3
+{
+
+/**
+* Configuration of a master listener that accepts connections from many outstations, e.g. over GPRS/cellular
+*/
+struct ListenConfig
+{
+	/// Number of acceptors bound to the endpoint with SO_REUSEPORT, each on its own strand.
+	/// The kernel distributes incoming connections between them. 1 uses a single acceptor without SO_REUSEPORT.
+	uint16_t numAcceptors = 1;
+
+	/// Maximum number of connections admitted per second across all acceptors, 0 for unlimited.
+	/// Connections over the rate are closed immediately without invoking IListenCallbacks.
+	uint32_t maxAcceptRate = 0;
+
+	/// Maximum number of admitted connections per acceptor that have not yet received their first frame, 0 for unlimited.
+	/// Connections over the limit are closed immediately without invoking IListenCallbacks.
+	uint32_t maxPendingFirstFrame = 0;
+};
+
+}
+
+#endif
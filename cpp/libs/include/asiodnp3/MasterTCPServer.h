@@ -22,6 +22,7 @@
 #define ASIOPAL_MASTERTCPSERVER_H
 
 #include <openpal/logging/Logger.h>
+#include <openpal/executor/TokenBucket.h>
 
 #include <asiopal/TCPServer.h>
 #include <asiopal/ResourceManager.h>
@@ -29,12 +30,18 @@
 #include <asiopal/IPEndpoint.h>
 
 #include "asiodnp3/IListenCallbacks.h"
+#include "asiodnp3/ListenConfig.h"
+
+#include <atomic>
 
 namespace asiodnp3
 {
 /**
 * Binds and listens on an IPv4 TCP port
 *
+* When ListenConfig::numAcceptors > 1, each instance is one of several acceptors (shards) sharing the port via SO_REUSEPORT.
+* Every shard applies its share of the admission rate and its own limit on sessions waiting for a first frame.
+*
 * Meant to be used exclusively as a shared_ptr
 */
 class MasterTCPServer final : public asiopal::TCPServer
@@ -69,12 +76,54 @@ public:
 		return server;
 	}
 
+	MasterTCPServer(
+	    const openpal::Logger& logger,
+	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const asiopal::IPEndpoint& endpoint,
+	    const std::shared_ptr<IListenCallbacks>& callbacks,
+	    const std::shared_ptr<asiopal::ResourceManager>& manager,
+	    const ListenConfig& config,
+	    uint16_t shard,
+	    std::error_code& ec
+	);
+
+	static std::shared_ptr<MasterTCPServer> Create(
+	    const openpal::Logger& logger,
+	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const asiopal::IPEndpoint& endpoint,
+	    const std::shared_ptr<IListenCallbacks>& callbacks,
+	    const std::shared_ptr<asiopal::ResourceManager>& manager,
+	    const ListenConfig& config,
+	    uint16_t shard,
+	    std::error_code& ec)
+	{
+		auto server = std::make_shared<MasterTCPServer>(logger, executor, endpoint, callbacks, manager, config, shard, ec);
+
+		if (!ec)
+		{
+			server->StartAccept();
+		}
+
+		return server;
+	}
+
 
 private:
 
 	std::shared_ptr<IListenCallbacks> callbacks;
 	std::shared_ptr<asiopal::ResourceManager> manager;
 
+	const uint16_t numShards;
+	const uint16_t shard;
+	const uint32_t maxPendingFirstFrame;
+
+	openpal::TokenBucket admission;
+	const std::shared_ptr<std::atomic<uint32_t>> pendingFirstFrame;
+
+	bool Admit(const std::shared_ptr<asiopal::Executor>& executor);
+
+	static uint32_t GetShardRate(const ListenConfig& config);
+
 	static std::string SessionIdToString(uint64_t sessionid);
 
 	// implement the virutal methods from TCPServer
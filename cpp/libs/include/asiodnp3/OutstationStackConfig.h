@@ -26,6 +26,7 @@
 #include "opendnp3/outstation/DatabaseSizes.h"
 #include "asiodnp3/DatabaseConfig.h"
 #include "opendnp3/link/LinkConfig.h"
+#include "asiodnp3/IngestionConfig.h"
 
 namespace asiodnp3
 {
@@ -55,6 +56,9 @@ struct OutstationStackConfig
 	/// Link layer config
 	opendnp3::LinkConfig link;
 
+	/// Optional ring used by IOutstation::Enqueue
+	IngestionConfig ingestion;
+
 };
 
 }
@@ -26,6 +26,7 @@
 
 #include "asiopal/IO.h"
 #include "asiopal/SteadyClock.h"
+#include "asiopal/InstrumentedStrand.h"
 
 #include <future>
 
@@ -47,16 +48,18 @@ class Executor final :
 
 public:
 
-	Executor(const std::shared_ptr<IO>& io);
+	/// @param id identifies the executor in handler stall reports
+	Executor(const std::shared_ptr<IO>& io, const std::string& id = "");
 
-	static std::shared_ptr<Executor> Create(const std::shared_ptr<IO>& io)
+	static std::shared_ptr<Executor> Create(const std::shared_ptr<IO>& io, const std::string& id = "")
 	{
-		return std::make_shared<Executor>(io);
+		return std::make_shared<Executor>(io, id);
 	}
 
 	/// ---- Implement IExecutor -----
 
 	virtual openpal::MonotonicTimestamp GetTime() override;
+	virtual int64_t GetMicroseconds() override;
 	virtual openpal::ITimer* Start(const openpal::TimeDuration&, const openpal::action_t& runnable)  override;
 	virtual openpal::ITimer* Start(const openpal::MonotonicTimestamp&, const openpal::action_t& runnable)  override;
 	virtual void Post(const openpal::action_t& runnable) override;
@@ -68,20 +71,29 @@ public:
 
 	void BlockUntilAndFlush(const std::function<void()>& action);
 
+	/// Handler statistics of the strand, all zero unless built with OPENDNP3_EXECUTOR_METRICS
+	ExecutorStatistics GetStatistics();
+
 private:
 
 	// we hold a shared_ptr to the pool so that it cannot dissapear while the strand is still executing
 	std::shared_ptr<IO> io;
 
+#ifdef OPENDNP3_EXECUTOR_METRICS
+	const std::shared_ptr<ExecutorMetrics> metrics;
+#endif
+
 public:
 
 	// Create a new Executor that shares the underling std::shared_ptr<IO>
 	std::shared_ptr<Executor> Fork() const
 	{
-		return Create(this->io);
+		return Create(this->io, this->id);
 	}
 
-	asio::strand strand;
+	const std::string id;
+
+	strand_t strand;
 
 private:
 
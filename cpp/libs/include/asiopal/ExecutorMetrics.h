@@ -0,0 +1,199 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_EXECUTORMETRICS_H
+#define ASIOPAL_EXECUTORMETRICS_H
+
+#include <openpal/util/Histogram.h>
+
+#include "asiopal/ExecutorConfig.h"
+#include "asiopal/SteadyClock.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace asiopal
+{
+
+/**
+* Statistics of the handlers run on the strand of an Executor. Only collected when the libraries
+* are built with OPENDNP3_EXECUTOR_METRICS (cmake -DDNP3_EXECUTOR_METRICS=ON), otherwise always zero.
+*/
+struct ExecutorStatistics
+{
+	/// handlers posted to the strand that have not started yet
+	uint32_t numPending = 0;
+
+	/// handlers run on the strand, including timers and completions of asynchronous operations
+	uint64_t numHandlers = 0;
+
+	/// handlers that ran longer than the watchdog budget
+	uint64_t numOverBudget = 0;
+
+	/// time from posting a handler to the handler starting in microseconds
+	openpal::HistogramSummary queueDelay;
+
+	/// time spent running handlers in microseconds
+	openpal::HistogramSummary handlerDuration;
+};
+
+/**
+* Time a thread pool thread has spent running executor handlers
+*/
+struct ThreadStatistics
+{
+	uint64_t busyMicros = 0;
+	uint64_t elapsedMicros = 0;
+
+	double BusyRatio() const
+	{
+		return (elapsedMicros == 0) ? 0.0 : static_cast<double>(busyMicros) / elapsedMicros;
+	}
+};
+
+/**
+* A handler that ran longer than the watchdog budget
+*/
+struct HandlerStall
+{
+	/// id of the executor that ran the handler, i.e. the channel or listener id
+	std::string executorId;
+
+	/// id of the last stack that processed a frame during the handler, empty if none did
+	std::string stackId;
+
+	std::chrono::microseconds duration;
+};
+
+typedef std::function<void(const HandlerStall&)> stall_callback_t;
+
+/**
+* Reports handlers that run longer than a budget. One watchdog is shared by every Executor on an IO.
+*
+* The budget is checked when a handler returns. A handler that never returns only shows up in the
+* busy ratio of its thread.
+*/
+class HandlerWatchdog
+{
+
+public:
+
+	/// A budget of zero disables the watchdog
+	void Configure(std::chrono::microseconds budget, const stall_callback_t& callback);
+
+	int64_t BudgetMicros() const
+	{
+		return budgetMicros.load(std::memory_order_relaxed);
+	}
+
+	void Report(const HandlerStall& stall);
+
+private:
+
+	std::atomic<int64_t> budgetMicros{ 0 };
+	std::mutex mutex;
+	stall_callback_t callback;
+};
+
+/**
+* Busy time of a single thread pool thread. Only the owning thread writes to it.
+*/
+class ThreadMetrics
+{
+
+public:
+
+	ThreadMetrics();
+
+	/// Handlers run by the calling thread from now on add to the busy time of 'metrics'
+	static void Attach(ThreadMetrics* metrics);
+
+	ThreadStatistics GetStatistics() const;
+
+private:
+
+	friend class ExecutorMetrics;
+
+	const int64_t startMicros;
+	std::atomic<uint64_t> busyMicros;
+};
+
+#ifdef OPENDNP3_EXECUTOR_METRICS
+
+/**
+* Handler counts and timing of one Executor. Begin/End are only called on the strand.
+*/
+class ExecutorMetrics
+{
+
+public:
+
+	ExecutorMetrics(const std::string& id, HandlerWatchdog& watchdog);
+
+	static int64_t NowMicros()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(steady_clock_t::now().time_since_epoch()).count();
+	}
+
+	void OnPost()
+	{
+		pending.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/// @param postedMicros time the handler was posted, negative for completions that were not posted
+	int64_t Begin(int64_t postedMicros);
+
+	void End(int64_t startMicros);
+
+	ExecutorStatistics GetStatistics() const;
+
+	/// Record the stack that is processing a frame for the current handler
+	static void LabelStack(const std::string& id);
+
+	const std::string id;
+
+private:
+
+	HandlerWatchdog* watchdog;
+
+	std::atomic<uint32_t> pending;
+	uint64_t numOverBudget = 0;
+	openpal::Histogram queueDelay;
+	openpal::Histogram handlerDuration;
+};
+
+#else
+
+class ExecutorMetrics
+{
+
+public:
+
+	static void LabelStack(const std::string& id) {}
+};
+
+#endif
+
+}
+
+#endif
@@ -23,6 +23,8 @@
 
 #include <asio.hpp>
 
+#include "asiopal/ExecutorMetrics.h"
+
 namespace asiopal
 {
 
@@ -38,6 +40,9 @@ public:
 
 	asio::io_service service;
 
+	/// shared by every Executor on the service
+	HandlerWatchdog watchdog;
+
 };
 
 }
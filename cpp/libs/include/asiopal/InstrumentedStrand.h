@@ -0,0 +1,114 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_INSTRUMENTEDSTRAND_H
+#define ASIOPAL_INSTRUMENTEDSTRAND_H
+
+#include "asiopal/ExecutorMetrics.h"
+
+#include <asio.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace asiopal
+{
+
+#ifdef OPENDNP3_EXECUTOR_METRICS
+
+/**
+* Drop-in replacement for asio::strand that times every handler it runs
+*/
+class InstrumentedStrand
+{
+	template <class Handler>
+	class TimedHandler
+	{
+
+	public:
+
+		TimedHandler(Handler handler, const std::shared_ptr<ExecutorMetrics>& metrics, int64_t postedMicros) :
+			handler(std::move(handler)),
+			metrics(metrics),
+			postedMicros(postedMicros)
+		{}
+
+		template <class... Args>
+		void operator()(Args&& ... args)
+		{
+			const auto start = metrics->Begin(postedMicros);
+			handler(std::forward<Args>(args)...);
+			metrics->End(start);
+		}
+
+	private:
+
+		Handler handler;
+		std::shared_ptr<ExecutorMetrics> metrics;
+		int64_t postedMicros;
+	};
+
+public:
+
+	InstrumentedStrand(asio::io_service& service, const std::shared_ptr<ExecutorMetrics>& metrics) :
+		strand(service),
+		metrics(metrics)
+	{}
+
+	template <class Handler>
+	void post(Handler handler)
+	{
+		metrics->OnPost();
+		strand.post(TimedHandler<Handler>(std::move(handler), metrics, ExecutorMetrics::NowMicros()));
+	}
+
+	template <class Handler>
+	auto wrap(Handler handler) -> decltype(std::declval<asio::strand&>().wrap(std::declval<TimedHandler<Handler>>()))
+	{
+		return strand.wrap(TimedHandler<Handler>(std::move(handler), metrics, -1));
+	}
+
+	bool running_in_this_thread() const
+	{
+		return strand.running_in_this_thread();
+	}
+
+	asio::io_service& get_io_service()
+	{
+		return strand.get_io_service();
+	}
+
+private:
+
+	asio::strand strand;
+	const std::shared_ptr<ExecutorMetrics> metrics;
+};
+
+typedef InstrumentedStrand strand_t;
+
+#else
+
+typedef asio::strand strand_t;
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,164 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_MPSCRING_H
+#define ASIOPAL_MPSCRING_H
+
+#include <openpal/util/Uncopyable.h>
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+namespace asiopal
+{
+
+/**
+* A bounded, lock-free queue of fixed-size records for many producers and a single consumer.
+*
+* Each cell carries a sequence number that tells producers when the cell is free and the
+* consumer when it has been published, so producers only contend on the tail index.
+*
+* The capacity is rounded up to a power of 2 and limited to MAX_CAPACITY.
+*/
+template <class T>
+class MPSCRing : private openpal::Uncopyable
+{
+	struct Cell
+	{
+		std::atomic<uint32_t> sequence;
+		T value;
+	};
+
+public:
+
+	/// Largest capacity for which the signed distance between sequence numbers is unambiguous
+	static const uint32_t MAX_CAPACITY = 1u << 30;
+
+	explicit MPSCRing(uint32_t capacity) :
+		mask(GetCapacity(capacity) - 1),
+		cells(new Cell[mask + 1]),
+		tail(0),
+		head(0)
+	{
+		for (uint32_t i = 0; i <= mask; ++i)
+		{
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	uint32_t Capacity() const
+	{
+		return mask + 1;
+	}
+
+	/// The capacity of a ring constructed with the requested capacity
+	static uint32_t GetCapacity(uint32_t requested)
+	{
+		if (requested >= MAX_CAPACITY)
+		{
+			return MAX_CAPACITY;
+		}
+
+		uint32_t ret = 2;
+		while (ret < requested)
+		{
+			ret <<= 1;
+		}
+		return ret;
+	}
+
+	/// Called from any thread. Returns false if the ring is full.
+	bool TryPush(const T& value)
+	{
+		auto pos = tail.load(std::memory_order_relaxed);
+
+		for (;;)
+		{
+			auto& cell = cells[pos & mask];
+			auto diff = static_cast<int32_t>(cell.sequence.load(std::memory_order_acquire) - pos);
+
+			if (diff == 0)
+			{
+				if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					cell.value = value;
+					cell.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = tail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// Only called from the consumer. Returns false if the ring is empty.
+	bool TryPop(T& value)
+	{
+		auto& cell = cells[head & mask];
+		auto diff = static_cast<int32_t>(cell.sequence.load(std::memory_order_acquire) - (head + 1));
+
+		if (diff < 0)
+		{
+			return false;
+		}
+
+		value = cell.value;
+		cell.sequence.store(head + mask + 1, std::memory_order_release);
+		++head;
+		return true;
+	}
+
+	/// Only called from the consumer. Pops up to max records, invoking fun for each.
+	template <class Fun>
+	uint32_t Drain(const Fun& fun, uint32_t max = UINT32_MAX)
+	{
+		uint32_t count = 0;
+		T value;
+		while (count < max && this->TryPop(value))
+		{
+			fun(value);
+			++count;
+		}
+		return count;
+	}
+
+private:
+
+	const uint32_t mask;
+	const std::unique_ptr<Cell[]> cells;
+
+	// producers contend on the tail, the consumer owns the head
+	std::atomic<uint32_t> tail;
+	uint32_t head;
+};
+
+template <class T>
+const uint32_t MPSCRing<T>::MAX_CAPACITY;
+
+}
+
+#endif
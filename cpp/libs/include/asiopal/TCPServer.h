@@ -53,6 +53,18 @@ public:
 	    std::error_code& ec
 	);
 
+	/**
+	* @param reusePort bind with SO_REUSEPORT so that multiple servers can share the endpoint.
+	* Fails with operation_not_supported on platforms without SO_REUSEPORT.
+	*/
+	TCPServer(
+	    const openpal::Logger& logger,
+	    const std::shared_ptr<Executor>& executor,
+	    const IPEndpoint& endpoint,
+	    bool reusePort,
+	    std::error_code& ec
+	);
+
 	/// Implement IListener
 	void Shutdown() override final;
 
@@ -72,7 +84,7 @@ protected:
 
 private:
 
-	void Configure(const std::string& adapter, std::error_code& ec);
+	void Configure(const std::string& adapter, bool reusePort, std::error_code& ec);
 
 	asio::ip::tcp::endpoint endpoint;
 	asio::ip::tcp::acceptor acceptor;
@@ -23,6 +23,7 @@
 #define ASIOPAL_TLS_CONFIG_H
 
 #include <string>
+#include <cstdint>
 
 namespace asiopal
 {
@@ -43,6 +44,8 @@ struct TLSConfig
 	* @param allowTLSv11 Allow TLS version 1.1 (default false)
 	* @param allowTLSv12 Allow TLS version 1.2 (default true)
 	* @param cipherList The openssl cipher-list, defaults to "" which does not modify the default cipher list
+	* @param sessionLifetimeSeconds How long negotiated sessions may be resumed, defaults to 0 which disables resumption
+	* @param useKernelTLS Hand the negotiated keys to the kernel (Linux only, default false)
 	*
 	* localCertFilePath and privateKeyFilePath can optionally be the same file, i.e. a PEM that contains both pieces of data.
 	*
@@ -55,7 +58,9 @@ struct TLSConfig
 	    bool allowTLSv10 = false,
 	    bool allowTLSv11 = false,
 	    bool allowTLSv12 = true,
-	    const std::string& cipherList = ""
+	    const std::string& cipherList = "",
+	    uint32_t sessionLifetimeSeconds = 0,
+	    bool useKernelTLS = false
 	) :
 		peerCertFilePath(peerCertFilePath),
 		localCertFilePath(localCertFilePath),
@@ -64,7 +69,9 @@ struct TLSConfig
 		allowTLSv10(allowTLSv10),
 		allowTLSv11(allowTLSv11),
 		allowTLSv12(allowTLSv12),
-		cipherList(cipherList)
+		cipherList(cipherList),
+		sessionLifetimeSeconds(sessionLifetimeSeconds),
+		useKernelTLS(useKernelTLS)
 	{}
 
 	/// Certificate file used to verify the peer or server. Can be CA file or a self-signed cert provided by other party.
@@ -91,6 +98,25 @@ struct TLSConfig
 	/// openssl format cipher list
 	std::string cipherList;
 
+	/**
+	* Lifetime of resumable sessions in seconds (defaults to 0 - resumption disabled)
+	*
+	* Sessions are kept in a cache shared by every client and server in the process,
+	* so reconnects resume with session tickets or session IDs instead of performing a
+	* full handshake, even after the channel has been torn down and re-created. A session
+	* is only resumed by a configuration with the same certificate and key files, verification
+	* depth, protocol versions and cipher list as the one that negotiated it.
+	*/
+	uint32_t sessionLifetimeSeconds;
+
+	/**
+	* Offload record encryption to the kernel after the handshake (defaults to false)
+	*
+	* Requires Linux and an OpenSSL build with kTLS support, otherwise records are
+	* processed in user space.
+	*/
+	bool useKernelTLS;
+
 };
 
 }
@@ -29,6 +29,7 @@
 #include <functional>
 #include <thread>
 #include <memory>
+#include <vector>
 
 namespace asiopal
 {
@@ -52,13 +53,16 @@ public:
 
 	~ThreadPool();
 
-	inline std::shared_ptr<Executor> CreateExecutor() const
+	inline std::shared_ptr<Executor> CreateExecutor(const std::string& id = "") const
 	{
-		return Executor::Create(io);
+		return Executor::Create(io, id);
 	}
 
 	void Shutdown();
 
+	/// Busy time of each thread, only measured when built with OPENDNP3_EXECUTOR_METRICS
+	std::vector<ThreadStatistics> GetThreadStatistics() const;
+
 private:
 
 	openpal::Logger logger;
@@ -72,6 +76,7 @@ private:
 	void Run(int threadnum);
 
 	asio::basic_waitable_timer< asiopal::steady_clock_t > infiniteTimer;
+	std::vector<std::unique_ptr<ThreadMetrics>> metrics;
 	std::vector<std::unique_ptr<std::thread>> threads;
 };
 
@@ -0,0 +1,114 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_UDPCHANNEL_H
+#define ASIOPAL_UDPCHANNEL_H
+
+#include "IAsyncChannel.h"
+
+#include <openpal/logging/Logger.h>
+
+#include <map>
+#include <vector>
+
+namespace asiopal
+{
+
+/**
+* Datagram channel that carries one or more link frames per UDP datagram.
+*
+* The source endpoint of every received datagram is recorded against the link-layer source
+* address it carries, and outgoing frames are sent to the endpoint recorded for their destination
+* address. Frames for a destination that has never been heard from go to the default remote endpoint.
+*
+* On Linux, reads drain up to BATCH_SIZE datagrams with a single recvmmsg call and writes issued
+* back to back are flushed with a single sendmmsg call.
+*/
+class UDPChannel final : public IAsyncChannel
+{
+
+public:
+
+	/// maximum number of datagrams moved per system call
+	static const size_t BATCH_SIZE = 32;
+
+	/// largest datagram that can be received
+	static const size_t MAX_DATAGRAM_SIZE = 4096;
+
+	static std::shared_ptr<IAsyncChannel> Create(
+	    const openpal::Logger& logger,
+	    std::shared_ptr<Executor> executor,
+	    asio::ip::udp::socket socket,
+	    const asio::ip::udp::endpoint& remote)
+	{
+		return std::make_shared<UDPChannel>(logger, executor, std::move(socket), remote);
+	}
+
+	UDPChannel(const openpal::Logger& logger, std::shared_ptr<Executor> executor, asio::ip::udp::socket socket, const asio::ip::udp::endpoint& remote);
+
+protected:
+
+	virtual void BeginReadImpl(openpal::WSlice buffer) override;
+	virtual void BeginWriteImpl(const openpal::RSlice& buffer)  override;
+	virtual void ShutdownImpl()  override;
+
+private:
+
+	struct Datagram
+	{
+		asio::ip::udp::endpoint endpoint;
+		std::vector<uint8_t> data;
+		size_t size = 0;
+	};
+
+	// complete a read from the datagrams already received, returns false if there are none
+	bool CompleteRead(openpal::WSlice& dest);
+
+	// receive as many datagrams as are available without blocking
+	std::error_code ReceiveBatch();
+
+	// learn the endpoint of the link address that sent a datagram
+	void Learn(const Datagram& datagram);
+
+	// queue a copy of a frame for transmission to an endpoint
+	void Enqueue(const asio::ip::udp::endpoint& endpoint, const openpal::RSlice& frame);
+
+	// transmit all queued datagrams
+	void Flush();
+
+	openpal::Logger logger;
+	asio::ip::udp::socket socket;
+	const asio::ip::udp::endpoint remote;
+
+	// link source address -> endpoint it was last heard from
+	std::map<uint16_t, asio::ip::udp::endpoint> routes;
+
+	std::vector<Datagram> rx;
+	size_t rxCount = 0;
+	size_t rxIndex = 0;
+	size_t rxOffset = 0;
+
+	std::vector<Datagram> tx;
+	size_t txCount = 0;
+};
+
+}
+
+#endif
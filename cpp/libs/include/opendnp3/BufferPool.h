@@ -0,0 +1,81 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_BUFFERPOOL_H
+#define OPENDNP3_BUFFERPOOL_H
+
+#include <openpal/util/Uncopyable.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* Thread-safe pool of fragment buffers shared by many mostly idle stacks, e.g. the sessions of a GPRS master listener.
+*
+* Stacks configured with a pool only hold their large rx/tx buffers while a fragment is being received or transmitted,
+* and return them to the pool when idle. Released buffers are kept for reuse up to a limit on the cached bytes.
+*/
+class BufferPool : private openpal::Uncopyable
+{
+	friend class PooledBuffer;
+
+public:
+
+	struct Statistics
+	{
+		/// Bytes currently attached to stacks
+		uint64_t bytesInUse = 0;
+		/// Bytes of released buffers cached for reuse
+		uint64_t bytesCached = 0;
+		/// Number of buffers allocated from the heap because none were cached
+		uint64_t numAllocations = 0;
+	};
+
+	explicit BufferPool(uint64_t maxCachedBytes);
+
+	static std::shared_ptr<BufferPool> Create(uint64_t maxCachedBytes)
+	{
+		return std::make_shared<BufferPool>(maxCachedBytes);
+	}
+
+	Statistics GetStatistics() const;
+
+private:
+
+	std::unique_ptr<uint8_t[]> Acquire(uint32_t size);
+
+	void Release(std::unique_ptr<uint8_t[]> buffer, uint32_t size);
+
+	const uint64_t maxCachedBytes;
+
+	mutable std::mutex mutex;
+	Statistics statistics;
+	std::map<uint32_t, std::vector<std::unique_ptr<uint8_t[]>>> cached;
+};
+
+}
+
+#endif
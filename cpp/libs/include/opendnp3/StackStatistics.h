@@ -21,6 +21,8 @@
 #ifndef OPENDNP3_STACKSTATISTICS_H
 #define OPENDNP3_STACKSTATISTICS_H
 
+#include <openpal/util/Histogram.h>
+
 #include <cstdint>
 
 namespace opendnp3
@@ -44,6 +46,15 @@ struct StackStatistics
 
 		/// frames received for an unknown source
 		uint32_t numUnknownSource = 0;
+
+		/// smoothed round trip time of confirmed frames in milliseconds
+		uint32_t smoothedRttMs = 0;
+
+		/// mean deviation of the round trip time in milliseconds
+		uint32_t rttVarianceMs = 0;
+
+		/// response timeout currently applied to confirmed frames in milliseconds
+		uint32_t responseTimeoutMs = 0;
 	};
 
 	struct Transport
@@ -79,6 +90,69 @@ struct StackStatistics
 		Tx tx;
 	};
 
+	struct Outstation
+	{
+		/// Number of unsolicited fragments transmitted that contained events
+		uint32_t numUnsolicitedFragments = 0;
+
+		/// Total number of events carried by unsolicited fragments
+		uint32_t numUnsolicitedEvents = 0;
+
+		/// Number of updates applied from the ingestion ring
+		uint32_t numIngestedUpdates = 0;
+
+		/// Number of times the ingestion ring was drained
+		uint32_t numIngestionDrains = 0;
+
+		/// Number of enqueue attempts that found the ingestion ring full
+		uint32_t numIngestionOverflows = 0;
+
+		/// Number of requests received on a broadcast address
+		uint32_t numBroadcastRequests = 0;
+
+		/// Number of static values sent with a smaller variation than the configured one
+		uint32_t numCompactedStaticValues = 0;
+
+		/// Object bytes saved by compact static variation selection
+		uint32_t numStaticBytesSaved = 0;
+
+		/// time from receiving a request to transmitting its response in microseconds
+		openpal::HistogramSummary requestProcessing;
+
+		/// time from recording an event to writing it into a response in microseconds
+		openpal::HistogramSummary eventAge;
+
+		/// Average number of events per unsolicited fragment
+		double AverageEventsPerUnsolicitedFragment() const
+		{
+			return (numUnsolicitedFragments == 0) ? 0.0 : static_cast<double>(numUnsolicitedEvents) / numUnsolicitedFragments;
+		}
+	};
+
+	struct Master
+	{
+		/// Number of static values forwarded to the ISOEHandler by the change-only filter
+		uint32_t numStaticForwarded = 0;
+
+		/// Number of unchanged static values dropped by the change-only filter
+		uint32_t numStaticSuppressed = 0;
+
+		/// smoothed round trip time of application layer requests in milliseconds, only measured with MasterParams::adaptiveResponseTimeout
+		uint32_t smoothedRttMs = 0;
+
+		/// mean deviation of the round trip time in milliseconds
+		uint32_t rttVarianceMs = 0;
+
+		/// response timeout currently applied to application layer requests in milliseconds
+		uint32_t responseTimeoutMs = 0;
+
+		/// time from a request to the first fragment of its response in microseconds
+		openpal::HistogramSummary requestLatency;
+
+		/// time from the start of a command task to its final response in microseconds
+		openpal::HistogramSummary commandLatency;
+	};
+
 	StackStatistics() = default;
 
 	StackStatistics(const Link& link, const Transport& transport) :
@@ -90,6 +164,12 @@ struct StackStatistics
 
 	Link link;
 	Transport transport;
+
+	/// only populated for outstation stacks
+	Outstation outstation;
+
+	/// only populated for master stacks
+	Master master;
 };
 
 }
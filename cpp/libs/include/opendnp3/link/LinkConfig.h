@@ -83,6 +83,13 @@ struct LinkConfig
 	/// the interval for keep-alive messages (link status requests)
 	openpal::TimeDuration KeepAliveTimeout;
 
+	/// If true, the response timeout is derived from the measured round trip time of previous frames.
+	/// Timeout is then the initial and largest timeout used.
+	bool AdaptiveTimeout = false;
+
+	/// the smallest response timeout used in adaptive mode
+	openpal::TimeDuration MinTimeout = openpal::TimeDuration::Milliseconds(100);
+
 private:
 
 	LinkConfig() {}
@@ -21,6 +21,8 @@
 #ifndef OPENDNP3_LINKSTATISTICS_H
 #define OPENDNP3_LINKSTATISTICS_H
 
+#include <openpal/util/Histogram.h>
+
 #include <cstdint>
 
 namespace opendnp3
@@ -74,6 +76,9 @@ struct LinkStatistics
 
 		/// Number of frames transmitted
 		uint32_t numLinkFrameTx = 0;
+
+		/// time frames waited in the transmit queue before being written in microseconds
+		openpal::HistogramSummary txQueueLatency;
 	};
 
 	LinkStatistics() = default;
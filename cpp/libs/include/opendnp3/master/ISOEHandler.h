@@ -33,6 +33,8 @@
 #include "opendnp3/app/parsing/ICollection.h"
 
 #include "opendnp3/master/HeaderInfo.h"
+#include "opendnp3/master/TaskId.h"
+#include "opendnp3/gen/MasterTaskType.h"
 #include "openpal/executor/UTCTimestamp.h"
 
 namespace opendnp3
@@ -45,6 +47,8 @@ namespace opendnp3
 * A call is made to the appropriate member method for every measurement value in an ASDU.
 * The HeaderInfo class provides information about the object header associated with the value.
 *
+* By default, each response fragment is a separate Start()/End() transaction. When MasterParams::groupResponseFragments
+* is set, a single transaction spans every fragment of a poll's response and is bracketed by BeginResponse()/EndResponse().
 */
 class ISOEHandler : public ITransactable
 {
@@ -64,6 +68,12 @@ public:
 	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<SecurityStat>>& values) = 0;
 	virtual void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) = 0;
 
+	/// Called before Start() when a transaction will span every fragment of the response to the specified task
+	virtual void BeginResponse(MasterTaskType type, TaskId id) {}
+
+	/// Called after End() for a transaction started with BeginResponse(). 'success' is false if the task failed before the final fragment.
+	virtual void EndResponse(MasterTaskType type, TaskId id, bool success) {}
+
 	virtual ~ISOEHandler() {}
 };
 
@@ -0,0 +1,83 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MASTERLATENCIES_H
+#define OPENDNP3_MASTERLATENCIES_H
+
+#include "opendnp3/gen/MasterTaskType.h"
+#include "opendnp3/master/TaskId.h"
+
+#include <openpal/util/Histogram.h>
+
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* Latency histograms of a master, in microseconds.
+*
+* Request latency is the time from transmitting a request to receiving the first fragment of its response.
+* Command latency is the time from the first request of a command task to its final response, i.e. both
+* the SELECT and the OPERATE of select-before-operate.
+*/
+class MasterLatencies
+{
+public:
+
+	static const uint8_t NUM_TASK_TYPES = static_cast<uint8_t>(MasterTaskType::SET_SESSION_KEYS) + 1;
+
+	explicit MasterLatencies(uint16_t maxTaskIds = 0);
+
+	/// request latency of every task of a type
+	const openpal::Histogram& RequestLatency(MasterTaskType type) const;
+
+	/// request latency of the tasks with a user defined id, or nullptr if no histogram was assigned to the id
+	const openpal::Histogram* RequestLatency(TaskId id) const;
+
+	/// request latency of every task
+	openpal::Histogram RequestLatency() const;
+
+	void RecordRequest(MasterTaskType type, TaskId id, uint64_t micros);
+
+	/// DIRECT_OPERATE command tasks
+	openpal::Histogram directOperate;
+
+	/// SELECT / OPERATE command tasks
+	openpal::Histogram selectAndOperate;
+
+private:
+
+	struct TaskIdLatency
+	{
+		int id = 0;
+		openpal::Histogram latency;
+	};
+
+	openpal::Histogram byTaskType[NUM_TASK_TYPES];
+
+	// slots are assigned to ids in the order they are first seen and are never reassigned
+	std::vector<TaskIdLatency> byTaskId;
+	uint16_t numTaskIds = 0;
+};
+
+}
+
+#endif
@@ -26,6 +26,8 @@
 #include "opendnp3/gen/TimeSyncMode.h"
 #include "opendnp3/app/ClassField.h"
 #include "opendnp3/app/AppConstants.h"
+#include "opendnp3/outstation/DatabaseSizes.h"
+#include "opendnp3/BufferPool.h"
 
 namespace opendnp3
 {
@@ -41,6 +43,13 @@ struct MasterParams
 	/// Application layer response timeout
 	openpal::TimeDuration responseTimeout = openpal::TimeDuration::Seconds(5);
 
+	/// If true, the response timeout is derived from the measured round trip time of previous requests.
+	/// responseTimeout is then the initial and largest timeout used.
+	bool adaptiveResponseTimeout = false;
+
+	/// Smallest response timeout used in adaptive mode
+	openpal::TimeDuration minResponseTimeout = openpal::TimeDuration::Seconds(1);
+
 	/// If true, the master will do time syncs when it sees the time IIN bit from the outstation
 	TimeSyncMode timeSyncMode = TimeSyncMode::None;
 
@@ -74,6 +83,31 @@ struct MasterParams
 
 	/// maximum APDU rx size in bytes
 	uint32_t maxRxFragSize = DEFAULT_MAX_APDU_SIZE;
+
+	/// Number of points of each type held in the optional last-value cache, all zero disables the cache
+	DatabaseSizes cacheSizes = DatabaseSizes::Empty();
+
+	/// If true, a single ISOEHandler transaction spans every fragment of a poll's response instead of one per fragment
+	bool groupResponseFragments = false;
+
+	/// Relative share of the bus given to this master on a multidrop channel that uses fair queuing
+	uint16_t channelWeight = 1;
+
+	/// If true, a poll receiving a multi-fragment response is abandoned at the next fragment boundary when a command is waiting,
+	/// and restarted after the command. Command latency is then bounded by one fragment instead of the whole response.
+	bool preemptPollsForCommands = false;
+
+	/// If true, static values are only passed to the ISOEHandler when they are new or their value or flags changed
+	bool filterUnchangedStatic = false;
+
+	/// Optional pool shared between masters. When set, the rx and tx fragment buffers are only held while in use.
+	std::shared_ptr<BufferPool> bufferPool;
+
+	/// If true, the master keeps request and command latency histograms, see MasterLatencies
+	bool latencyHistograms = true;
+
+	/// Number of distinct user TaskIds that get their own request latency histogram
+	uint16_t maxTaskIdLatencyHistograms = 4;
 };
 
 }
@@ -0,0 +1,276 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MEASUREMENTCACHE_H
+#define OPENDNP3_MEASUREMENTCACHE_H
+
+#include "opendnp3/app/MeasurementTypes.h"
+#include "opendnp3/app/Indexed.h"
+#include "opendnp3/app/parsing/ICollection.h"
+#include "opendnp3/outstation/DatabaseSizes.h"
+
+#include <openpal/container/Array.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* The last value received for a point along with the cache sequence number of the update
+*/
+template <class T>
+struct CachedValue
+{
+	T value;
+
+	/// Sequence number of the update that produced the value, 0 if the point has never been received
+	uint64_t sequence = 0;
+};
+
+/**
+* Optional last-value cache maintained by a master for a single outstation.
+*
+* Values are stored in dense arrays per measurement type, sized by MasterParams::cacheSizes.
+* Every cached update is assigned an increasing sequence number so that consumers can poll
+* for the points that changed since a sequence they've already seen.
+*
+* The master writes the cache from its executor, one object header at a time. Reads may happen from any
+* thread and are protected by a sequence lock: readers retry until they observe a copy that wasn't
+* concurrently modified, so a snapshot never contains part of an object header.
+*/
+class MeasurementCache : private openpal::Uncopyable
+{
+	template <class T>
+	using table_t = openpal::Array<CachedValue<T>, uint16_t>;
+
+public:
+
+	explicit MeasurementCache(const DatabaseSizes& sizes);
+
+	/// True if the sizes specify at least one point
+	static bool IsEnabled(const DatabaseSizes& sizes);
+
+	/// Sequence number of the most recent update, 0 if nothing has been cached. Safe from any thread.
+	uint64_t GetSequence() const;
+
+	/**
+	* Read the last value of a single point. Safe from any thread.
+	*
+	* @return false if the index is out of range or the point has never been received
+	*/
+	template <class T>
+	bool Read(uint16_t index, CachedValue<T>& value) const;
+
+	/**
+	* Copy every point of a type. Safe from any thread.
+	*
+	* @return the cache sequence number the snapshot is consistent with
+	*/
+	template <class T>
+	uint64_t Snapshot(std::vector<CachedValue<T>>& values) const;
+
+	/**
+	* Copy the points of a type that were updated after the specified sequence number. Safe from any thread.
+	*
+	* @return the cache sequence number to pass to the next call
+	*/
+	template <class T>
+	uint64_t ChangedSince(uint64_t sequence, std::vector<Indexed<T>>& values) const;
+
+	// ------ writer side, only called from the master's executor ------
+
+	void BeginUpdate();
+
+	template <class T>
+	void Update(const ICollection<Indexed<T>>& values);
+
+	void EndUpdate();
+
+private:
+
+	template <class T>
+	table_t<T>& GetTable();
+
+	template <class T>
+	const table_t<T>& GetTable() const
+	{
+		return const_cast<MeasurementCache*>(this)->GetTable<T>();
+	}
+
+	template <class Fun>
+	void ReadConsistent(const Fun& fun) const;
+
+	// odd while the master is writing
+	std::atomic<uint64_t> version;
+	std::atomic<uint64_t> sequence;
+
+	table_t<Binary> binaries;
+	table_t<DoubleBitBinary> doubleBinaries;
+	table_t<Analog> analogs;
+	table_t<Counter> counters;
+	table_t<FrozenCounter> frozenCounters;
+	table_t<BinaryOutputStatus> binaryOutputStatii;
+	table_t<AnalogOutputStatus> analogOutputStatii;
+	table_t<TimeAndInterval> timeAndIntervals;
+};
+
+template <> inline MeasurementCache::table_t<Binary>& MeasurementCache::GetTable<Binary>()
+{
+	return binaries;
+}
+
+template <> inline MeasurementCache::table_t<DoubleBitBinary>& MeasurementCache::GetTable<DoubleBitBinary>()
+{
+	return doubleBinaries;
+}
+
+template <> inline MeasurementCache::table_t<Analog>& MeasurementCache::GetTable<Analog>()
+{
+	return analogs;
+}
+
+template <> inline MeasurementCache::table_t<Counter>& MeasurementCache::GetTable<Counter>()
+{
+	return counters;
+}
+
+template <> inline MeasurementCache::table_t<FrozenCounter>& MeasurementCache::GetTable<FrozenCounter>()
+{
+	return frozenCounters;
+}
+
+template <> inline MeasurementCache::table_t<BinaryOutputStatus>& MeasurementCache::GetTable<BinaryOutputStatus>()
+{
+	return binaryOutputStatii;
+}
+
+template <> inline MeasurementCache::table_t<AnalogOutputStatus>& MeasurementCache::GetTable<AnalogOutputStatus>()
+{
+	return analogOutputStatii;
+}
+
+template <> inline MeasurementCache::table_t<TimeAndInterval>& MeasurementCache::GetTable<TimeAndInterval>()
+{
+	return timeAndIntervals;
+}
+
+template <class Fun>
+void MeasurementCache::ReadConsistent(const Fun& fun) const
+{
+	for (;;)
+	{
+		auto before = version.load(std::memory_order_acquire);
+		if ((before & 1) == 0)
+		{
+			fun();
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (version.load(std::memory_order_relaxed) == before)
+			{
+				return;
+			}
+		}
+		std::this_thread::yield();
+	}
+}
+
+template <class T>
+bool MeasurementCache::Read(uint16_t index, CachedValue<T>& value) const
+{
+	const auto& table = this->GetTable<T>();
+
+	if (!table.Contains(index))
+	{
+		return false;
+	}
+
+	this->ReadConsistent([&]()
+	{
+		value = table[index];
+	});
+
+	return value.sequence != 0;
+}
+
+template <class T>
+uint64_t MeasurementCache::Snapshot(std::vector<CachedValue<T>>& values) const
+{
+	const auto& table = this->GetTable<T>();
+	uint64_t ret = 0;
+
+	this->ReadConsistent([&]()
+	{
+		values.resize(table.Size());
+		for (uint16_t i = 0; i < table.Size(); ++i)
+		{
+			values[i] = table[i];
+		}
+		ret = sequence.load(std::memory_order_relaxed);
+	});
+
+	return ret;
+}
+
+template <class T>
+uint64_t MeasurementCache::ChangedSince(uint64_t since, std::vector<Indexed<T>>& values) const
+{
+	const auto& table = this->GetTable<T>();
+	uint64_t ret = 0;
+
+	this->ReadConsistent([&]()
+	{
+		values.clear();
+		for (uint16_t i = 0; i < table.Size(); ++i)
+		{
+			if (table[i].sequence > since)
+			{
+				values.push_back(WithIndex(table[i].value, i));
+			}
+		}
+		ret = sequence.load(std::memory_order_relaxed);
+	});
+
+	return ret;
+}
+
+template <class T>
+void MeasurementCache::Update(const ICollection<Indexed<T>>& values)
+{
+	auto& table = this->GetTable<T>();
+
+	auto update = [this, &table](const Indexed<T>& item)
+	{
+		if (table.Contains(item.index))
+		{
+			auto& cell = table[item.index];
+			cell.value = item.value;
+			cell.sequence = this->sequence.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+	};
+
+	values.ForeachItem(update);
+}
+
+}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MULTIDROPSCHEDULERCONFIG_H
+#define OPENDNP3_MULTIDROPSCHEDULERCONFIG_H
+
+#include <openpal/executor/TimeDuration.h>
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Controls how the masters on a multidrop channel share the bus
+*/
+struct MultidropSchedulerConfig
+{
+	/// Default constructor
+	MultidropSchedulerConfig() {}
+
+	/// If false, masters are granted the channel in the order they requested it.
+	/// If true, masters are granted the channel in proportion to their MasterParams::channelWeight, charged by the bus time their requests consume.
+	bool fairQueuing = false;
+
+	/// Number of consecutive response timeouts after which a master is only granted the channel on a back-off probe schedule.
+	/// Only used with fair queuing.
+	uint32_t timeoutsBeforeBackoff = 2;
+
+	/// Delay until the first probe of a failing outstation, doubled after each further timeout
+	openpal::TimeDuration minBackoff = openpal::TimeDuration::Seconds(10);
+
+	/// Upper bound for the probe delay
+	openpal::TimeDuration maxBackoff = openpal::TimeDuration::Minutes(5);
+};
+
+}
+
+#endif
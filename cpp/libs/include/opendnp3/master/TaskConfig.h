@@ -53,12 +53,22 @@ public:
 		return TaskConfig(TaskId::Undefined(), &callback);
 	}
 
+	static TaskConfig Coalesced()
+	{
+		auto config = TaskConfig::Default();
+		config.coalesce = true;
+		return config;
+	}
+
 	TaskConfig() = delete;
 
 public:
 
 	TaskId taskId;
 	ITaskCallback* pCallback;
+
+	/// If true, the request headers of a READ task may be merged into a single APDU with other READ tasks that are due at the same time
+	bool coalesce = false;
 };
 
 }
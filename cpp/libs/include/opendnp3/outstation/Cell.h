@@ -21,6 +21,8 @@
 #ifndef OPENDNP3_CELL_H
 #define OPENDNP3_CELL_H
 
+#include <cstdint>
+
 namespace opendnp3
 {
 
@@ -30,12 +32,13 @@ namespace opendnp3
 template <class Spec>
 struct SelectedValue
 {
-	SelectedValue() : selected(false), value(), variation(Spec::DefaultStaticVariation)
+	SelectedValue() : selected(false), value(), variation(Spec::DefaultStaticVariation), bitsSaved(0)
 	{}
 
 	bool selected;
 	typename Spec::meas_t value;
 	typename Spec::static_variation_t variation;
+	uint8_t bitsSaved;	// saved by a compact variation, counted once the value is written
 };
 
 /**
@@ -0,0 +1,107 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_IASYNCCOMMANDHANDLER_H
+#define OPENDNP3_IASYNCCOMMANDHANDLER_H
+
+#include "opendnp3/app/ControlRelayOutputBlock.h"
+#include "opendnp3/app/AnalogOutput.h"
+#include "opendnp3/app/ITransactable.h"
+#include "opendnp3/gen/OperateType.h"
+
+#include <memory>
+
+namespace opendnp3
+{
+
+class AsyncCommandBatch;
+
+/**
+* Handle used to report the result of a single command dispatched to an IAsyncCommandHandler.
+*
+* Copies refer to the same command. Complete() may be called from any thread, only the first call has any effect.
+*/
+class CommandCompletion
+{
+public:
+
+	CommandCompletion(const std::shared_ptr<AsyncCommandBatch>& batch, uint8_t position);
+
+	/**
+	* Report the result of the command. The outstation responds once every command in the request has completed.
+	*/
+	void Complete(CommandStatus status) const;
+
+private:
+
+	std::shared_ptr<AsyncCommandBatch> batch;
+	uint8_t position;
+};
+
+/**
+* Interface used to dispatch SELECT / OPERATE / DIRECT OPERATE (Binary/Analog output) from the outstation to application
+* code that cannot answer synchronously, e.g. because the control is forwarded to a PLC or another device.
+*
+* Each method must return promptly and arrange for completion.Complete(...) to be called later. The outstation defers the
+* response until every command in the request has completed, continuing to service other requests in the meantime.
+* Commands that are not completed within OutstationParams::asyncCommandTimeout are answered with CommandStatus::TIMEOUT.
+*
+* The ITransactable sub-interface is used to determine the start and end of an ASDU containing commands.
+*/
+class IAsyncCommandHandler : public ITransactable
+{
+public:
+	virtual ~IAsyncCommandHandler() {}
+
+	/// Ask if the application supports a ControlRelayOutputBlock - group 12 variation 1
+	virtual void Select(const ControlRelayOutputBlock& command, uint16_t index, const CommandCompletion& completion) = 0;
+
+	/// Operate a ControlRelayOutputBlock - group 12 variation 1
+	virtual void Operate(const ControlRelayOutputBlock& command, uint16_t index, OperateType opType, const CommandCompletion& completion) = 0;
+
+	/// Ask if the application supports a 16 bit analog output - group 41 variation 2
+	virtual void Select(const AnalogOutputInt16& command, uint16_t index, const CommandCompletion& completion) = 0;
+
+	/// Operate a 16 bit analog output - group 41 variation 2
+	virtual void Operate(const AnalogOutputInt16& command, uint16_t index, OperateType opType, const CommandCompletion& completion) = 0;
+
+	/// Ask if the application supports a 32 bit analog output - group 41 variation 1
+	virtual void Select(const AnalogOutputInt32& command, uint16_t index, const CommandCompletion& completion) = 0;
+
+	/// Operate a 32 bit analog output - group 41 variation 1
+	virtual void Operate(const AnalogOutputInt32& command, uint16_t index, OperateType opType, const CommandCompletion& completion) = 0;
+
+	/// Ask if the application supports a single precision, floating point analog output - group 41 variation 3
+	virtual void Select(const AnalogOutputFloat32& command, uint16_t index, const CommandCompletion& completion) = 0;
+
+	/// Operate a single precision, floating point analog output - group 41 variation 3
+	virtual void Operate(const AnalogOutputFloat32& command, uint16_t index, OperateType opType, const CommandCompletion& completion) = 0;
+
+	/// Ask if the application supports a double precision, floating point analog output - group 41 variation 4
+	virtual void Select(const AnalogOutputDouble64& command, uint16_t index, const CommandCompletion& completion) = 0;
+
+	/// Operate a double precision, floating point analog output - group 41 variation 4
+	virtual void Operate(const AnalogOutputDouble64& command, uint16_t index, OperateType opType, const CommandCompletion& completion) = 0;
+
+};
+
+}
+
+#endif
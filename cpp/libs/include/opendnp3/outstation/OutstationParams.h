@@ -47,6 +47,10 @@ struct OutstationParams
 	/// How long the outstation will allow an operate to proceed after a prior select
 	openpal::TimeDuration selectTimeout = openpal::TimeDuration::Seconds(10);
 
+	/// How long the outstation waits for an IAsyncCommandHandler to complete the commands in a request
+	/// before answering the outstanding ones with CommandStatus::TIMEOUT
+	openpal::TimeDuration asyncCommandTimeout = DEFAULT_APP_TIMEOUT;
+
 	/// Timeout for solicited confirms
 	openpal::TimeDuration solConfirmTimeout = DEFAULT_APP_TIMEOUT;
 
@@ -62,14 +66,50 @@ struct OutstationParams
 	/// The maximum fragment size the outstation will be able to receive
 	uint32_t maxRxFragSize = DEFAULT_MAX_APDU_SIZE;
 
+	/// When true, the next fragment of a multi-fragment response is encoded into a second transmit buffer while
+	/// waiting for the confirm of the previous fragment. Costs an additional buffer of maxTxFragSize bytes.
+	bool preEncodeResponses = false;
+
 	/// Global enabled / disable for unsolicited messages. If false, the NULL unsolicited message is not even sent
 	bool allowUnsolicited = false;
 
 	/// A bitmask type that specifies the types allowed in a class 0 reponse
 	StaticTypeBitField typesAllowedInClass0 = StaticTypeBitField::AllTypes();
 
+	/// Static types for which reads of the default variation (class 0, variation 0) use the smallest encoding that
+	/// represents every selected value without loss, e.g. Group30Var4 instead of Group30Var1 when all analogs fit in
+	/// 16 bits and are ONLINE. Supported for binary, counter, analog and analog output status. Disabled by default.
+	StaticTypeBitField compactStaticTypes = StaticTypeBitField();
+
+	/// When true, each header is encoded with whichever qualifier takes the fewest bytes: sparse static points are
+	/// sent as one index-prefixed header instead of a start-stop header per run, and 1-byte index prefixes (0x17) are
+	/// used instead of 2-byte prefixes (0x28) when every index fits. Disabled by default.
+	bool optimizeQualifiers = false;
+
 	/// Class mask for unsolicted, default to 0 as unsolicited has to be enabled
 	ClassField unsolClassMask = ClassField::None();
+
+	/// How long class 1 events may be held before an unsolicited response is sent. Zero (the default) sends
+	/// class 1 immediately, which also flushes any class 2/3 events being held at that moment
+	openpal::TimeDuration unsolClass1HoldTime = openpal::TimeDuration::Zero();
+
+	/// How long class 2 events may be held before an unsolicited response is sent. Zero sends immediately.
+	openpal::TimeDuration unsolClass2HoldTime = openpal::TimeDuration::Zero();
+
+	/// How long class 3 events may be held before an unsolicited response is sent. Zero sends immediately.
+	openpal::TimeDuration unsolClass3HoldTime = openpal::TimeDuration::Zero();
+
+	/// Number of buffered class 1 events that triggers an unsolicited response before the hold time expires. Zero disables the threshold.
+	uint32_t unsolClass1MaxEvents = 0;
+
+	/// Number of buffered class 2 events that triggers an unsolicited response before the hold time expires. Zero disables the threshold.
+	uint32_t unsolClass2MaxEvents = 0;
+
+	/// Number of buffered class 3 events that triggers an unsolicited response before the hold time expires. Zero disables the threshold.
+	uint32_t unsolClass3MaxEvents = 0;
+
+	/// If true, the outstation keeps request processing and event age histograms, see OutstationLatencies
+	bool latencyHistograms = true;
 };
 
 }
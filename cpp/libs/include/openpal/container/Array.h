@@ -80,6 +80,17 @@ public:
 		return buffer[index];
 	}
 
+	// exchange the underlying storage with another array without copying
+	void Swap(Array& other)
+	{
+		auto tmpBuffer = buffer;
+		auto tmpSize = this->size;
+		buffer = other.buffer;
+		this->size = other.size;
+		other.buffer = tmpBuffer;
+		other.size = tmpSize;
+	}
+
 	template <class Action>
 	void foreach(const Action& action) const
 	{
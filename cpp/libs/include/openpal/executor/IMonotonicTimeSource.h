@@ -34,6 +34,12 @@ public:
 
 	/// @return a non-absolute timestamp for the monotonic time source
 	virtual MonotonicTimestamp GetTime() = 0;
+
+	/// @return a non-absolute timestamp in microseconds for latency measurements, by default with the resolution of GetTime()
+	virtual int64_t GetMicroseconds()
+	{
+		return this->GetTime().milliseconds * 1000;
+	}
 };
 
 }
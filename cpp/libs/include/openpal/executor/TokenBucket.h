@@ -0,0 +1,68 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENPAL_TOKENBUCKET_H
+#define OPENPAL_TOKENBUCKET_H
+
+#include "MonotonicTimestamp.h"
+
+#include <cstdint>
+
+namespace openpal
+{
+
+/**
+* Token bucket used to limit the rate of some operation, e.g. accepting connections
+*
+* The bucket starts full and refills continuously at 'rate' tokens per second up to 'burst' tokens.
+* A rate of 0 disables limiting.
+*/
+class TokenBucket
+{
+
+public:
+
+	TokenBucket(uint32_t rate, uint32_t burst);
+
+	/// Try to consume a single token at the specified time
+	bool TryConsume(const MonotonicTimestamp& now);
+
+	bool IsLimited() const
+	{
+		return rate != 0;
+	}
+
+private:
+
+	void Refill(const MonotonicTimestamp& now);
+
+	const uint32_t rate;
+
+	// token counts are in thousandths so that refills per millisecond are exact
+	const uint64_t capacity;
+	uint64_t tokens;
+
+	MonotonicTimestamp last;
+	bool started = false;
+};
+
+}
+
+#endif
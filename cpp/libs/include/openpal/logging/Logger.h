@@ -73,6 +73,11 @@ public:
 
 	bool IsEnabled(const LogFilters& filters) const;
 
+	const std::string& GetId() const
+	{
+		return this->settings->id;
+	}
+
 	LogFilters GetFilters() const
 	{
 		return this->settings->levels;
@@ -28,10 +28,72 @@
 #include "openpal/container/WSlice.h"
 
 #include "openpal/util/Limits.h"
+#include "openpal/util/Uncopyable.h"
+
+#if (defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)) || defined(_WIN32)
+#define OPENPAL_LITTLE_ENDIAN_HOST
+#endif
 
 namespace openpal
 {
 
+/**
+* Unaligned little endian loads and stores. On hosts known to be little endian the bytes are
+* copied with memcpy (a single unaligned access on common targets), everywhere else they are
+* assembled with shifts, which is independent of the machine byte order.
+*/
+class LittleEndian : private StaticOnly
+{
+public:
+
+	static uint16_t Load16(const uint8_t* data)
+	{
+#ifdef OPENPAL_LITTLE_ENDIAN_HOST
+		uint16_t value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+#else
+		return static_cast<uint16_t>((static_cast<uint16_t>(data[0]) << 0) | (static_cast<uint16_t>(data[1]) << 8));
+#endif
+	}
+
+	static uint32_t Load32(const uint8_t* data)
+	{
+#ifdef OPENPAL_LITTLE_ENDIAN_HOST
+		uint32_t value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+#else
+		return	(static_cast<uint32_t>(data[0]) << 0)	|
+		        (static_cast<uint32_t>(data[1]) << 8)	|
+		        (static_cast<uint32_t>(data[2]) << 16) |
+		        (static_cast<uint32_t>(data[3]) << 24);
+#endif
+	}
+
+	static void Store16(uint8_t* data, uint16_t value)
+	{
+#ifdef OPENPAL_LITTLE_ENDIAN_HOST
+		memcpy(data, &value, sizeof(value));
+#else
+		data[0] = static_cast<uint8_t>(value & 0xFF);
+		data[1] = static_cast<uint8_t>((value >> 8) & 0xFF);
+#endif
+	}
+
+	static void Store32(uint8_t* data, uint32_t value)
+	{
+#ifdef OPENPAL_LITTLE_ENDIAN_HOST
+		memcpy(data, &value, sizeof(value));
+#else
+		data[0] = static_cast<uint8_t>(value & 0xFF);
+		data[1] = static_cast<uint8_t>((value >> 8) & 0xFF);
+		data[2] = static_cast<uint8_t>((value >> 16) & 0xFF);
+		data[3] = static_cast<uint8_t>((value >> 24) & 0xFF);
+#endif
+	}
+};
+
 template <class T>
 class Bit16LE
 {
@@ -39,13 +101,12 @@ public:
 
 	static T Read(const uint8_t* data)
 	{
-		return (static_cast<T>(data[0]) << 0) | (static_cast<T>(data[1]) << 8);
+		return static_cast<T>(LittleEndian::Load16(data));
 	}
 
 	static void Write(uint8_t* data, T value)
 	{
-		data[0] = static_cast<uint8_t>(value & 0xFF);
-		data[1] = static_cast<uint8_t>((value >> 8) & 0xFF);
+		LittleEndian::Store16(data, static_cast<uint16_t>(value));
 	}
 
 	static void WriteBuffer(WSlice& buffer, T aValue)
@@ -79,25 +140,14 @@ class Bit32LE
 {
 public:
 
-	// Endianness doesn't apply to everything. If you do bitwise or bitshift operations on an int, you don't notice the endianness.
-	// The machine arranges the multiple bytes, so the least significant byte is still the least significant byte, and the most
-	// significant byte is still the most significant byte
-
-	// This is endian independent of the machine order
 	static T Read(const uint8_t* data)
 	{
-		return	(static_cast<T>(data[0]) << 0)	|
-		        (static_cast<T>(data[1]) << 8)	|
-		        (static_cast<T>(data[2]) << 16) |
-		        (static_cast<T>(data[3]) << 24);
+		return static_cast<T>(LittleEndian::Load32(data));
 	}
 
 	static void Write(uint8_t* data, T value)
 	{
-		data[0] = static_cast<uint8_t>(value & 0xFF);
-		data[1] = static_cast<uint8_t>((value >> 8) & 0xFF);
-		data[2] = static_cast<uint8_t>((value >> 16) & 0xFF);
-		data[3] = static_cast<uint8_t>((value >> 24) & 0xFF);
+		LittleEndian::Store32(data, static_cast<uint32_t>(value));
 	}
 
 	static void WriteBuffer(WSlice& buffer, T aValue)
@@ -0,0 +1,111 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENPAL_HISTOGRAM_H
+#define OPENPAL_HISTOGRAM_H
+
+#include <cstdint>
+
+namespace openpal
+{
+
+/**
+* Count, mean, extremes and percentiles of a Histogram
+*/
+struct HistogramSummary
+{
+	uint64_t count = 0;
+	uint64_t min = 0;
+	uint64_t mean = 0;
+	uint64_t p50 = 0;
+	uint64_t p90 = 0;
+	uint64_t p99 = 0;
+	uint64_t p999 = 0;
+	uint64_t max = 0;
+};
+
+/**
+* Fixed size histogram of non-negative integer values with HDR-style log-linear buckets.
+*
+* Values below 2 * SUB_BUCKETS are counted exactly. Every power of two above that is split into SUB_BUCKETS
+* equal buckets, so a percentile is accurate to within 1 / SUB_BUCKETS of its value. Values of 2^MAX_MAGNITUDE
+* and above are counted in the last bucket. Recording is a handful of integer operations and never allocates.
+*/
+class Histogram
+{
+
+public:
+
+	static const uint32_t SUB_BUCKET_BITS = 4;
+	static const uint32_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+	static const uint32_t MAX_MAGNITUDE = 36;
+	static const uint32_t NUM_BUCKETS = 2 * SUB_BUCKETS + (MAX_MAGNITUDE - SUB_BUCKET_BITS - 1) * SUB_BUCKETS;
+
+	Histogram();
+
+	void Record(uint64_t value);
+
+	/// add every sample of another histogram to this one
+	void Merge(const Histogram& other);
+
+	void Reset();
+
+	uint64_t Count() const
+	{
+		return count;
+	}
+
+	uint64_t Min() const
+	{
+		return (count == 0) ? 0 : min;
+	}
+
+	uint64_t Max() const
+	{
+		return max;
+	}
+
+	uint64_t Mean() const
+	{
+		return (count == 0) ? 0 : (sum / count);
+	}
+
+	/// @return the highest value equivalent to the sample at 'percentile' in [0, 100]
+	uint64_t ValueAtPercentile(double percentile) const;
+
+	HistogramSummary Summarize() const;
+
+	static uint32_t BucketIndex(uint64_t value);
+
+	/// @return the highest value counted in a bucket
+	static uint64_t BucketUpperBound(uint32_t index);
+
+private:
+
+	uint32_t buckets[NUM_BUCKETS];
+	uint64_t count;
+	uint64_t sum;
+	uint64_t min;
+	uint64_t max;
+};
+
+}
+
+#endif
@@ -0,0 +1,137 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/BroadcastSession.h"
+
+#include <openpal/logging/LogMacros.h>
+
+#include <opendnp3/LogLevels.h>
+#include <opendnp3/app/APDURequest.h>
+#include <opendnp3/app/AppConstants.h>
+#include <opendnp3/link/LinkFrame.h>
+#include <opendnp3/link/LinkLayerConstants.h>
+#include <opendnp3/transport/TransportTx.h>
+
+using namespace openpal;
+using namespace opendnp3;
+
+namespace asiodnp3
+{
+
+// room for the largest APDU split into maximum size frames
+const uint32_t MAX_BROADCAST_FRAMES = (DEFAULT_MAX_APDU_SIZE + MAX_TPDU_PAYLOAD - 1) / MAX_TPDU_PAYLOAD;
+
+void BroadcastSession::Start(
+    openpal::Logger logger,
+    const std::shared_ptr<IOHandler>& iohandler,
+    uint16_t source,
+    FunctionCode function,
+    const WriteHeadersT& writeHeaders,
+    const BroadcastCallbackT& callback)
+{
+	if (!iohandler->IsOnline())
+	{
+		SIMPLE_LOG_BLOCK(logger, flags::WARN, "Unable to broadcast while the channel is offline");
+		callback(false);
+		return;
+	}
+
+	auto session = std::make_shared<BroadcastSession>(logger, iohandler, callback);
+
+	if (!session->Format(source, function, writeHeaders))
+	{
+		SIMPLE_LOG_BLOCK(logger, flags::ERR, "Broadcast request does not fit in a single APDU");
+		callback(false);
+		return;
+	}
+
+	session->TransmitNext();
+}
+
+BroadcastSession::BroadcastSession(const openpal::Logger& logger, const std::shared_ptr<IOHandler>& iohandler, const BroadcastCallbackT& callback) :
+	logger(logger),
+	iohandler(iohandler),
+	callback(callback),
+	buffer(MAX_BROADCAST_FRAMES * LPDU_MAX_FRAME_SIZE)
+{
+
+}
+
+bool BroadcastSession::OnTransmitResult(bool success)
+{
+	if (success && !this->frames.empty())
+	{
+		this->TransmitNext();
+	}
+	else
+	{
+		this->frames.clear();
+		this->callback(success);
+	}
+
+	return true;
+}
+
+bool BroadcastSession::Format(uint16_t source, FunctionCode function, const WriteHeadersT& writeHeaders)
+{
+	Buffer apduBuffer(DEFAULT_MAX_APDU_SIZE);
+
+	APDURequest request(apduBuffer.GetWSlice());
+	request.SetFunction(function);
+	request.SetControl(AppControlField::Request(0));
+	auto writer = request.GetWriter();
+
+	if (!writeHeaders(writer))
+	{
+		return false;
+	}
+
+	TransportTx tx(this->logger);
+	tx.Configure(request.ToRSlice());
+
+	auto output = this->buffer.GetWSlice();
+
+	do
+	{
+		auto segment = tx.GetSegment();
+		auto frame = LinkFrame::FormatUnconfirmedUserData(
+		                 output,
+		                 true,
+		                 LINK_BROADCAST_DONT_CONFIRM,
+		                 source,
+		                 segment,
+		                 static_cast<uint8_t>(segment.Size()),
+		                 &this->logger
+		             );
+		this->frames.push_back(frame);
+	}
+	while (tx.Advance());
+
+	return true;
+}
+
+void BroadcastSession::TransmitNext()
+{
+	auto frame = this->frames.front();
+	this->frames.pop_front();
+	this->iohandler->BeginTransmit(shared_from_this(), frame);
+}
+
+}
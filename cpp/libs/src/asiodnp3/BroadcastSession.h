@@ -0,0 +1,100 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_BROADCASTSESSION_H
+#define ASIODNP3_BROADCASTSESSION_H
+
+#include <openpal/logging/Logger.h>
+#include <openpal/container/Buffer.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <opendnp3/app/HeaderWriter.h>
+#include <opendnp3/gen/FunctionCode.h>
+#include <opendnp3/link/ILinkSession.h>
+#include <opendnp3/master/BroadcastCallbackT.h>
+
+#include "asiodnp3/IOHandler.h"
+
+#include <deque>
+
+namespace asiodnp3
+{
+
+/**
+* Transmits a single request to a broadcast address on behalf of a channel.
+*
+* The session isn't bound to a route since nothing is ever received in reply. It lives until its last frame
+* has been written or the channel closes.
+*/
+class BroadcastSession final : public opendnp3::ILinkSession, public std::enable_shared_from_this<BroadcastSession>, private openpal::Uncopyable
+{
+
+public:
+
+	typedef std::function<bool(opendnp3::HeaderWriter&)> WriteHeadersT;
+
+	/// Format the request and begin transmitting it. Must be called from the channel's strand.
+	static void Start(
+	    openpal::Logger logger,
+	    const std::shared_ptr<IOHandler>& iohandler,
+	    uint16_t source,
+	    opendnp3::FunctionCode function,
+	    const WriteHeadersT& writeHeaders,
+	    const opendnp3::BroadcastCallbackT& callback
+	);
+
+	BroadcastSession(const openpal::Logger& logger, const std::shared_ptr<IOHandler>& iohandler, const opendnp3::BroadcastCallbackT& callback);
+
+	// ------- implement ILinkSession -------
+
+	virtual bool OnFrame(const opendnp3::LinkHeaderFields& header, const openpal::RSlice& userdata) override
+	{
+		return false;
+	}
+
+	virtual bool OnTransmitResult(bool success) override;
+
+	virtual bool OnLowerLayerUp() override
+	{
+		return false;
+	}
+
+	virtual bool OnLowerLayerDown() override
+	{
+		return false;
+	}
+
+private:
+
+	bool Format(uint16_t source, opendnp3::FunctionCode function, const WriteHeadersT& writeHeaders);
+
+	void TransmitNext();
+
+	openpal::Logger logger;
+	const std::shared_ptr<IOHandler> iohandler;
+	const opendnp3::BroadcastCallbackT callback;
+
+	openpal::Buffer buffer;
+	std::deque<openpal::RSlice> frames;
+};
+
+}
+
+#endif
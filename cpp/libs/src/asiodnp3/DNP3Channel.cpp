@@ -26,6 +26,9 @@
 #include "MasterStack.h"
 #include "OutstationStack.h"
 
+#include <opendnp3/master/CommandSetOps.h>
+#include <opendnp3/objects/Group50.h>
+
 using namespace openpal;
 using namespace asiopal;
 using namespace opendnp3;
@@ -96,6 +99,11 @@ LinkStatistics DNP3Channel::GetStatistics()
 	return this->executor->ReturnFrom<LinkStatistics>(get);
 }
 
+asiopal::ExecutorStatistics DNP3Channel::GetExecutorStatistics()
+{
+	return this->executor->GetStatistics();
+}
+
 LogFilters DNP3Channel::GetLogFilters() const
 {
 	auto get = [this]()
@@ -114,6 +122,72 @@ void DNP3Channel::SetLogFilters(const LogFilters& filters)
 	this->executor->strand.post(set);
 }
 
+void DNP3Channel::SetMultidropScheduling(const MultidropSchedulerConfig& config)
+{
+	auto set = [self = this->shared_from_this(), config]()
+	{
+		self->iohandler->ConfigureTaskLock(config);
+	};
+	this->executor->strand.post(set);
+}
+
+void DNP3Channel::Broadcast(uint16_t source, FunctionCode function, const std::vector<Header>& headers, const BroadcastCallbackT& callback)
+{
+	auto write = [headers](HeaderWriter & writer) -> bool
+	{
+		for (auto& header : headers)
+		{
+			if (!header.WriteTo(writer))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	this->BeginBroadcast(source, function, write, callback);
+}
+
+void DNP3Channel::BroadcastTimeSync(uint16_t source, const UTCTimestamp& time, const BroadcastCallbackT& callback)
+{
+	auto write = [time](HeaderWriter & writer) -> bool
+	{
+		Group50Var1 value;
+		value.time = DNPTime(time.msSinceEpoch);
+		return writer.WriteSingleValue<UInt8, Group50Var1>(QualifierCode::UINT8_CNT, value);
+	};
+
+	this->BeginBroadcast(source, FunctionCode::WRITE, write, callback);
+}
+
+void DNP3Channel::BroadcastDirectOperate(uint16_t source, CommandSet&& commands, const BroadcastCallbackT& callback)
+{
+	/// this is to work around the fact that c++11 doesn't have generic move capture
+	auto set = std::make_shared<CommandSet>(std::move(commands));
+
+	auto write = [set](HeaderWriter & writer) -> bool
+	{
+		return CommandSetOps::Write(*set, writer);
+	};
+
+	this->BeginBroadcast(source, FunctionCode::DIRECT_OPERATE_NR, write, callback);
+}
+
+void DNP3Channel::BeginBroadcast(uint16_t source, FunctionCode function, const BroadcastSession::WriteHeadersT& writeHeaders, const BroadcastCallbackT& callback)
+{
+	auto action = [self = this->shared_from_this(), source, function, writeHeaders, callback]()
+	{
+		if (!self->iohandler)
+		{
+			callback(false); // channel was shutdown
+			return;
+		}
+
+		BroadcastSession::Start(self->logger, self->iohandler, source, function, writeHeaders, callback);
+	};
+	this->executor->strand.post(action);
+}
+
 std::shared_ptr<IMaster> DNP3Channel::AddMaster(const std::string& id, std::shared_ptr<ISOEHandler> SOEHandler, std::shared_ptr<IMasterApplication> application, const MasterStackConfig& config)
 {
 	auto stack = MasterStack::Create(this->logger.Detach(id), this->executor, SOEHandler, application, this->iohandler, this->resources, config, this->iohandler->TaskLock());
@@ -129,6 +203,13 @@ std::shared_ptr<IOutstation> DNP3Channel::AddOutstation(const std::string& id, s
 	return this->AddStack(config.link, stack);
 }
 
+std::shared_ptr<IOutstation> DNP3Channel::AddOutstation(const std::string& id, std::shared_ptr<IAsyncCommandHandler> commandHandler, std::shared_ptr<IOutstationApplication> application, const OutstationStackConfig& config)
+{
+	auto stack = OutstationStack::Create(this->logger.Detach(id), this->executor, commandHandler, application, this->iohandler, this->resources, config);
+
+	return this->AddStack(config.link, stack);
+}
+
 template <class T>
 std::shared_ptr<T> DNP3Channel::AddStack(const LinkConfig& link, const std::shared_ptr<T>& stack)
 {
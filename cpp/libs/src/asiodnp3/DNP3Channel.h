@@ -24,6 +24,7 @@
 
 #include "asiodnp3/IChannel.h"
 #include "asiodnp3/IOHandler.h"
+#include "asiodnp3/BroadcastSession.h"
 #include "asiopal/ResourceManager.h"
 #include "opendnp3/master/MultidropTaskLock.h"
 
@@ -59,10 +60,20 @@ public:
 
 	virtual opendnp3::LinkStatistics GetStatistics() override;
 
+	virtual asiopal::ExecutorStatistics GetExecutorStatistics() override;
+
 	virtual openpal::LogFilters GetLogFilters() const override;
 
 	virtual void SetLogFilters(const openpal::LogFilters& filters) override;
 
+	virtual void SetMultidropScheduling(const opendnp3::MultidropSchedulerConfig& config) override;
+
+	virtual void Broadcast(uint16_t source, opendnp3::FunctionCode function, const std::vector<opendnp3::Header>& headers, const opendnp3::BroadcastCallbackT& callback) override;
+
+	virtual void BroadcastTimeSync(uint16_t source, const openpal::UTCTimestamp& time, const opendnp3::BroadcastCallbackT& callback) override;
+
+	virtual void BroadcastDirectOperate(uint16_t source, opendnp3::CommandSet&& commands, const opendnp3::BroadcastCallbackT& callback) override;
+
 	virtual std::shared_ptr<IMaster> AddMaster(const std::string& id,
 	        std::shared_ptr<opendnp3::ISOEHandler> SOEHandler,
 	        std::shared_ptr<opendnp3::IMasterApplication> application,
@@ -75,10 +86,17 @@ public:
 	        std::shared_ptr<opendnp3::IOutstationApplication> application,
 	        const OutstationStackConfig& config) override;
 
+	virtual std::shared_ptr<IOutstation> AddOutstation(const std::string& id,
+	        std::shared_ptr<opendnp3::IAsyncCommandHandler> commandHandler,
+	        std::shared_ptr<opendnp3::IOutstationApplication> application,
+	        const OutstationStackConfig& config) override;
+
 private:
 
 	void ShutdownImpl();
 
+	void BeginBroadcast(uint16_t source, opendnp3::FunctionCode function, const BroadcastSession::WriteHeadersT& writeHeaders, const opendnp3::BroadcastCallbackT& callback);
+
 	// ----- generic method for adding a stack ------
 	template <class T>
 	std::shared_ptr<T> AddStack(const opendnp3::LinkConfig& link, const std::shared_ptr<T>& stack);
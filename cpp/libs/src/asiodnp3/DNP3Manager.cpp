@@ -43,6 +43,16 @@ void DNP3Manager::Shutdown()
 	impl->Shutdown();
 }
 
+void DNP3Manager::SetHandlerWatchdog(openpal::TimeDuration budget, asiopal::stall_callback_t callback)
+{
+	impl->SetHandlerWatchdog(budget, callback);
+}
+
+std::vector<asiopal::ThreadStatistics> DNP3Manager::GetThreadStatistics() const
+{
+	return impl->GetThreadStatistics();
+}
+
 std::shared_ptr<IChannel> DNP3Manager::AddTCPClient(
     const std::string& id,
     uint32_t levels,
@@ -76,6 +86,17 @@ std::shared_ptr<IChannel> DNP3Manager::AddSerial(
 	return this->impl->AddSerial(id, levels, retry, settings, listener);
 }
 
+std::shared_ptr<IChannel> DNP3Manager::AddUDPChannel(
+    const std::string& id,
+    uint32_t levels,
+    const asiopal::ChannelRetry& retry,
+    const asiopal::IPEndpoint& local,
+    const asiopal::IPEndpoint& remote,
+    std::shared_ptr<IChannelListener> listener)
+{
+	return this->impl->AddUDPChannel(id, levels, retry, local, remote, listener);
+}
+
 std::shared_ptr<IChannel> DNP3Manager::AddTLSClient(
     const std::string& id,
     uint32_t levels,
@@ -114,6 +135,18 @@ std::shared_ptr<asiopal::IListener> DNP3Manager::CreateListener(
 	return impl->CreateListener(loggerid, loglevel, endpoint, callbacks, ec);
 }
 
+std::shared_ptr<asiopal::IListener> DNP3Manager::CreateListener(
+    std::string loggerid,
+    openpal::LogFilters loglevel,
+    asiopal::IPEndpoint endpoint,
+    const ListenConfig& config,
+    std::shared_ptr<IListenCallbacks> callbacks,
+    std::error_code& ec
+)
+{
+	return impl->CreateListener(loggerid, loglevel, endpoint, config, callbacks, ec);
+}
+
 std::shared_ptr<asiopal::IListener> DNP3Manager::CreateListener(
     std::string loggerid,
     openpal::LogFilters loglevel,
@@ -22,6 +22,7 @@
 #include "DNP3ManagerImpl.h"
 
 #include <opendnp3/LogLevels.h>
+#include <openpal/logging/LogMacros.h>
 
 #ifdef OPENDNP3_USE_TLS
 #include "asiodnp3/tls/MasterTLSServer.h"
@@ -32,9 +33,11 @@
 #include "asiodnp3/ErrorCodes.h"
 #include "asiodnp3/DNP3Channel.h"
 #include "asiodnp3/MasterTCPServer.h"
+#include "asiodnp3/ShardedListener.h"
 #include "asiodnp3/TCPClientIOHandler.h"
 #include "asiodnp3/TCPServerIOHandler.h"
 #include "asiodnp3/SerialIOHandler.h"
+#include "asiodnp3/UDPIOHandler.h"
 
 using namespace openpal;
 using namespace asiopal;
@@ -60,6 +63,29 @@ DNP3ManagerImpl::~DNP3ManagerImpl()
 	this->Shutdown();
 }
 
+void DNP3ManagerImpl::SetHandlerWatchdog(openpal::TimeDuration budget, asiopal::stall_callback_t callback)
+{
+	if (!callback)
+	{
+		auto shared = std::make_shared<openpal::Logger>(this->logger);
+		callback = [shared](const HandlerStall & stall)
+		{
+			auto& logger = *shared;
+			FORMAT_LOG_BLOCK(logger, flags::WARN, "Handler on executor '%s' (stack '%s') ran for %lld us",
+			                 stall.executorId.c_str(),
+			                 stall.stackId.c_str(),
+			                 static_cast<long long>(stall.duration.count()));
+		};
+	}
+
+	this->io->watchdog.Configure(std::chrono::milliseconds(budget.GetMilliseconds()), callback);
+}
+
+std::vector<asiopal::ThreadStatistics> DNP3ManagerImpl::GetThreadStatistics() const
+{
+	return this->threadpool.GetThreadStatistics();
+}
+
 void DNP3ManagerImpl::Shutdown()
 {
 	if (resources)
@@ -81,7 +107,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTCPClient(
 	auto create = [&]() -> std::shared_ptr<IChannel>
 	{
 		auto clogger = this->logger.Detach(id, levels);
-		auto executor = Executor::Create(this->io);
+		auto executor = Executor::Create(this->io, id);
 		auto iohandler = TCPClientIOHandler::Create(clogger, listener, executor, retry, IPEndpoint(host, port), local);
 		return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
 	};
@@ -101,7 +127,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTCPServer(
 	{
 		std::error_code ec;
 		auto clogger = this->logger.Detach(id, levels);
-		auto executor = Executor::Create(this->io);
+		auto executor = Executor::Create(this->io, id);
 		auto iohandler = TCPServerIOHandler::Create(clogger, listener, executor, IPEndpoint(endpoint, port), ec);
 		return ec ? nullptr : DNP3Channel::Create(clogger, executor, iohandler, this->resources);
 	};
@@ -119,7 +145,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddSerial(
 	auto create = [&]() -> std::shared_ptr<IChannel>
 	{
 		auto clogger = this->logger.Detach(id, levels);
-		auto executor = Executor::Create(this->io);
+		auto executor = Executor::Create(this->io, id);
 		auto iohandler = SerialIOHandler::Create(clogger, listener, executor, retry, settings);
 		return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
 	};
@@ -127,6 +153,25 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddSerial(
 	return this->resources->Bind<IChannel>(create);
 }
 
+std::shared_ptr<IChannel> DNP3ManagerImpl::AddUDPChannel(
+    const std::string& id,
+    uint32_t levels,
+    const ChannelRetry& retry,
+    const IPEndpoint& local,
+    const IPEndpoint& remote,
+    std::shared_ptr<IChannelListener> listener)
+{
+	auto create = [&]() -> std::shared_ptr<IChannel>
+	{
+		auto clogger = this->logger.Detach(id, levels);
+		auto executor = Executor::Create(this->io, id);
+		auto iohandler = UDPIOHandler::Create(clogger, listener, executor, retry, local, remote);
+		return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
+	};
+
+	return this->resources->Bind<IChannel>(create);
+}
+
 std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSClient(
     const std::string& id,
     uint32_t levels,
@@ -143,7 +188,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSClient(
 	auto create = [&]() -> std::shared_ptr<IChannel>
 	{
 		auto clogger = this->logger.Detach(id, levels);
-		auto executor = Executor::Create(this->io);
+		auto executor = Executor::Create(this->io, id);
 		auto iohandler = TLSClientIOHandler::Create(clogger, listener, executor, config, retry, IPEndpoint(host, port), local);
 		return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
 	};
@@ -179,7 +224,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSServer(
 	{
 		std::error_code ec;
 		auto clogger = this->logger.Detach(id, levels);
-		auto executor = Executor::Create(this->io);
+		auto executor = Executor::Create(this->io, id);
 		auto iohandler = TLSServerIOHandler::Create(clogger, listener, executor, IPEndpoint(endpoint, port), config, ec);
 		return ec ? nullptr : DNP3Channel::Create(clogger, executor, iohandler, this->resources);
 	};
@@ -211,7 +256,7 @@ std::shared_ptr<asiopal::IListener> DNP3ManagerImpl::CreateListener(
 	{
 		return asiodnp3::MasterTCPServer::Create(
 		    this->logger.Detach(loggerid, levels),
-		    asiopal::Executor::Create(this->io),
+		    asiopal::Executor::Create(this->io, loggerid),
 		    endpoint,
 		    callbacks,
 		    this->resources,
@@ -229,6 +274,62 @@ std::shared_ptr<asiopal::IListener> DNP3ManagerImpl::CreateListener(
 	return listener;
 }
 
+std::shared_ptr<asiopal::IListener> DNP3ManagerImpl::CreateListener(
+    std::string loggerid,
+    openpal::LogFilters levels,
+    asiopal::IPEndpoint endpoint,
+    const ListenConfig& config,
+    const std::shared_ptr<IListenCallbacks>& callbacks,
+    std::error_code& ec)
+{
+	const uint16_t count = (config.numAcceptors > 1) ? config.numAcceptors : 1;
+
+	std::vector<std::shared_ptr<asiopal::IListener>> shards;
+
+	for (uint16_t i = 0; i < count; ++i)
+	{
+		const auto shardid = (count > 1) ? (loggerid + "-" + std::to_string(i)) : loggerid;
+
+		auto create = [&]() -> std::shared_ptr<asiopal::IListener>
+		{
+			auto server = asiodnp3::MasterTCPServer::Create(
+			                  this->logger.Detach(shardid, levels),
+			                  asiopal::Executor::Create(this->io, shardid),
+			                  endpoint,
+			                  callbacks,
+			                  this->resources,
+			                  config,
+			                  i,
+			                  ec
+			              );
+
+			return ec ? nullptr : server;
+		};
+
+		auto shard = this->resources->Bind<asiopal::IListener>(create);
+
+		if (!shard)
+		{
+			if (!ec)
+			{
+				ec = Error::SHUTTING_DOWN;
+			}
+
+			// stop the acceptors that were already started
+			for (auto& started : shards)
+			{
+				started->Shutdown();
+			}
+
+			return nullptr;
+		}
+
+		shards.push_back(shard);
+	}
+
+	return (count == 1) ? shards.front() : std::make_shared<ShardedListener>(std::move(shards));
+}
+
 std::shared_ptr<asiopal::IListener> DNP3ManagerImpl::CreateListener(
     std::string loggerid,
     openpal::LogFilters levels,
@@ -244,7 +345,7 @@ std::shared_ptr<asiopal::IListener> DNP3ManagerImpl::CreateListener(
 	{
 		return asiodnp3::MasterTLSServer::Create(
 		    this->logger.Detach(loggerid, levels),
-		    asiopal::Executor::Create(this->io),
+		    asiopal::Executor::Create(this->io, loggerid),
 		    endpoint,
 		    config,
 		    callbacks,
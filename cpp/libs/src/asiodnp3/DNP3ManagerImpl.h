@@ -38,6 +38,7 @@
 #include "asiodnp3/IChannel.h"
 #include "asiodnp3/IChannelListener.h"
 #include "asiodnp3/IListenCallbacks.h"
+#include "asiodnp3/ListenConfig.h"
 
 
 namespace asiodnp3
@@ -59,6 +60,10 @@ public:
 
 	void Shutdown();
 
+	void SetHandlerWatchdog(openpal::TimeDuration budget, asiopal::stall_callback_t callback);
+
+	std::vector<asiopal::ThreadStatistics> GetThreadStatistics() const;
+
 	std::shared_ptr<IChannel> AddTCPClient(
 	    const std::string& id,
 	    uint32_t levels,
@@ -83,6 +88,14 @@ public:
 	    asiopal::SerialSettings settings,
 	    std::shared_ptr<IChannelListener> listener);
 
+	std::shared_ptr<IChannel> AddUDPChannel(
+	    const std::string& id,
+	    uint32_t levels,
+	    const asiopal::ChannelRetry& retry,
+	    const asiopal::IPEndpoint& local,
+	    const asiopal::IPEndpoint& remote,
+	    std::shared_ptr<IChannelListener> listener);
+
 	std::shared_ptr<IChannel> AddTLSClient(
 	    const std::string& id,
 	    uint32_t levels,
@@ -112,6 +125,15 @@ public:
 	    std::error_code& ec
 	);
 
+	std::shared_ptr<asiopal::IListener> CreateListener(
+	    std::string loggerid,
+	    openpal::LogFilters loglevel,
+	    asiopal::IPEndpoint endpoint,
+	    const ListenConfig& config,
+	    const std::shared_ptr<IListenCallbacks>& callbacks,
+	    std::error_code& ec
+	);
+
 	std::shared_ptr<asiopal::IListener> CreateListener(
 	    std::string loggerid,
 	    openpal::LogFilters loglevel,
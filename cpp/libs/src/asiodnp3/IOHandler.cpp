@@ -243,6 +243,11 @@ void IOHandler::OnNewChannel(const std::shared_ptr<asiopal::IAsyncChannel>& chan
 
 bool IOHandler::OnFrame(const LinkHeaderFields& header, const openpal::RSlice& userdata)
 {
+	if (IsBroadcastAddress(header.dest))
+	{
+		return this->SendToAllSessions(header.src, header, userdata);
+	}
+
 	if (this->SendToSession(Route(header.src, header.dest), header, userdata))
 	{
 		return true;
@@ -264,6 +269,10 @@ void IOHandler::CheckForSend()
 	if (this->txQueue.empty() || !this->channel || !this->channel->CanWrite()) return;
 
 	++statistics.numLinkFrameTx;
+
+	const auto waited = asiopal::steady_clock_t::now() - this->txQueue.front().enqueued;
+	this->txQueueLatency.Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(waited).count()));
+
 	this->channel->BeginWrite(this->txQueue.front().txdata);
 }
 
@@ -286,6 +295,26 @@ bool IOHandler::SendToSession(const opendnp3::Route& route, const opendnp3::Link
 	}
 }
 
+bool IOHandler::SendToAllSessions(uint16_t source, const opendnp3::LinkHeaderFields& header, const openpal::RSlice& userdata)
+{
+	bool accepted = false;
+
+	for (auto& session : this->sessions)
+	{
+		if (session.enabled && session.IsRemote(source))
+		{
+			accepted |= session.OnFrame(header, userdata);
+		}
+	}
+
+	if (!accepted)
+	{
+		FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Broadcast w/ unknown source: %i", source);
+	}
+
+	return accepted;
+}
+
 bool IOHandler::IsRouteInUse(const Route& route) const
 {
 	auto matches = [route](const Session & record)
@@ -340,8 +369,18 @@ void IOHandler::Reset()
 	// reset the state of the parser
 	this->parser.Reset();
 
-	// clear any pending tranmissions
+	// clear any pending tranmissions. Senders that aren't bound to a route (broadcasts)
+	// never see LowerLayerDown, so they are told the transmission failed instead
+	auto pending = std::move(this->txQueue);
 	this->txQueue.clear();
+
+	for (auto& tx : pending)
+	{
+		if (!this->IsSessionInUse(tx.session))
+		{
+			tx.session->OnTransmitResult(false);
+		}
+	}
 }
 
 }
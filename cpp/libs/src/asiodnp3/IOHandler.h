@@ -24,6 +24,7 @@
 #include "opendnp3/Route.h"
 #include "opendnp3/link/ILinkTx.h"
 #include "opendnp3/link/LinkLayerParser.h"
+#include "opendnp3/link/LinkLayerConstants.h"
 #include "opendnp3/master/MultidropTaskLock.h"
 
 #include "asiodnp3/IChannelListener.h"
@@ -31,6 +32,7 @@
 #include "openpal/logging/Logger.h"
 
 #include "asiopal/IAsyncChannel.h"
+#include "asiopal/SteadyClock.h"
 
 #include <vector>
 #include <deque>
@@ -57,7 +59,9 @@ public:
 
 	opendnp3::LinkStatistics Statistics() const
 	{
-		return opendnp3::LinkStatistics(this->statistics, this->parser.Statistics());
+		auto channel = this->statistics;
+		channel.txQueueLatency = this->txQueueLatency.Summarize();
+		return opendnp3::LinkStatistics(channel, this->parser.Statistics());
 	}
 
 	opendnp3::ITaskLock& TaskLock()
@@ -65,6 +69,11 @@ public:
 		return this->taskLock;
 	}
 
+	void ConfigureTaskLock(const opendnp3::MultidropSchedulerConfig& config)
+	{
+		this->taskLock.Configure(config);
+	}
+
 	void Shutdown();
 
 	/// --- implement ILinkTx ---
@@ -86,6 +95,12 @@ public:
 	// Query to see if a route is in use
 	bool IsRouteInUse(const opendnp3::Route& route) const;
 
+	// True if a channel is open and frames can be transmitted
+	bool IsOnline() const
+	{
+		return static_cast<bool>(this->channel);
+	}
+
 protected:
 
 	// ------ Implement IChannelCallbacks -----
@@ -114,6 +129,7 @@ protected:
 	openpal::Logger logger;
 	const std::shared_ptr<IChannelListener> listener;
 	opendnp3::LinkStatistics::Channel statistics;
+	openpal::Histogram txQueueLatency;
 
 private:
 
@@ -136,6 +152,9 @@ private:
 
 	bool SendToSession(const opendnp3::Route& route, const opendnp3::LinkHeaderFields& header, const openpal::RSlice& userdata);
 
+	// deliver a broadcast frame to every session whose remote device is the source
+	bool SendToAllSessions(uint16_t source, const opendnp3::LinkHeaderFields& header, const openpal::RSlice& userdata);
+
 	class Session
 	{
 
@@ -156,6 +175,10 @@ private:
 		{
 			return this->route.Equals(route);
 		}
+		inline bool IsRemote(uint16_t address) const
+		{
+			return this->route.destination == address;
+		}
 
 		inline bool OnFrame(const opendnp3::LinkHeaderFields& header, const openpal::RSlice& userdata)
 		{
@@ -201,13 +224,15 @@ private:
 	{
 		Transmission(const openpal::RSlice& txdata, const std::shared_ptr<opendnp3::ILinkSession>& session) :
 			txdata(txdata),
-			session(session)
+			session(session),
+			enqueued(asiopal::steady_clock_t::now())
 		{}
 
 		Transmission() = default;
 
 		openpal::RSlice txdata;
 		std::shared_ptr<opendnp3::ILinkSession> session;
+		asiopal::steady_clock_t::time_point enqueued;
 	};
 
 	std::vector<Session> sessions;
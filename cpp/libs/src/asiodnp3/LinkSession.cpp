@@ -37,12 +37,14 @@ LinkSession::LinkSession(
     uint64_t sessionid,
     const std::shared_ptr<IResourceManager>& manager,
     const std::shared_ptr<IListenCallbacks>& callbacks,
-    const std::shared_ptr<asiopal::IAsyncChannel>& channel) :
+    const std::shared_ptr<asiopal::IAsyncChannel>& channel,
+    const std::shared_ptr<std::atomic<uint32_t>>& pending) :
 	logger(logger),
 	session_id(sessionid),
 	manager(manager),
 	callbacks(callbacks),
 	channel(channel),
+	pending(pending),
 	parser(logger),
 	first_frame_timer(*channel->executor)
 {
@@ -65,6 +67,8 @@ void LinkSession::ShutdownImpl()
 
 	this->is_shutdown = true;
 
+	this->ReleasePending();
+
 	this->callbacks->OnConnectionClose(this->session_id, this->stack);
 
 	if (this->stack)
@@ -84,6 +88,15 @@ void LinkSession::ShutdownImpl()
 	this->channel->executor->strand.post(detach);
 }
 
+void LinkSession::ReleasePending()
+{
+	if (this->pending)
+	{
+		this->pending->fetch_sub(1, std::memory_order_relaxed);
+		this->pending.reset();
+	}
+}
+
 void LinkSession::SetLogFilters(openpal::LogFilters filters)
 {
 	this->logger.SetFilters(filters);
@@ -131,6 +144,8 @@ bool LinkSession::OnFrame(const LinkHeaderFields& header, const openpal::RSlice&
 	{
 		this->first_frame_timer.Cancel();
 
+		this->ReleasePending();
+
 		this->callbacks->OnFirstFrame(this->session_id, header, *this);
 
 		if (this->stack)
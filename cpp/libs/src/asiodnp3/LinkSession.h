@@ -37,6 +37,8 @@
 #include "asiodnp3/MasterSessionStack.h"
 #include "asiodnp3/IListenCallbacks.h"
 
+#include <atomic>
+
 namespace asiodnp3
 {
 class LinkSession final :
@@ -55,9 +57,10 @@ public:
 	    uint64_t sessionid,
 	    const std::shared_ptr<asiopal::IResourceManager>& manager,
 	    const std::shared_ptr<IListenCallbacks>& callbacks,
-	    const std::shared_ptr<asiopal::IAsyncChannel>& channel)
+	    const std::shared_ptr<asiopal::IAsyncChannel>& channel,
+	    const std::shared_ptr<std::atomic<uint32_t>>& pending = nullptr)
 	{
-		auto session = std::make_shared<LinkSession>(logger, sessionid, manager, callbacks, channel);
+		auto session = std::make_shared<LinkSession>(logger, sessionid, manager, callbacks, channel, pending);
 
 		session->Start();
 
@@ -69,7 +72,8 @@ public:
 	    uint64_t sessionid,
 	    const std::shared_ptr<asiopal::IResourceManager>& manager,
 	    const std::shared_ptr<IListenCallbacks>& callbacks,
-	    const std::shared_ptr<asiopal::IAsyncChannel>& channel
+	    const std::shared_ptr<asiopal::IAsyncChannel>& channel,
+	    const std::shared_ptr<std::atomic<uint32_t>>& pending
 	);
 
 	// override IResource
@@ -81,6 +85,8 @@ private:
 
 	void ShutdownImpl();
 
+	void ReleasePending();
+
 	// IChannelCallbacks
 	virtual void OnReadComplete(const std::error_code& ec, size_t num) override;
 
@@ -111,6 +117,9 @@ private:
 	const std::shared_ptr<IListenCallbacks> callbacks;
 	const std::shared_ptr<asiopal::IAsyncChannel> channel;
 
+	// optional count of the listener's sessions waiting for a first frame, decremented once
+	std::shared_ptr<std::atomic<uint32_t>> pending;
+
 	opendnp3::LinkLayerParser parser;
 	openpal::TimerRef first_frame_timer;
 	opendnp3::Route route;
@@ -53,7 +53,7 @@ MasterSessionStack::MasterSessionStack(
 ) :
 	executor(executor),
 	session(session),
-	stack(logger, executor, application, config.master.maxRxFragSize, config.link),
+	stack(logger, executor, application, config.master.maxRxFragSize, config.link, config.master.bufferPool),
 	context(logger, executor, stack.transport, SOEHandler, application, config.master, NullTaskLock::Instance())
 {
 	stack.link->SetRouter(linktx);
@@ -75,6 +75,7 @@ void MasterSessionStack::OnLowerLayerDown()
 
 bool MasterSessionStack::OnFrame(const LinkHeaderFields& header, const openpal::RSlice& userdata)
 {
+	asiopal::ExecutorMetrics::LabelStack(context.logger.GetId());
 	return stack.link->OnFrame(header, userdata);
 }
 
@@ -93,6 +94,21 @@ void MasterSessionStack::SetLogFilters(const openpal::LogFilters& filters)
 	this->executor->strand.post(set);
 }
 
+std::shared_ptr<const MeasurementCache> MasterSessionStack::GetMeasurementCache()
+{
+	// the pointer never changes after construction, so there's no need to synchronize
+	return this->context.cache;
+}
+
+MasterLatencies MasterSessionStack::GetLatencies()
+{
+	auto get = [self = shared_from_this()]()
+	{
+		return self->context.latencies ? *self->context.latencies : MasterLatencies();
+	};
+	return executor->ReturnFrom<MasterLatencies>(get);
+}
+
 void MasterSessionStack::Demand(const std::shared_ptr<opendnp3::IMasterTask>& task)
 {
 	auto action = [task, self = shared_from_this()]
@@ -117,11 +133,25 @@ StackStatistics MasterSessionStack::GetStackStatistics()
 {
 	auto get = [self = shared_from_this()]() -> StackStatistics
 	{
-		return self->CreateStatistics();
+		auto statistics = self->CreateStatistics();
+		statistics.master = self->context.GetStatistics();
+		return statistics;
 	};
 	return executor->ReturnFrom<StackStatistics>(get);
 }
 
+MemoryUsage MasterSessionStack::GetMemoryUsage()
+{
+	auto get = [self = shared_from_this()]() -> MemoryUsage
+	{
+		MemoryUsage usage;
+		usage.fixedBytes = sizeof(MasterSessionStack) + sizeof(LinkSession) + sizeof(TransportLayer) + sizeof(LinkLayer);
+		usage.bufferBytes = self->stack.transport->AttachedBytes() + self->context.txBuffer.AttachedBytes();
+		return usage;
+	};
+	return executor->ReturnFrom<MemoryUsage>(get);
+}
+
 std::shared_ptr<IMasterScan> MasterSessionStack::AddScan(openpal::TimeDuration period, const std::vector<Header>& headers, const TaskConfig& config)
 {
 	auto builder = ConvertToLambda(headers);
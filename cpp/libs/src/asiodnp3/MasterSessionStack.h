@@ -65,6 +65,10 @@ public:
 
 	virtual void SetLogFilters(const openpal::LogFilters& filters) override;
 
+	virtual std::shared_ptr<const opendnp3::MeasurementCache> GetMeasurementCache() override;
+
+	virtual opendnp3::MasterLatencies GetLatencies() override;
+
 	virtual void Demand(const std::shared_ptr<opendnp3::IMasterTask>& task) override;
 
 	/// --- IGPRSMaster ---
@@ -74,6 +78,8 @@ public:
 	/// --- ICommandOperations ---
 
 	virtual opendnp3::StackStatistics GetStackStatistics() override;
+
+	virtual MemoryUsage GetMemoryUsage() override;
 	virtual std::shared_ptr<IMasterScan> AddScan(openpal::TimeDuration period, const std::vector<opendnp3::Header>& headers, const opendnp3::TaskConfig& config) override;
 	virtual std::shared_ptr<IMasterScan> AddAllObjectsScan(opendnp3::GroupVariationID gvId, openpal::TimeDuration period, const opendnp3::TaskConfig& config) override;
 	virtual std::shared_ptr<IMasterScan> AddClassScan(const opendnp3::ClassField& field, openpal::TimeDuration period, const opendnp3::TaskConfig& config) override;
@@ -43,7 +43,7 @@ MasterStack::MasterStack(
     const MasterStackConfig& config,
     ITaskLock& taskLock) :
 
-	StackBase(logger, executor, application, iohandler, manager, config.master.maxRxFragSize, config.link),
+	StackBase(logger, executor, application, iohandler, manager, config.master.maxRxFragSize, config.link, config.master.bufferPool),
 	mcontext(logger, executor, tstack.transport, SOEHandler, application,  config.master, taskLock)
 {
 	tstack.transport->SetAppLayer(mcontext);
@@ -70,7 +70,9 @@ StackStatistics MasterStack::GetStackStatistics()
 {
 	auto get = [self = shared_from_this()]() -> StackStatistics
 	{
-		return self->CreateStatistics();
+		auto statistics = self->CreateStatistics();
+		statistics.master = self->mcontext.GetStatistics();
+		return statistics;
 	};
 	return this->executor->ReturnFrom<StackStatistics>(get);
 }
@@ -95,6 +97,21 @@ void MasterStack::SetLogFilters(const openpal::LogFilters& filters)
 	this->executor->strand.post(set);
 }
 
+std::shared_ptr<const MeasurementCache> MasterStack::GetMeasurementCache()
+{
+	// the pointer never changes after construction, so there's no need to synchronize
+	return this->mcontext.cache;
+}
+
+MasterLatencies MasterStack::GetLatencies()
+{
+	auto get = [self = shared_from_this()]()
+	{
+		return self->mcontext.latencies ? *self->mcontext.latencies : MasterLatencies();
+	};
+	return this->executor->ReturnFrom<MasterLatencies>(get);
+}
+
 std::shared_ptr<IMasterScan> MasterStack::AddScan(openpal::TimeDuration period, const std::vector<Header>& headers, const TaskConfig& config)
 {
 	auto builder = ConvertToLambda(headers);
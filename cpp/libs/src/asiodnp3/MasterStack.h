@@ -96,6 +96,7 @@ public:
 
 	virtual bool OnFrame(const opendnp3::LinkHeaderFields& header, const openpal::RSlice& userdata)
 	{
+		asiopal::ExecutorMetrics::LabelStack(this->logger.GetId());
 		return this->tstack.link->OnFrame(header, userdata);
 	}
 
@@ -108,6 +109,10 @@ public:
 
 	virtual void SetLogFilters(const openpal::LogFilters& filters) override;
 
+	virtual std::shared_ptr<const opendnp3::MeasurementCache> GetMeasurementCache() override;
+
+	virtual opendnp3::MasterLatencies GetLatencies() override;
+
 	virtual std::shared_ptr<IMasterScan> AddScan(openpal::TimeDuration period, const std::vector<opendnp3::Header>& headers, const opendnp3::TaskConfig& config) override;
 
 	virtual std::shared_ptr<IMasterScan> AddAllObjectsScan(opendnp3::GroupVariationID gvId, openpal::TimeDuration period, const opendnp3::TaskConfig& config) override;
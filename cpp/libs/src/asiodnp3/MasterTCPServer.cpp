@@ -45,9 +45,29 @@ MasterTCPServer::MasterTCPServer(
     const std::shared_ptr<asiopal::ResourceManager>& manager,
     std::error_code& ec
 ) :
-	TCPServer(logger, executor, endpoint, ec),
+	MasterTCPServer(logger, executor, endpoint, callbacks, manager, ListenConfig(), 0, ec)
+{
+
+}
+
+MasterTCPServer::MasterTCPServer(
+    const openpal::Logger& logger,
+    const std::shared_ptr<asiopal::Executor>& executor,
+    const asiopal::IPEndpoint& endpoint,
+    const std::shared_ptr<IListenCallbacks>& callbacks,
+    const std::shared_ptr<asiopal::ResourceManager>& manager,
+    const ListenConfig& config,
+    uint16_t shard,
+    std::error_code& ec
+) :
+	TCPServer(logger, executor, endpoint, config.numAcceptors > 1, ec),
 	callbacks(callbacks),
-	manager(manager)
+	manager(manager),
+	numShards(config.numAcceptors > 1 ? config.numAcceptors : 1),
+	shard(shard),
+	maxPendingFirstFrame(config.maxPendingFirstFrame),
+	admission(GetShardRate(config), GetShardRate(config)),
+	pendingFirstFrame(std::make_shared<std::atomic<uint32_t>>(0))
 {
 
 }
@@ -57,40 +77,88 @@ void MasterTCPServer::OnShutdown()
 	this->manager->Detach(this->shared_from_this());
 }
 
+bool MasterTCPServer::Admit(const std::shared_ptr<asiopal::Executor>& executor)
+{
+	if (!this->admission.TryConsume(executor->GetTime()))
+	{
+		SIMPLE_LOG_BLOCK(this->logger, flags::DBG, "Admission rate exceeded");
+		return false;
+	}
+
+	if (this->maxPendingFirstFrame && (this->pendingFirstFrame->load(std::memory_order_relaxed) >= this->maxPendingFirstFrame))
+	{
+		SIMPLE_LOG_BLOCK(this->logger, flags::DBG, "Too many sessions waiting for a first frame");
+		return false;
+	}
+
+	return true;
+}
+
 void MasterTCPServer::AcceptConnection(uint64_t sessionid, const std::shared_ptr<asiopal::Executor>& executor, asio::ip::tcp::socket socket)
 {
-	std::ostringstream oss;
-	oss << socket.remote_endpoint();
+	// interleave the ids so that they're unique across the acceptors sharing the port
+	const auto id = (sessionid * this->numShards) + this->shard;
 
-	if (this->callbacks->AcceptConnection(sessionid, socket.remote_endpoint().address().to_string()))
+	// shed load before doing any per-connection work
+	if (!this->Admit(executor))
 	{
-		FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Accepted connection from: %s", oss.str().c_str());
+		std::error_code ec;
+		socket.close(ec);
+		return;
+	}
+
+	std::error_code ec;
+	const auto address = socket.remote_endpoint(ec).address().to_string();
+
+	if (ec)
+	{
+		// the peer disconnected before we could process the connection
+		SIMPLE_LOG_BLOCK(this->logger, flags::DBG, ec.message().c_str());
+		socket.close(ec);
+		return;
+	}
+
+	if (this->callbacks->AcceptConnection(id, address))
+	{
+		FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Accepted connection from: %s", address.c_str());
 
 		auto channel = SocketChannel::Create(executor->Fork(), std::move(socket));	// run the link session in its own strand
 
+		this->pendingFirstFrame->fetch_add(1, std::memory_order_relaxed);
+
 		auto create = [&]() -> std::shared_ptr<LinkSession>
 		{
 			return LinkSession::Create(
-			    this->logger.Detach(SessionIdToString(sessionid)),
-			    sessionid,
+			    this->logger.Detach(SessionIdToString(id)),
+			    id,
 			    this->manager,
 			    this->callbacks,
-			    channel
+			    channel,
+			    this->pendingFirstFrame
 			);
 		};
 
 		if (!this->manager->Bind<LinkSession>(create))
 		{
+			this->pendingFirstFrame->fetch_sub(1, std::memory_order_relaxed);
 			channel->Shutdown();
 		}
 	}
 	else
 	{
-		socket.close();
-		FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Rejected connection from: %s", oss.str().c_str());
+		socket.close(ec);
+		FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Rejected connection from: %s", address.c_str());
 	}
 }
 
+uint32_t MasterTCPServer::GetShardRate(const ListenConfig& config)
+{
+	const uint32_t shards = config.numAcceptors > 1 ? config.numAcceptors : 1;
+
+	// round up so that a non-zero rate never becomes unlimited
+	return (config.maxAcceptRate + shards - 1) / shards;
+}
+
 std::string MasterTCPServer::SessionIdToString(uint64_t sessionid)
 {
 	std::ostringstream oss;
@@ -20,6 +20,8 @@
  */
 #include "OutstationStack.h"
 
+#include <thread>
+
 using namespace openpal;
 using namespace asiopal;
 using namespace opendnp3;
@@ -46,10 +48,41 @@ OutstationStack::OutstationStack(
     const OutstationStackConfig& config) :
 
 	StackBase(logger, executor, application, iohandler, manager, config.outstation.params.maxRxFragSize, config.link),
-	ocontext(config.outstation, config.dbConfig.sizes, logger, executor, tstack.transport, commandHandler, application)
+	ocontext(config.outstation, config.dbConfig.sizes, logger, executor, tstack.transport, commandHandler, application),
+	ingestion(config.ingestion),
+	isDrainScheduled(false),
+	numIngestionOverflows(0)
+{
+	this->Configure(config);
+}
+
+OutstationStack::OutstationStack(
+    const Logger& logger,
+    const std::shared_ptr<Executor>& executor,
+    const std::shared_ptr<IAsyncCommandHandler>& commandHandler,
+    const std::shared_ptr<IOutstationApplication>& application,
+    const std::shared_ptr<IOHandler>& iohandler,
+    const std::shared_ptr<IResourceManager>& manager,
+    const OutstationStackConfig& config) :
+
+	StackBase(logger, executor, application, iohandler, manager, config.outstation.params.maxRxFragSize, config.link),
+	ocontext(config.outstation, config.dbConfig.sizes, logger, executor, tstack.transport, commandHandler, application),
+	ingestion(config.ingestion),
+	isDrainScheduled(false),
+	numIngestionOverflows(0)
+{
+	this->Configure(config);
+}
+
+void OutstationStack::Configure(const OutstationStackConfig& config)
 {
 	this->tstack.transport->SetAppLayer(ocontext);
 
+	if (config.ingestion.capacity > 0)
+	{
+		this->ring.reset(new asiopal::MPSCRing<UpdateRecord>(config.ingestion.capacity));
+	}
+
 	// apply the database configuration
 	auto view = ocontext.GetConfigView();
 
@@ -85,11 +118,25 @@ StackStatistics OutstationStack::GetStackStatistics()
 {
 	auto get = [self = shared_from_this()]
 	{
-		return self->CreateStatistics();
+		auto statistics = self->CreateStatistics();
+		statistics.outstation = self->ocontext.GetStatistics();
+		statistics.outstation.numIngestedUpdates = self->numIngestedUpdates;
+		statistics.outstation.numIngestionDrains = self->numIngestionDrains;
+		statistics.outstation.numIngestionOverflows = self->numIngestionOverflows;
+		return statistics;
 	};
 	return this->executor->ReturnFrom<StackStatistics>(get);
 }
 
+OutstationLatencies OutstationStack::GetLatencies()
+{
+	auto get = [self = shared_from_this()]
+	{
+		return self->ocontext.GetLatencies();
+	};
+	return this->executor->ReturnFrom<OutstationLatencies>(get);
+}
+
 void OutstationStack::SetLogFilters(const LogFilters& filters)
 {
 	auto set = [self = this->shared_from_this(), filters]()
@@ -122,5 +169,114 @@ void OutstationStack::Apply(const Updates& updates)
 	this->executor->strand.post(task);
 }
 
+bool OutstationStack::Enqueue(const Binary& meas, uint16_t index, EventMode mode)
+{
+	return this->EnqueueRecord(UpdateRecord(meas, index, mode));
+}
+
+bool OutstationStack::Enqueue(const DoubleBitBinary& meas, uint16_t index, EventMode mode)
+{
+	return this->EnqueueRecord(UpdateRecord(meas, index, mode));
+}
+
+bool OutstationStack::Enqueue(const Analog& meas, uint16_t index, EventMode mode)
+{
+	return this->EnqueueRecord(UpdateRecord(meas, index, mode));
+}
+
+bool OutstationStack::Enqueue(const Counter& meas, uint16_t index, EventMode mode)
+{
+	return this->EnqueueRecord(UpdateRecord(meas, index, mode));
+}
+
+bool OutstationStack::Enqueue(const FrozenCounter& meas, uint16_t index, EventMode mode)
+{
+	return this->EnqueueRecord(UpdateRecord(meas, index, mode));
+}
+
+bool OutstationStack::Enqueue(const BinaryOutputStatus& meas, uint16_t index, EventMode mode)
+{
+	return this->EnqueueRecord(UpdateRecord(meas, index, mode));
+}
+
+bool OutstationStack::Enqueue(const AnalogOutputStatus& meas, uint16_t index, EventMode mode)
+{
+	return this->EnqueueRecord(UpdateRecord(meas, index, mode));
+}
+
+bool OutstationStack::Enqueue(const TimeAndInterval& meas, uint16_t index)
+{
+	return this->EnqueueRecord(UpdateRecord(meas, index));
+}
+
+bool OutstationStack::EnqueueRecord(const UpdateRecord& record)
+{
+	if (!this->ring)
+	{
+		return false;
+	}
+
+	if (!this->ring->TryPush(record))
+	{
+		++this->numIngestionOverflows;
+
+		if (this->ingestion.overflowPolicy == IngestionOverflowPolicy::Drop)
+		{
+			return false;
+		}
+
+		do
+		{
+			std::this_thread::yield();
+		}
+		while (!this->ring->TryPush(record));
+	}
+
+	// only the first update since the last drain wakes up the strand
+	if (!this->isDrainScheduled.exchange(true))
+	{
+		this->ScheduleDrain();
+	}
+
+	return true;
+}
+
+void OutstationStack::ScheduleDrain()
+{
+	auto schedule = [self = this->shared_from_this()]()
+	{
+		if (self->ingestion.coalesceDelay.GetMilliseconds() > 0)
+		{
+			self->executor->Start(self->ingestion.coalesceDelay, [self]()
+			{
+				self->Drain();
+			});
+		}
+		else
+		{
+			self->Drain();
+		}
+	};
+
+	this->executor->strand.post(schedule);
 }
 
+void OutstationStack::Drain()
+{
+	// clear the flag before draining so that any update that misses this drain schedules another one
+	this->isDrainScheduled = false;
+
+	auto& handler = this->ocontext.GetUpdateHanlder();
+	auto apply = [&handler](const UpdateRecord & record)
+	{
+		record.Apply(handler);
+	};
+
+	// bound the work done on a single wakeup so that continuous producers can't starve the strand
+	this->numIngestedUpdates += this->ring->Drain(apply, this->ring->Capacity());
+	++this->numIngestionDrains;
+
+	this->ocontext.CheckForTaskStart();
+}
+
+}
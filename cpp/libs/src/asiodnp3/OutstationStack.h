@@ -29,6 +29,11 @@
 #include "asiodnp3/OutstationStackConfig.h"
 #include "asiodnp3/StackBase.h"
 #include "asiodnp3/IOHandler.h"
+#include "asiodnp3/UpdateRecord.h"
+
+#include "asiopal/MPSCRing.h"
+
+#include <atomic>
 
 namespace asiodnp3
 {
@@ -49,10 +54,20 @@ public:
 	    const std::shared_ptr<asiopal::IResourceManager>& manager,
 	    const OutstationStackConfig& config);
 
+	OutstationStack(
+	    const openpal::Logger& logger,
+	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const std::shared_ptr<opendnp3::IAsyncCommandHandler>& commandHandler,
+	    const std::shared_ptr<opendnp3::IOutstationApplication>& application,
+	    const std::shared_ptr<IOHandler>& iohandler,
+	    const std::shared_ptr<asiopal::IResourceManager>& manager,
+	    const OutstationStackConfig& config);
+
+	template <class CommandHandler>
 	static std::shared_ptr<OutstationStack> Create(
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<asiopal::Executor>& executor,
-	    const std::shared_ptr<opendnp3::ICommandHandler>& commandHandler,
+	    const std::shared_ptr<CommandHandler>& commandHandler,
 	    const std::shared_ptr<opendnp3::IOutstationApplication>& application,
 	    const std::shared_ptr<IOHandler>& iohandler,
 	    const std::shared_ptr<asiopal::IResourceManager>& manager,
@@ -95,6 +110,7 @@ public:
 
 	virtual bool OnFrame(const opendnp3::LinkHeaderFields& header, const openpal::RSlice& userdata)
 	{
+		asiopal::ExecutorMetrics::LabelStack(this->logger.GetId());
 		return this->tstack.link->OnFrame(header, userdata);
 	}
 
@@ -110,10 +126,38 @@ public:
 
 	virtual void SetRestartIIN() override;
 
+	virtual opendnp3::OutstationLatencies GetLatencies() override;
+
 	virtual void Apply(const Updates& updates) override;
 
+	virtual bool Enqueue(const opendnp3::Binary& meas, uint16_t index, opendnp3::EventMode mode) override;
+	virtual bool Enqueue(const opendnp3::DoubleBitBinary& meas, uint16_t index, opendnp3::EventMode mode) override;
+	virtual bool Enqueue(const opendnp3::Analog& meas, uint16_t index, opendnp3::EventMode mode) override;
+	virtual bool Enqueue(const opendnp3::Counter& meas, uint16_t index, opendnp3::EventMode mode) override;
+	virtual bool Enqueue(const opendnp3::FrozenCounter& meas, uint16_t index, opendnp3::EventMode mode) override;
+	virtual bool Enqueue(const opendnp3::BinaryOutputStatus& meas, uint16_t index, opendnp3::EventMode mode) override;
+	virtual bool Enqueue(const opendnp3::AnalogOutputStatus& meas, uint16_t index, opendnp3::EventMode mode) override;
+	virtual bool Enqueue(const opendnp3::TimeAndInterval& meas, uint16_t index) override;
+
 private:
 
+	void Configure(const OutstationStackConfig& config);
+
+	// --------- lock-free ingestion ---------
+
+	bool EnqueueRecord(const UpdateRecord& record);
+
+	void ScheduleDrain();
+
+	void Drain();
+
+	const IngestionConfig ingestion;
+	std::unique_ptr<asiopal::MPSCRing<UpdateRecord>> ring;
+	std::atomic<bool> isDrainScheduled;
+	std::atomic<uint32_t> numIngestionOverflows;
+	uint32_t numIngestedUpdates = 0;
+	uint32_t numIngestionDrains = 0;
+
 	opendnp3::OContext ocontext;
 };
 
@@ -45,12 +45,13 @@ protected:
 	    const std::shared_ptr<IOHandler>& iohandler,
 	    const std::shared_ptr<asiopal::IResourceManager>& manager,
 	    uint32_t maxRxFragSize,
-	    const opendnp3::LinkConfig& config) :
+	    const opendnp3::LinkConfig& config,
+	    const std::shared_ptr<opendnp3::BufferPool>& pool = nullptr) :
 		logger(logger),
 		executor(executor),
 		iohandler(iohandler),
 		manager(manager),
-		tstack(logger, executor, listener,  maxRxFragSize, config)
+		tstack(logger, executor, listener,  maxRxFragSize, config, pool)
 	{
 
 	}
@@ -0,0 +1,120 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#include "UDPIOHandler.h"
+
+#include "asiopal/UDPChannel.h"
+
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/LogLevels.h>
+
+using namespace asiopal;
+
+namespace asiodnp3
+{
+
+UDPIOHandler::UDPIOHandler(
+    const openpal::Logger& logger,
+    const std::shared_ptr<IChannelListener>& listener,
+    const std::shared_ptr<asiopal::Executor>& executor,
+    const asiopal::ChannelRetry& retry,
+    const asiopal::IPEndpoint& local,
+    const asiopal::IPEndpoint& remote
+) :
+	IOHandler(logger, listener),
+	executor(executor),
+	retry(retry),
+	local(local),
+	remote(remote),
+	retrytimer(*executor)
+{}
+
+void UDPIOHandler::ShutdownImpl()
+{
+	retrytimer.Cancel();
+}
+
+void UDPIOHandler::BeginChannelAccept()
+{
+	this->TryOpen(this->retry.minOpenRetry);
+}
+
+void UDPIOHandler::SuspendChannelAccept()
+{
+	retrytimer.Cancel();
+}
+
+void UDPIOHandler::OnChannelShutdown()
+{
+	// a datagram socket only fails on local errors, so don't spin re-binding it
+	auto cb = [self = shared_from_this(), this]()
+	{
+		this->BeginChannelAccept();
+	};
+
+	this->retrytimer.Start(this->retry.minOpenRetry, cb);
+}
+
+void UDPIOHandler::TryOpen(const openpal::TimeDuration& delay)
+{
+	std::error_code ec;
+	asio::ip::udp::socket socket(executor->strand.get_io_service());
+	asio::ip::udp::endpoint localEndpoint(asio::ip::address::from_string(this->local.address, ec), this->local.port);
+	asio::ip::udp::endpoint remoteEndpoint;
+
+	if (!ec && !this->remote.address.empty())
+	{
+		remoteEndpoint = asio::ip::udp::endpoint(asio::ip::address::from_string(this->remote.address, ec), this->remote.port);
+	}
+
+	if (!ec)
+	{
+		socket.open(localEndpoint.protocol(), ec);
+	}
+
+	if (!ec)
+	{
+		socket.bind(localEndpoint, ec);
+	}
+
+	if (ec)
+	{
+		FORMAT_LOG_BLOCK(this->logger, openpal::logflags::WARN, "Error binding UDP socket to %s:%u: %s", this->local.address.c_str(), this->local.port, ec.message().c_str());
+
+		++this->statistics.numOpenFail;
+
+		const auto newDelay = this->retry.NextDelay(delay);
+
+		auto cb = [self = shared_from_this(), newDelay, this]()
+		{
+			this->TryOpen(newDelay);
+		};
+
+		this->retrytimer.Start(delay, cb);
+		return;
+	}
+
+	FORMAT_LOG_BLOCK(this->logger, openpal::logflags::INFO, "Bound UDP socket to: %s:%u", this->local.address.c_str(), this->local.port);
+
+	this->OnNewChannel(UDPChannel::Create(this->logger, this->executor, std::move(socket), remoteEndpoint));
+}
+
+}
@@ -0,0 +1,107 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_UPDATERECORD_H
+#define ASIODNP3_UPDATERECORD_H
+
+#include "opendnp3/outstation/IUpdateHandler.h"
+
+namespace asiodnp3
+{
+
+/**
+* A fixed-size, trivially copyable measurement update that can be placed in the ingestion ring
+*/
+struct UpdateRecord
+{
+	enum class Type : uint8_t
+	{
+		Binary,
+		DoubleBitBinary,
+		Analog,
+		Counter,
+		FrozenCounter,
+		BinaryOutputStatus,
+		AnalogOutputStatus,
+		TimeAndInterval
+	};
+
+	UpdateRecord() : type(Type::Binary), mode(opendnp3::EventMode::Detect), index(0), binary() {}
+
+	UpdateRecord(const opendnp3::Binary& meas, uint16_t index, opendnp3::EventMode mode) : type(Type::Binary), mode(mode), index(index), binary(meas) {}
+	UpdateRecord(const opendnp3::DoubleBitBinary& meas, uint16_t index, opendnp3::EventMode mode) : type(Type::DoubleBitBinary), mode(mode), index(index), doubleBinary(meas) {}
+	UpdateRecord(const opendnp3::Analog& meas, uint16_t index, opendnp3::EventMode mode) : type(Type::Analog), mode(mode), index(index), analog(meas) {}
+	UpdateRecord(const opendnp3::Counter& meas, uint16_t index, opendnp3::EventMode mode) : type(Type::Counter), mode(mode), index(index), counter(meas) {}
+	UpdateRecord(const opendnp3::FrozenCounter& meas, uint16_t index, opendnp3::EventMode mode) : type(Type::FrozenCounter), mode(mode), index(index), frozenCounter(meas) {}
+	UpdateRecord(const opendnp3::BinaryOutputStatus& meas, uint16_t index, opendnp3::EventMode mode) : type(Type::BinaryOutputStatus), mode(mode), index(index), boStatus(meas) {}
+	UpdateRecord(const opendnp3::AnalogOutputStatus& meas, uint16_t index, opendnp3::EventMode mode) : type(Type::AnalogOutputStatus), mode(mode), index(index), aoStatus(meas) {}
+	UpdateRecord(const opendnp3::TimeAndInterval& meas, uint16_t index) : type(Type::TimeAndInterval), mode(opendnp3::EventMode::Detect), index(index), timeAndInterval(meas) {}
+
+	void Apply(opendnp3::IUpdateHandler& handler) const
+	{
+		switch (type)
+		{
+		case(Type::Binary) :
+			handler.Update(binary, index, mode);
+			break;
+		case(Type::DoubleBitBinary) :
+			handler.Update(doubleBinary, index, mode);
+			break;
+		case(Type::Analog) :
+			handler.Update(analog, index, mode);
+			break;
+		case(Type::Counter) :
+			handler.Update(counter, index, mode);
+			break;
+		case(Type::FrozenCounter) :
+			handler.Update(frozenCounter, index, mode);
+			break;
+		case(Type::BinaryOutputStatus) :
+			handler.Update(boStatus, index, mode);
+			break;
+		case(Type::AnalogOutputStatus) :
+			handler.Update(aoStatus, index, mode);
+			break;
+		case(Type::TimeAndInterval) :
+			handler.Update(timeAndInterval, index);
+			break;
+		}
+	}
+
+	Type type;
+	opendnp3::EventMode mode;
+	uint16_t index;
+
+	union
+	{
+		opendnp3::Binary binary;
+		opendnp3::DoubleBitBinary doubleBinary;
+		opendnp3::Analog analog;
+		opendnp3::Counter counter;
+		opendnp3::FrozenCounter frozenCounter;
+		opendnp3::BinaryOutputStatus boStatus;
+		opendnp3::AnalogOutputStatus aoStatus;
+		opendnp3::TimeAndInterval timeAndInterval;
+	};
+};
+
+}
+
+#endif
@@ -31,9 +31,16 @@ using namespace openpal;
 namespace asiopal
 {
 
-Executor::Executor(const std::shared_ptr<IO>& io) :
+Executor::Executor(const std::shared_ptr<IO>& io, const std::string& id) :
 	io(io),
+#ifdef OPENDNP3_EXECUTOR_METRICS
+	metrics(std::make_shared<ExecutorMetrics>(id, io->watchdog)),
+	id(id),
+	strand(io->service, metrics)
+#else
+	id(id),
 	strand(io->service)
+#endif
 {
 
 }
@@ -43,6 +50,11 @@ MonotonicTimestamp Executor::GetTime()
 	return TimeConversions::Convert(steady_clock_t::now());
 }
 
+int64_t Executor::GetMicroseconds()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(steady_clock_t::now().time_since_epoch()).count();
+}
+
 ITimer* Executor::Start(const TimeDuration& delay, const action_t& runnable)
 {
 	const auto now = steady_clock_t::now();
@@ -115,4 +127,17 @@ void Executor::BlockUntilAndFlush(const std::function<void()>& action)
 	this->BlockUntil([]() {});
 }
 
+ExecutorStatistics Executor::GetStatistics()
+{
+#ifdef OPENDNP3_EXECUTOR_METRICS
+	auto get = [this]()
+	{
+		return this->metrics->GetStatistics();
+	};
+	return this->ReturnFrom<ExecutorStatistics>(get);
+#else
+	return ExecutorStatistics();
+#endif
+}
+
 }
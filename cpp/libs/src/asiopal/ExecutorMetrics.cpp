@@ -0,0 +1,143 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/ExecutorMetrics.h"
+
+using namespace std::chrono;
+
+namespace asiopal
+{
+
+namespace
+{
+thread_local ThreadMetrics* currentThread = nullptr;
+thread_local const std::string* currentStack = nullptr;
+
+int64_t SteadyMicros()
+{
+	return duration_cast<microseconds>(steady_clock_t::now().time_since_epoch()).count();
+}
+}
+
+void HandlerWatchdog::Configure(std::chrono::microseconds budget, const stall_callback_t& callback)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->callback = callback;
+	this->budgetMicros.store(budget.count(), std::memory_order_relaxed);
+}
+
+void HandlerWatchdog::Report(const HandlerStall& stall)
+{
+	stall_callback_t copy;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		copy = this->callback;
+	}
+
+	if (copy)
+	{
+		copy(stall);
+	}
+}
+
+ThreadMetrics::ThreadMetrics() : startMicros(SteadyMicros()), busyMicros(0)
+{}
+
+void ThreadMetrics::Attach(ThreadMetrics* metrics)
+{
+	currentThread = metrics;
+}
+
+ThreadStatistics ThreadMetrics::GetStatistics() const
+{
+	ThreadStatistics statistics;
+	statistics.busyMicros = this->busyMicros.load(std::memory_order_relaxed);
+	statistics.elapsedMicros = static_cast<uint64_t>(SteadyMicros() - this->startMicros);
+	return statistics;
+}
+
+#ifdef OPENDNP3_EXECUTOR_METRICS
+
+ExecutorMetrics::ExecutorMetrics(const std::string& id, HandlerWatchdog& watchdog) :
+	id(id),
+	watchdog(&watchdog),
+	pending(0)
+{}
+
+int64_t ExecutorMetrics::Begin(int64_t postedMicros)
+{
+	const auto now = NowMicros();
+
+	if (postedMicros >= 0)
+	{
+		pending.fetch_sub(1, std::memory_order_relaxed);
+		queueDelay.Record(static_cast<uint64_t>(now - postedMicros));
+	}
+
+	currentStack = nullptr;
+	return now;
+}
+
+void ExecutorMetrics::End(int64_t startMicros)
+{
+	const auto elapsed = NowMicros() - startMicros;
+
+	handlerDuration.Record(static_cast<uint64_t>(elapsed));
+
+	if (currentThread)
+	{
+		// single writer, so a relaxed load/store is enough
+		currentThread->busyMicros.store(currentThread->busyMicros.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+	}
+
+	const auto budget = watchdog->BudgetMicros();
+	if (budget > 0 && elapsed > budget)
+	{
+		++numOverBudget;
+
+		HandlerStall stall;
+		stall.executorId = this->id;
+		stall.stackId = currentStack ? *currentStack : std::string();
+		stall.duration = microseconds(elapsed);
+		watchdog->Report(stall);
+	}
+
+	currentStack = nullptr;
+}
+
+ExecutorStatistics ExecutorMetrics::GetStatistics() const
+{
+	ExecutorStatistics statistics;
+	statistics.numPending = pending.load(std::memory_order_relaxed);
+	statistics.numHandlers = handlerDuration.Count();
+	statistics.numOverBudget = numOverBudget;
+	statistics.queueDelay = queueDelay.Summarize();
+	statistics.handlerDuration = handlerDuration.Summarize();
+	return statistics;
+}
+
+void ExecutorMetrics::LabelStack(const std::string& id)
+{
+	currentStack = &id;
+}
+
+#endif
+
+}
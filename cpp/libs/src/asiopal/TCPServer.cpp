@@ -37,6 +37,17 @@ TCPServer::TCPServer(
     const openpal::Logger& logger,
     const std::shared_ptr<Executor>& executor,
     const IPEndpoint& endpoint,
+    std::error_code& ec) :
+	TCPServer(logger, executor, endpoint, false, ec)
+{
+
+}
+
+TCPServer::TCPServer(
+    const openpal::Logger& logger,
+    const std::shared_ptr<Executor>& executor,
+    const IPEndpoint& endpoint,
+    bool reusePort,
     std::error_code& ec) :
 	logger(logger),
 	executor(executor),
@@ -44,7 +55,7 @@ TCPServer::TCPServer(
 	acceptor(executor->strand.get_io_service()),
 	socket(executor->strand.get_io_service())
 {
-	this->Configure(endpoint.address, ec);
+	this->Configure(endpoint.address, reusePort, ec);
 }
 
 void TCPServer::Shutdown()
@@ -58,7 +69,7 @@ void TCPServer::Shutdown()
 	}
 }
 
-void TCPServer::Configure(const std::string& adapter, std::error_code& ec)
+void TCPServer::Configure(const std::string& adapter, bool reusePort, std::error_code& ec)
 {
 	auto address = asio::ip::address::from_string(adapter, ec);
 
@@ -82,6 +93,21 @@ void TCPServer::Configure(const std::string& adapter, std::error_code& ec)
 		return;
 	}
 
+	if (reusePort)
+	{
+#ifdef SO_REUSEPORT
+		acceptor.set_option(asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>(true), ec);
+
+		if (ec)
+		{
+			return;
+		}
+#else
+		ec = std::make_error_code(std::errc::operation_not_supported);
+		return;
+#endif
+	}
+
 	acceptor.bind(this->endpoint, ec);
 
 	if (ec)
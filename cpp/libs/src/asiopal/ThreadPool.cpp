@@ -53,6 +53,10 @@ ThreadPool::ThreadPool(
 
 	infiniteTimer.expires_at(asiopal::steady_clock_t::time_point::max());
 	infiniteTimer.async_wait([](const std::error_code&) {});
+	for (uint32_t i = 0; i < concurrency; ++i)
+	{
+		metrics.push_back(std::make_unique<ThreadMetrics>());
+	}
 	for(uint32_t i = 0; i < concurrency; ++i)
 	{
 		auto run = [this, i]()
@@ -82,8 +86,20 @@ void ThreadPool::Shutdown()
 	}
 }
 
+std::vector<ThreadStatistics> ThreadPool::GetThreadStatistics() const
+{
+	std::vector<ThreadStatistics> statistics;
+	for (auto& thread : metrics)
+	{
+		statistics.push_back(thread->GetStatistics());
+	}
+	return statistics;
+}
+
 void ThreadPool::Run(int threadnum)
 {
+	ThreadMetrics::Attach(this->metrics[threadnum].get());
+
 	onThreadStart();
 
 	FORMAT_LOG_BLOCK(this->logger, logflags::INFO, "Starting thread (%d)", threadnum);
@@ -93,6 +109,8 @@ void ThreadPool::Run(int threadnum)
 	FORMAT_LOG_BLOCK(this->logger, logflags::INFO, "Exiting thread (%d)", threadnum);
 
 	onThreadExit();
+
+	ThreadMetrics::Attach(nullptr);
 }
 
 }
@@ -0,0 +1,347 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#include "asiopal/UDPChannel.h"
+
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/LogLevels.h>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/socket.h>
+#include <cerrno>
+#endif
+
+namespace asiopal
+{
+
+namespace
+{
+// start bytes, length, control, destination, source and header CRC
+const size_t LINK_HEADER_SIZE = 10;
+
+bool IsLinkHeader(const uint8_t* data, size_t size)
+{
+	return (size >= LINK_HEADER_SIZE) && (data[0] == 0x05) && (data[1] == 0x64);
+}
+
+uint16_t ReadAddress(const uint8_t* data)
+{
+	return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+// the reserved 0xFFFD - 0xFFFF range of link addresses
+bool IsBroadcast(uint16_t address)
+{
+	return address >= 0xFFFD;
+}
+}
+
+UDPChannel::UDPChannel(const openpal::Logger& logger, std::shared_ptr<Executor> executor, asio::ip::udp::socket socket, const asio::ip::udp::endpoint& remote) :
+	IAsyncChannel(executor),
+	logger(logger),
+	socket(std::move(socket)),
+	remote(remote),
+	rx(BATCH_SIZE),
+	tx(BATCH_SIZE)
+{
+	for (auto& datagram : rx)
+	{
+		datagram.data.resize(MAX_DATAGRAM_SIZE);
+	}
+
+#ifndef __linux__
+	std::error_code ec;
+	this->socket.non_blocking(true, ec);
+#endif
+}
+
+void UDPChannel::BeginReadImpl(openpal::WSlice dest)
+{
+	if (this->CompleteRead(dest))
+	{
+		return;
+	}
+
+	auto callback = [this, dest](const std::error_code & ec, size_t) mutable
+	{
+		if (ec)
+		{
+			this->OnReadCallback(ec, 0);
+			return;
+		}
+
+		const auto error = this->ReceiveBatch();
+		if (error)
+		{
+			this->OnReadCallback(error, 0);
+		}
+		else if (!this->CompleteRead(dest))
+		{
+			// spurious wakeup or only foreign datagrams, wait again
+			this->BeginReadImpl(dest);
+		}
+	};
+
+	// wait for readability, then drain the socket in a batch
+	socket.async_receive(asio::null_buffers(), this->executor->strand.wrap(callback));
+}
+
+void UDPChannel::BeginWriteImpl(const openpal::RSlice& buffer)
+{
+	if (IsLinkHeader(buffer, buffer.Size()))
+	{
+		const auto destination = ReadAddress(buffer + 4);
+
+		if (IsBroadcast(destination))
+		{
+			bool sentToRemote = false;
+			for (auto& route : this->routes)
+			{
+				sentToRemote |= (route.second == this->remote);
+				this->Enqueue(route.second, buffer);
+			}
+			if (!sentToRemote && this->remote.port() != 0)
+			{
+				this->Enqueue(this->remote, buffer);
+			}
+		}
+		else
+		{
+			const auto iter = this->routes.find(destination);
+			if (iter != this->routes.end())
+			{
+				this->Enqueue(iter->second, buffer);
+			}
+			else if (this->remote.port() != 0)
+			{
+				this->Enqueue(this->remote, buffer);
+			}
+			else
+			{
+				FORMAT_LOG_BLOCK(this->logger, openpal::logflags::WARN, "No endpoint known for link address %u, dropping frame", destination);
+			}
+		}
+	}
+	else if (this->remote.port() != 0)
+	{
+		this->Enqueue(this->remote, buffer);
+	}
+
+	const auto size = buffer.Size();
+	const auto queued = this->txCount;
+
+	auto callback = [this, self = shared_from_this(), size, queued]()
+	{
+		this->OnWriteCallback(std::error_code(), size);
+
+		// flush unless the completion queued another frame that will flush on its own completion
+		if (this->txCount == queued)
+		{
+			this->Flush();
+		}
+	};
+
+	this->executor->strand.post(callback);
+}
+
+void UDPChannel::ShutdownImpl()
+{
+	std::error_code ec;
+	socket.close(ec);
+}
+
+bool UDPChannel::CompleteRead(openpal::WSlice& dest)
+{
+	if (this->rxIndex == this->rxCount)
+	{
+		return false;
+	}
+
+	auto& datagram = this->rx[this->rxIndex];
+	const auto num = std::min<size_t>(datagram.size - this->rxOffset, dest.Size());
+	memcpy(dest, datagram.data.data() + this->rxOffset, num);
+
+	this->rxOffset += num;
+	if (this->rxOffset == datagram.size)
+	{
+		++this->rxIndex;
+		this->rxOffset = 0;
+	}
+
+	auto callback = [this, self = shared_from_this(), num]()
+	{
+		this->OnReadCallback(std::error_code(), num);
+	};
+
+	this->executor->strand.post(callback);
+
+	return true;
+}
+
+std::error_code UDPChannel::ReceiveBatch()
+{
+	this->rxCount = 0;
+	this->rxIndex = 0;
+	this->rxOffset = 0;
+
+#ifdef __linux__
+
+	mmsghdr headers[BATCH_SIZE];
+	iovec vectors[BATCH_SIZE];
+	memset(headers, 0, sizeof(headers));
+
+	for (size_t i = 0; i < BATCH_SIZE; ++i)
+	{
+		vectors[i].iov_base = rx[i].data.data();
+		vectors[i].iov_len = rx[i].data.size();
+		headers[i].msg_hdr.msg_iov = &vectors[i];
+		headers[i].msg_hdr.msg_iovlen = 1;
+		headers[i].msg_hdr.msg_name = rx[i].endpoint.data();
+		headers[i].msg_hdr.msg_namelen = static_cast<socklen_t>(rx[i].endpoint.capacity());
+	}
+
+	const int num = recvmmsg(socket.native_handle(), headers, BATCH_SIZE, MSG_DONTWAIT, nullptr);
+	if (num < 0)
+	{
+		const auto error = errno;
+		return (error == EAGAIN || error == EWOULDBLOCK) ? std::error_code() : std::error_code(error, std::system_category());
+	}
+
+	for (int i = 0; i < num; ++i)
+	{
+		rx[i].endpoint.resize(headers[i].msg_hdr.msg_namelen);
+		rx[i].size = headers[i].msg_len;
+	}
+
+	this->rxCount = static_cast<size_t>(num);
+
+#else
+
+	while (this->rxCount < BATCH_SIZE)
+	{
+		auto& datagram = rx[this->rxCount];
+		std::error_code ec;
+		datagram.size = socket.receive_from(asio::buffer(datagram.data), datagram.endpoint, 0, ec);
+		if (ec)
+		{
+			if (ec == asio::error::would_block) break;
+			return ec;
+		}
+		++this->rxCount;
+	}
+
+#endif
+
+	for (size_t i = 0; i < this->rxCount; ++i)
+	{
+		this->Learn(rx[i]);
+	}
+
+	return std::error_code();
+}
+
+void UDPChannel::Learn(const Datagram& datagram)
+{
+	if (!IsLinkHeader(datagram.data.data(), datagram.size))
+	{
+		return;
+	}
+
+	const auto source = ReadAddress(datagram.data.data() + 6);
+	auto& endpoint = this->routes[source];
+	if (endpoint != datagram.endpoint)
+	{
+		FORMAT_LOG_BLOCK(this->logger, openpal::logflags::INFO, "Link address %u is at %s:%u", source, datagram.endpoint.address().to_string().c_str(), datagram.endpoint.port());
+		endpoint = datagram.endpoint;
+	}
+}
+
+void UDPChannel::Enqueue(const asio::ip::udp::endpoint& endpoint, const openpal::RSlice& frame)
+{
+	if (this->txCount == BATCH_SIZE)
+	{
+		this->Flush();
+	}
+
+	auto& datagram = this->tx[this->txCount];
+	datagram.endpoint = endpoint;
+	datagram.data.assign(static_cast<const uint8_t*>(frame), frame + frame.Size());
+	datagram.size = frame.Size();
+	++this->txCount;
+}
+
+void UDPChannel::Flush()
+{
+	if (this->txCount == 0)
+	{
+		return;
+	}
+
+#ifdef __linux__
+
+	mmsghdr headers[BATCH_SIZE];
+	iovec vectors[BATCH_SIZE];
+	memset(headers, 0, sizeof(headers));
+
+	for (size_t i = 0; i < this->txCount; ++i)
+	{
+		vectors[i].iov_base = tx[i].data.data();
+		vectors[i].iov_len = tx[i].size;
+		headers[i].msg_hdr.msg_iov = &vectors[i];
+		headers[i].msg_hdr.msg_iovlen = 1;
+		headers[i].msg_hdr.msg_name = tx[i].endpoint.data();
+		headers[i].msg_hdr.msg_namelen = static_cast<socklen_t>(tx[i].endpoint.size());
+	}
+
+	size_t sent = 0;
+	while (sent < this->txCount)
+	{
+		const int num = sendmmsg(socket.native_handle(), headers + sent, static_cast<unsigned int>(this->txCount - sent), MSG_DONTWAIT);
+		if (num < 0)
+		{
+			// datagrams are unreliable, a full socket buffer is no different from loss on the wire
+			FORMAT_LOG_BLOCK(this->logger, openpal::logflags::WARN, "Dropped %u datagram(s): %s", static_cast<unsigned int>(this->txCount - sent), strerror(errno));
+			break;
+		}
+		sent += static_cast<size_t>(num);
+	}
+
+#else
+
+	for (size_t i = 0; i < this->txCount; ++i)
+	{
+		std::error_code ec;
+		socket.send_to(asio::buffer(tx[i].data.data(), tx[i].size), tx[i].endpoint, 0, ec);
+		if (ec)
+		{
+			FORMAT_LOG_BLOCK(this->logger, openpal::logflags::WARN, "Dropped datagram: %s", ec.message().c_str());
+		}
+	}
+
+#endif
+
+	this->txCount = 0;
+}
+
+}
@@ -0,0 +1,295 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#include "asiopal/tls/KernelTLS.h"
+
+#include <openssl/err.h>
+
+#include <cerrno>
+
+#if defined(__linux__) && defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+#define ASIOPAL_KERNEL_TLS
+#endif
+
+namespace asiopal
+{
+
+bool KernelTLS::IsSupported()
+{
+#ifdef ASIOPAL_KERNEL_TLS
+	return true;
+#else
+	return false;
+#endif
+}
+
+long KernelTLS::GetContextOptions()
+{
+#ifdef ASIOPAL_KERNEL_TLS
+	return SSL_OP_ENABLE_KTLS;
+#else
+	return 0;
+#endif
+}
+
+void KernelTLS::AsyncHandshake(
+    const std::shared_ptr<Executor>& executor,
+    const std::shared_ptr<stream_t>& stream,
+    asio::ssl::stream_base::handshake_type type,
+    const handshake_callback_t& callback)
+{
+	std::error_code ec;
+	stream->lowest_layer().non_blocking(true, ec);
+
+	if (ec)
+	{
+		executor->strand.post([callback, ec]()
+		{
+			callback(ec);
+		});
+		return;
+	}
+
+	// replaces the memory BIOs used by asio, the socket is not closed when the SSL object is freed
+	const auto ssl = stream->native_handle();
+	SSL_set_fd(ssl, static_cast<int>(stream->lowest_layer().native_handle()));
+
+	if (type == asio::ssl::stream_base::client)
+	{
+		SSL_set_connect_state(ssl);
+	}
+	else
+	{
+		SSL_set_accept_state(ssl);
+	}
+
+	ContinueHandshake(executor, stream, callback);
+}
+
+bool KernelTLS::IsAttached(stream_t& stream)
+{
+	return SSL_get_fd(stream.native_handle()) >= 0;
+}
+
+bool KernelTLS::IsSendOffloaded(stream_t& stream)
+{
+#ifdef ASIOPAL_KERNEL_TLS
+	return IsAttached(stream) && BIO_get_ktls_send(SSL_get_wbio(stream.native_handle()));
+#else
+	return false;
+#endif
+}
+
+bool KernelTLS::IsReceiveOffloaded(stream_t& stream)
+{
+#ifdef ASIOPAL_KERNEL_TLS
+	return IsAttached(stream) && BIO_get_ktls_recv(SSL_get_rbio(stream.native_handle()));
+#else
+	return false;
+#endif
+}
+
+void KernelTLS::AsyncReadSome(const std::shared_ptr<Executor>& executor, const std::shared_ptr<stream_t>& stream, openpal::WSlice dest, const io_callback_t& callback)
+{
+	const auto ssl = stream->native_handle();
+
+	ERR_clear_error();
+	const auto result = SSL_read(ssl, dest, static_cast<int>(dest.Size()));
+
+	if (result > 0)
+	{
+		executor->strand.post([callback, result]()
+		{
+			callback(std::error_code(), static_cast<size_t>(result));
+		});
+		return;
+	}
+
+	std::error_code ec;
+	const auto wait = GetWait(ssl, result, ec);
+
+	if (wait == Wait::FAILED)
+	{
+		executor->strand.post([callback, ec]()
+		{
+			callback(ec, 0);
+		});
+		return;
+	}
+
+	AsyncWait(wait, executor, stream, [executor, stream, dest, callback](const std::error_code & ec)
+	{
+		if (ec)
+		{
+			callback(ec, 0);
+		}
+		else
+		{
+			AsyncReadSome(executor, stream, dest, callback);
+		}
+	});
+}
+
+void KernelTLS::AsyncWrite(const std::shared_ptr<Executor>& executor, const std::shared_ptr<stream_t>& stream, openpal::RSlice data, size_t num, const io_callback_t& callback)
+{
+	const auto ssl = stream->native_handle();
+
+	while (data.IsNotEmpty())
+	{
+		ERR_clear_error();
+		const auto result = SSL_write(ssl, data, static_cast<int>(data.Size()));
+
+		if (result <= 0)
+		{
+			std::error_code ec;
+			const auto wait = GetWait(ssl, result, ec);
+
+			if (wait == Wait::FAILED)
+			{
+				executor->strand.post([callback, ec, num]()
+				{
+					callback(ec, num);
+				});
+			}
+			else
+			{
+				// retry with the same buffer once the socket is ready
+				AsyncWait(wait, executor, stream, [executor, stream, data, num, callback](const std::error_code & ec)
+				{
+					if (ec)
+					{
+						callback(ec, num);
+					}
+					else
+					{
+						AsyncWrite(executor, stream, data, num, callback);
+					}
+				});
+			}
+
+			return;
+		}
+
+		num += static_cast<size_t>(result);
+		data.Advance(static_cast<uint32_t>(result));
+	}
+
+	executor->strand.post([callback, num]()
+	{
+		callback(std::error_code(), num);
+	});
+}
+
+void KernelTLS::Shutdown(stream_t& stream)
+{
+	ERR_clear_error();
+	SSL_shutdown(stream.native_handle());
+	ERR_clear_error();
+}
+
+KernelTLS::Wait KernelTLS::GetWait(SSL* ssl, int result, std::error_code& ec)
+{
+	const auto error = SSL_get_error(ssl, result);
+
+	switch (error)
+	{
+	case(SSL_ERROR_WANT_READ):
+		return Wait::READ;
+	case(SSL_ERROR_WANT_WRITE):
+		return Wait::WRITE;
+	case(SSL_ERROR_SYSCALL):
+		ec = (errno != 0) ? std::error_code(errno, std::system_category()) : std::make_error_code(std::errc::connection_reset);
+		break;
+	case(SSL_ERROR_ZERO_RETURN):
+		ec = std::make_error_code(std::errc::connection_reset);
+		break;
+	default:
+		ec = std::make_error_code(std::errc::protocol_error);
+		break;
+	}
+
+	ERR_clear_error();
+	return Wait::FAILED;
+}
+
+void KernelTLS::AsyncWait(
+    Wait wait,
+    const std::shared_ptr<Executor>& executor,
+    const std::shared_ptr<stream_t>& stream,
+    const std::function<void(const std::error_code& ec)>& callback)
+{
+	auto ready = [callback](const std::error_code & ec, size_t)
+	{
+		callback(ec);
+	};
+
+	if (wait == Wait::READ)
+	{
+		stream->next_layer().async_read_some(asio::null_buffers(), executor->strand.wrap(ready));
+	}
+	else
+	{
+		stream->next_layer().async_write_some(asio::null_buffers(), executor->strand.wrap(ready));
+	}
+}
+
+void KernelTLS::ContinueHandshake(const std::shared_ptr<Executor>& executor, const std::shared_ptr<stream_t>& stream, const handshake_callback_t& callback)
+{
+	const auto ssl = stream->native_handle();
+
+	ERR_clear_error();
+	const auto result = SSL_do_handshake(ssl);
+
+	if (result == 1)
+	{
+		executor->strand.post([callback]()
+		{
+			callback(std::error_code());
+		});
+		return;
+	}
+
+	std::error_code ec;
+	const auto wait = GetWait(ssl, result, ec);
+
+	if (wait == Wait::FAILED)
+	{
+		executor->strand.post([callback, ec]()
+		{
+			callback(ec);
+		});
+		return;
+	}
+
+	AsyncWait(wait, executor, stream, [executor, stream, callback](const std::error_code & ec)
+	{
+		if (ec)
+		{
+			callback(ec);
+		}
+		else
+		{
+			ContinueHandshake(executor, stream, callback);
+		}
+	});
+}
+
+}
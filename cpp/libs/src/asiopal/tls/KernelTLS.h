@@ -0,0 +1,103 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_KERNELTLS_H
+#define ASIOPAL_KERNELTLS_H
+
+#include "asiopal/Executor.h"
+
+#include <openpal/container/WSlice.h>
+#include <openpal/container/RSlice.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <asio/ssl.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace asiopal
+{
+
+/**
+* Runs the handshake and record I/O of an asio::ssl::stream directly on its socket instead of
+* through asio's memory BIOs. OpenSSL can then hand the negotiated keys to the kernel (kTLS) so
+* that records are encrypted and decrypted by the kernel and reads and writes are plain socket I/O.
+*/
+class KernelTLS : private openpal::StaticOnly
+{
+
+public:
+
+	typedef asio::ssl::stream<asio::ip::tcp::socket> stream_t;
+	typedef std::function<void(const std::error_code& ec)> handshake_callback_t;
+	typedef std::function<void(const std::error_code& ec, size_t num)> io_callback_t;
+
+	/// true if this platform and OpenSSL build can offload records to the kernel
+	static bool IsSupported();
+
+	/// options to set on an SSL_CTX so that OpenSSL enables kTLS after the handshake
+	static long GetContextOptions();
+
+	/// attach the SSL object of a stream to its socket and perform the handshake
+	static void AsyncHandshake(
+	    const std::shared_ptr<Executor>& executor,
+	    const std::shared_ptr<stream_t>& stream,
+	    asio::ssl::stream_base::handshake_type type,
+	    const handshake_callback_t& callback);
+
+	/// true if the stream was attached to its socket by AsyncHandshake
+	static bool IsAttached(stream_t& stream);
+
+	/// true if the kernel encrypts the records sent on an attached stream
+	static bool IsSendOffloaded(stream_t& stream);
+
+	/// true if the kernel decrypts the records received on an attached stream
+	static bool IsReceiveOffloaded(stream_t& stream);
+
+	static void AsyncReadSome(const std::shared_ptr<Executor>& executor, const std::shared_ptr<stream_t>& stream, openpal::WSlice dest, const io_callback_t& callback);
+
+	static void AsyncWrite(const std::shared_ptr<Executor>& executor, const std::shared_ptr<stream_t>& stream, openpal::RSlice data, size_t num, const io_callback_t& callback);
+
+	/// send close_notify without waiting for the reply
+	static void Shutdown(stream_t& stream);
+
+private:
+
+	enum class Wait
+	{
+		READ,
+		WRITE,
+		FAILED
+	};
+
+	static Wait GetWait(SSL* ssl, int result, std::error_code& ec);
+
+	static void AsyncWait(
+	    Wait wait,
+	    const std::shared_ptr<Executor>& executor,
+	    const std::shared_ptr<stream_t>& stream,
+	    const std::function<void(const std::error_code& ec)>& callback);
+
+	static void ContinueHandshake(const std::shared_ptr<Executor>& executor, const std::shared_ptr<stream_t>& stream, const handshake_callback_t& callback);
+};
+
+}
+
+#endif
@@ -21,6 +21,9 @@
 
 #include "asiopal/tls/SSLContext.h"
 
+#include "asiopal/tls/KernelTLS.h"
+#include "asiopal/tls/SSLSessionCache.h"
+
 #include <openpal/logging/LogMacros.h>
 #include <opendnp3/LogLevels.h>
 
@@ -35,6 +38,23 @@ SSLContext::SSLContext(const openpal::Logger& logger, bool server, const TLSConf
 	this->ApplyConfig(config, server, ec);
 }
 
+void SSLContext::BeginClientSession(SSL* ssl, const std::string& remote)
+{
+	if (this->resumption)
+	{
+		SSLSessionCache::Instance().Resume(ssl, remote);
+	}
+}
+
+void SSLContext::LogHandshake(SSL* ssl, bool kernelSend, bool kernelReceive)
+{
+	FORMAT_LOG_BLOCK(logger, flags::DBG, "TLS handshake complete - %s, session %s, kernel tx: %s rx: %s",
+	                 SSL_get_version(ssl),
+	                 SSL_session_reused(ssl) ? "resumed" : "negotiated",
+	                 kernelSend ? "on" : "off",
+	                 kernelReceive ? "on" : "off");
+}
+
 int SSLContext::GetVerifyMode(bool server)
 {
 	return server ? (asio::ssl::verify_peer | asio::ssl::verify_fail_if_no_peer_cert) : asio::ssl::verify_peer;
@@ -42,10 +62,29 @@ int SSLContext::GetVerifyMode(bool server)
 
 std::error_code SSLContext::ApplyConfig(const TLSConfig& config, bool server, std::error_code& ec)
 {
-	// turn off session caching completely
-	SSL_CTX_set_session_cache_mode(value.native_handle(), SSL_SESS_CACHE_OFF);
+	auto OPTIONS = asio::ssl::context::default_workarounds | asio::ssl::context::no_sslv2 | asio::ssl::context::no_sslv3;
 
-	auto OPTIONS = asio::ssl::context::default_workarounds | asio::ssl::context::no_sslv2 | asio::ssl::context::no_sslv3 | SSL_OP_NO_TICKET;
+	this->resumption = config.sessionLifetimeSeconds > 0;
+
+	if (!this->resumption)
+	{
+		// turn off session caching completely
+		SSL_CTX_set_session_cache_mode(value.native_handle(), SSL_SESS_CACHE_OFF);
+		OPTIONS |= SSL_OP_NO_TICKET;
+	}
+
+	if (config.useKernelTLS)
+	{
+		if (KernelTLS::IsSupported())
+		{
+			this->kernelTLS = true;
+			OPTIONS |= KernelTLS::GetContextOptions();
+		}
+		else
+		{
+			SIMPLE_LOG_BLOCK(logger, flags::WARN, "Kernel TLS is not supported by this platform or OpenSSL build, records will be processed in user space");
+		}
+	}
 
 	if (!config.allowTLSv10)
 	{
@@ -109,6 +148,21 @@ std::error_code SSLContext::ApplyConfig(const TLSConfig& config, bool server, st
 	if (value.use_private_key_file(config.privateKeyFilePath, asio::ssl::context_base::file_format::pem, ec))
 	{
 		FORMAT_LOG_BLOCK(logger, flags::ERR, "Error calling ssl::context::use_private_key_file(..): %s", ec.message().c_str());
+		return ec;
+	}
+
+	// the session scope covers the files loaded above
+	if (this->resumption)
+	{
+		auto& cache = SSLSessionCache::Instance();
+		if (server)
+		{
+			cache.ConfigureServer(value.native_handle(), config);
+		}
+		else
+		{
+			cache.ConfigureClient(value.native_handle(), config);
+		}
 	}
 
 	return ec;
@@ -40,12 +40,25 @@ public:
 
 	SSLContext(const openpal::Logger& logger, bool server, const TLSConfig& cfg, std::error_code&);
 
+	/// true if handshakes should attach to the socket so that records can be offloaded to the kernel
+	bool IsKernelTLS() const
+	{
+		return kernelTLS;
+	}
+
+	/// prepare a client SSL object, offering the last session negotiated with the remote endpoint
+	void BeginClientSession(SSL* ssl, const std::string& remote);
+
+	/// log how a completed handshake was negotiated
+	void LogHandshake(SSL* ssl, bool kernelSend, bool kernelReceive);
 
 	asio::ssl::context value;
 
 private:
 
 	openpal::Logger logger;
+	bool resumption = false;
+	bool kernelTLS = false;
 
 	static int GetVerifyMode(bool server);
 
@@ -0,0 +1,360 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#include "asiopal/tls/SSLSessionCache.h"
+
+#include <openssl/rand.h>
+#include <openssl/evp.h>
+
+#include <ctime>
+#include <fstream>
+#include <iterator>
+
+namespace asiopal
+{
+
+namespace
+{
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+const size_t TICKET_KEY_SIZE = 80;
+#else
+const size_t TICKET_KEY_SIZE = 48;
+#endif
+
+void AddReference(SSL_SESSION* session)
+{
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+	SSL_SESSION_up_ref(session);
+#else
+	CRYPTO_add(&session->references, 1, CRYPTO_LOCK_SSL_SESSION);
+#endif
+}
+
+// the contents of a file, empty if it cannot be read
+std::string ReadFile(const std::string& path)
+{
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void FreeString(void* parent, void* ptr, CRYPTO_EX_DATA* ad, int idx, long argl, void* argp)
+{
+	delete static_cast<std::string*>(ptr);
+}
+
+class SHA256Digest : private openpal::Uncopyable
+{
+public:
+
+	static const size_t SIZE = 32;
+
+	SHA256Digest()
+	{
+		EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
+	}
+
+	~SHA256Digest()
+	{
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+		EVP_MD_CTX_free(ctx);
+#else
+		EVP_MD_CTX_destroy(ctx);
+#endif
+	}
+
+	void Update(const void* data, size_t length)
+	{
+		EVP_DigestUpdate(ctx, data, length);
+	}
+
+	// length prefix variable size fields so that no two configurations hash the same input
+	void Update(const std::string& value)
+	{
+		const uint32_t length = static_cast<uint32_t>(value.size());
+		this->Update(&length, sizeof(length));
+		this->Update(value.data(), value.size());
+	}
+
+	void Final(unsigned char* dest)
+	{
+		EVP_DigestFinal_ex(ctx, dest, nullptr);
+	}
+
+private:
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+	EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+#else
+	EVP_MD_CTX* ctx = EVP_MD_CTX_create();
+#endif
+};
+}
+
+SSLSessionCache& SSLSessionCache::Instance()
+{
+	static SSLSessionCache instance;
+	return instance;
+}
+
+SSLSessionCache::SSLSessionCache() :
+	remoteIndex(SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, &FreeString)),
+	scopeIndex(SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, &FreeString))
+{
+	RAND_bytes(ticketSecret, sizeof(ticketSecret));
+}
+
+SSLSessionCache::~SSLSessionCache()
+{
+	this->Clear();
+}
+
+void SSLSessionCache::ConfigureServer(SSL_CTX* ctx, const TLSConfig& config)
+{
+	const auto scope = GetScope(config);
+
+	this->Configure(ctx, config, scope);
+	SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+	SSL_CTX_sess_set_new_cb(ctx, &SSLSessionCache::OnNewServerSession);
+	SSL_CTX_sess_set_get_cb(ctx, &SSLSessionCache::OnGetServerSession);
+	SSL_CTX_sess_set_remove_cb(ctx, &SSLSessionCache::OnRemoveSession);
+
+	// tickets issued under one scope cannot be decrypted under another
+	unsigned char keys[3 * SHA256Digest::SIZE];
+	static_assert(sizeof(keys) >= TICKET_KEY_SIZE, "ticket key buffer too small");
+	for (uint8_t i = 0; i < 3; ++i)
+	{
+		SHA256Digest sha;
+		sha.Update(this->ticketSecret, sizeof(this->ticketSecret));
+		sha.Update(scope.data(), scope.size());
+		sha.Update(&i, sizeof(i));
+		sha.Final(keys + i * SHA256Digest::SIZE);
+	}
+	SSL_CTX_set_tlsext_ticket_keys(ctx, keys, TICKET_KEY_SIZE);
+}
+
+void SSLSessionCache::ConfigureClient(SSL_CTX* ctx, const TLSConfig& config)
+{
+	this->Configure(ctx, config, GetScope(config));
+	SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+	SSL_CTX_sess_set_new_cb(ctx, &SSLSessionCache::OnNewClientSession);
+}
+
+void SSLSessionCache::Configure(SSL_CTX* ctx, const TLSConfig& config, const std::string& scope)
+{
+	delete static_cast<std::string*>(SSL_CTX_get_ex_data(ctx, this->scopeIndex));
+	SSL_CTX_set_ex_data(ctx, this->scopeIndex, new std::string(scope));
+
+	SSL_CTX_set_session_id_context(ctx, reinterpret_cast<const unsigned char*>(scope.data()), static_cast<unsigned int>(scope.size()));
+	SSL_CTX_set_timeout(ctx, config.sessionLifetimeSeconds);
+}
+
+bool SSLSessionCache::Resume(SSL* ssl, const std::string& remote)
+{
+	const auto key = GetClientKey(SSL_get_SSL_CTX(ssl), remote);
+
+	SSL_set_ex_data(ssl, this->remoteIndex, new std::string(key));
+
+	const auto session = this->Lookup(key);
+	if (!session)
+	{
+		return false;
+	}
+
+	const auto result = SSL_set_session(ssl, session);
+	SSL_SESSION_free(session);
+	return result == 1;
+}
+
+size_t SSLSessionCache::Size()
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->sessions.size();
+}
+
+void SSLSessionCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	for (auto& entry : this->sessions)
+	{
+		SSL_SESSION_free(entry.second.session);
+	}
+	this->sessions.clear();
+	this->insertionOrder.clear();
+}
+
+std::string SSLSessionCache::GetScope(const TLSConfig& config)
+{
+	// hash what the files contain rather than where they are, so replacing a certificate in place changes the scope
+	SHA256Digest sha;
+	sha.Update(ReadFile(config.peerCertFilePath));
+	sha.Update(ReadFile(config.localCertFilePath));
+	sha.Update(ReadFile(config.privateKeyFilePath));
+	sha.Update(config.cipherList);
+
+	const int32_t depth = config.maxVerifyDepth;
+	sha.Update(&depth, sizeof(depth));
+
+	const uint8_t versions[] = { config.allowTLSv10, config.allowTLSv11, config.allowTLSv12 };
+	sha.Update(versions, sizeof(versions));
+
+	unsigned char digest[SHA256Digest::SIZE];
+	static_assert(sizeof(digest) <= SSL_MAX_SID_CTX_LENGTH, "digest is too long for a session ID context");
+	sha.Final(digest);
+	return std::string(reinterpret_cast<const char*>(digest), sizeof(digest));
+}
+
+std::string SSLSessionCache::GetScope(SSL_CTX* ctx)
+{
+	const auto scope = static_cast<std::string*>(SSL_CTX_get_ex_data(ctx, Instance().scopeIndex));
+	return scope ? *scope : std::string();
+}
+
+std::string SSLSessionCache::GetServerKey(SSL_CTX* ctx, const unsigned char* id, unsigned int length)
+{
+	return std::string("id:") + GetScope(ctx) + std::string(reinterpret_cast<const char*>(id), length);
+}
+
+std::string SSLSessionCache::GetClientKey(SSL_CTX* ctx, const std::string& remote)
+{
+	return std::string("peer:") + GetScope(ctx) + remote;
+}
+
+int SSLSessionCache::OnNewServerSession(SSL* ssl, SSL_SESSION* session)
+{
+	unsigned int length = 0;
+	const auto id = SSL_SESSION_get_id(session, &length);
+	const auto ctx = SSL_get_SSL_CTX(ssl);
+	Instance().Store(GetServerKey(ctx, id, length), session, SSL_CTX_get_timeout(ctx));
+	return 1;
+}
+
+int SSLSessionCache::OnNewClientSession(SSL* ssl, SSL_SESSION* session)
+{
+	auto& cache = Instance();
+	const auto key = static_cast<std::string*>(SSL_get_ex_data(ssl, cache.remoteIndex));
+	if (!key)
+	{
+		return 0;
+	}
+
+	cache.Store(*key, session, SSL_CTX_get_timeout(SSL_get_SSL_CTX(ssl)));
+	return 1;
+}
+
+void SSLSessionCache::OnRemoveSession(SSL_CTX* ctx, SSL_SESSION* session)
+{
+	unsigned int length = 0;
+	const auto id = SSL_SESSION_get_id(session, &length);
+	Instance().Remove(GetServerKey(ctx, id, length));
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+SSL_SESSION* SSLSessionCache::OnGetServerSession(SSL* ssl, const unsigned char* id, int length, int* copy)
+#else
+SSL_SESSION* SSLSessionCache::OnGetServerSession(SSL* ssl, unsigned char* id, int length, int* copy)
+#endif
+{
+	// the returned session already carries a reference for the caller
+	*copy = 0;
+	return Instance().Lookup(GetServerKey(SSL_get_SSL_CTX(ssl), id, static_cast<unsigned int>(length)));
+}
+
+void SSLSessionCache::Store(const std::string& key, SSL_SESSION* session, long lifetimeSeconds)
+{
+	const auto now = time(nullptr);
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	const auto existing = this->sessions.find(key);
+	if (existing != this->sessions.end())
+	{
+		this->Erase(existing);
+	}
+
+	if (this->sessions.size() >= MAX_SESSIONS)
+	{
+		this->Purge(now);
+		if (this->sessions.size() >= MAX_SESSIONS)
+		{
+			this->Erase(this->sessions.find(this->insertionOrder.front()));
+		}
+	}
+
+	auto& entry = this->sessions[key];
+	entry.session = session;
+	entry.expiration = now + lifetimeSeconds;
+	entry.position = this->insertionOrder.insert(this->insertionOrder.end(), key);
+}
+
+SSL_SESSION* SSLSessionCache::Lookup(const std::string& key)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	const auto iter = this->sessions.find(key);
+	if (iter == this->sessions.end())
+	{
+		return nullptr;
+	}
+
+	if (iter->second.expiration <= time(nullptr))
+	{
+		this->Erase(iter);
+		return nullptr;
+	}
+
+	AddReference(iter->second.session);
+	return iter->second.session;
+}
+
+void SSLSessionCache::Remove(const std::string& key)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	const auto iter = this->sessions.find(key);
+	if (iter != this->sessions.end())
+	{
+		this->Erase(iter);
+	}
+}
+
+void SSLSessionCache::Purge(time_t now)
+{
+	for (auto iter = this->sessions.begin(); iter != this->sessions.end();)
+	{
+		if (iter->second.expiration <= now)
+		{
+			iter = this->Erase(iter);
+		}
+		else
+		{
+			++iter;
+		}
+	}
+}
+
+SSLSessionCache::SessionMap::iterator SSLSessionCache::Erase(SessionMap::iterator iter)
+{
+	SSL_SESSION_free(iter->second.session);
+	this->insertionOrder.erase(iter->second.position);
+	return this->sessions.erase(iter);
+}
+
+}
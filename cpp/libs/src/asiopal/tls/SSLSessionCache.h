@@ -0,0 +1,144 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_SSLSESSIONCACHE_H
+#define ASIOPAL_SSLSESSIONCACHE_H
+
+#include "asiopal/TLSConfig.h"
+
+#include <openpal/util/Uncopyable.h>
+
+#include <asio/ssl.hpp>
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace asiopal
+{
+
+/**
+* Process-wide cache of resumable TLS sessions shared by every SSLContext
+*
+* Servers store sessions by session ID and encrypt session tickets with keys shared by all
+* server contexts, so a re-created listener can resume sessions negotiated by its predecessor.
+* Clients store the last session negotiated with each remote endpoint.
+*
+* Sessions are scoped by a digest of the trust relevant parts of the TLSConfig (contents of the
+* certificate and key files, verification depth, protocol versions and cipher list). The digest is
+* the server session ID context, seeds the ticket keys and prefixes every cache key, so a session
+* verified under one configuration, or before a certificate file was replaced, is never resumed
+* under another.
+*
+* When the cache is full, expired sessions are purged and then the oldest sessions are evicted.
+*/
+class SSLSessionCache final : private openpal::Uncopyable
+{
+
+public:
+
+	static SSLSessionCache& Instance();
+
+	/// enable session ID and session ticket resumption on a server context, after its certificates are loaded
+	void ConfigureServer(SSL_CTX* ctx, const TLSConfig& config);
+
+	/// enable resumption on a client context, after its certificates are loaded
+	void ConfigureClient(SSL_CTX* ctx, const TLSConfig& config);
+
+	/// offer the last session negotiated with a remote endpoint, returns true if there was one
+	bool Resume(SSL* ssl, const std::string& remote);
+
+	/// number of cached sessions, including expired sessions that have not been purged yet
+	size_t Size();
+
+	/// drop all cached sessions
+	void Clear();
+
+private:
+
+	static const size_t MAX_SESSIONS = 16384;
+
+	SSLSessionCache();
+	~SSLSessionCache();
+
+	struct Entry
+	{
+		SSL_SESSION* session = nullptr;
+		time_t expiration = 0;
+		std::list<std::string>::iterator position;
+	};
+
+	typedef std::map<std::string, Entry> SessionMap;
+
+	// digest of the parts of the configuration that determine who is trusted
+	static std::string GetScope(const TLSConfig& config);
+
+	// attach the scope to the context and apply the settings common to clients and servers
+	void Configure(SSL_CTX* ctx, const TLSConfig& config, const std::string& scope);
+
+	// the scope attached to a context, empty if the context was not configured by the cache
+	static std::string GetScope(SSL_CTX* ctx);
+
+	static std::string GetServerKey(SSL_CTX* ctx, const unsigned char* id, unsigned int length);
+	static std::string GetClientKey(SSL_CTX* ctx, const std::string& remote);
+
+	static int OnNewServerSession(SSL* ssl, SSL_SESSION* session);
+	static int OnNewClientSession(SSL* ssl, SSL_SESSION* session);
+	static void OnRemoveSession(SSL_CTX* ctx, SSL_SESSION* session);
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+	static SSL_SESSION* OnGetServerSession(SSL* ssl, const unsigned char* id, int length, int* copy);
+#else
+	static SSL_SESSION* OnGetServerSession(SSL* ssl, unsigned char* id, int length, int* copy);
+#endif
+
+	// takes ownership of the session reference
+	void Store(const std::string& key, SSL_SESSION* session, long lifetimeSeconds);
+
+	// returns a new reference to the session or nullptr
+	SSL_SESSION* Lookup(const std::string& key);
+
+	void Remove(const std::string& key);
+
+	void Purge(time_t now);
+
+	// frees the session and forgets its key
+	SessionMap::iterator Erase(SessionMap::iterator iter);
+
+	std::mutex mutex;
+	SessionMap sessions;
+
+	// keys of the cached sessions, oldest first
+	std::list<std::string> insertionOrder;
+
+	// ex_data index of the cache key attached to client SSL objects
+	int remoteIndex;
+
+	// ex_data index of the scope attached to SSL_CTX objects
+	int scopeIndex;
+
+	// secret from which the name, HMAC and AES ticket keys of each scope are derived
+	unsigned char ticketSecret[32];
+};
+
+}
+
+#endif
@@ -22,9 +22,12 @@
 #include "asiopal/tls/TLSClient.h"
 
 #include "asiopal/SocketHelpers.h"
+#include "asiopal/tls/KernelTLS.h"
 
 #include "opendnp3/LogLevels.h"
 
+#include <sstream>
+
 using namespace openpal;
 using namespace opendnp3;
 
@@ -204,15 +207,33 @@ void TLSClient::HandleConnectResult(
 	}
 	else
 	{
+		// sessions are resumed per remote endpoint
+		std::error_code ec1;
+		std::ostringstream remote;
+		remote << stream->lowest_layer().remote_endpoint(ec1);
+		this->ctx.BeginClientSession(stream->native_handle(), remote.str());
+
 		auto cb = [self = shared_from_this(), callback, stream](const std::error_code & ec)
 		{
+			if (!ec)
+			{
+				self->ctx.LogHandshake(stream->native_handle(), KernelTLS::IsSendOffloaded(*stream), KernelTLS::IsReceiveOffloaded(*stream));
+			}
+
 			if (!self->canceled)
 			{
 				callback(self->executor, stream, ec);
 			}
 		};
 
-		stream->async_handshake(asio::ssl::stream_base::client, executor->strand.wrap(cb));
+		if (this->ctx.IsKernelTLS())
+		{
+			KernelTLS::AsyncHandshake(executor, stream, asio::ssl::stream_base::client, cb);
+		}
+		else
+		{
+			stream->async_handshake(asio::ssl::stream_base::client, executor->strand.wrap(cb));
+		}
 	}
 }
 
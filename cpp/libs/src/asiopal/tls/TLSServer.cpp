@@ -21,6 +21,8 @@
 
 #include "asiopal/tls/TLSServer.h"
 
+#include "asiopal/tls/KernelTLS.h"
+
 #include <openpal/logging/LogMacros.h>
 #include <opendnp3/LogLevels.h>
 
@@ -133,11 +135,19 @@ void TLSServer::StartAccept(std::error_code& ec)
 				return;
 			}
 
+			self->ctx.LogHandshake(stream->native_handle(), KernelTLS::IsSendOffloaded(*stream), KernelTLS::IsReceiveOffloaded(*stream));
 			self->AcceptStream(ID, self->executor, stream);
 		};
 
 		// Begin the TLS handshake
-		stream->async_handshake(asio::ssl::stream_base::server, self->executor->strand.wrap(handshake_cb));
+		if (self->ctx.IsKernelTLS())
+		{
+			KernelTLS::AsyncHandshake(self->executor, stream, asio::ssl::stream_base::server, handshake_cb);
+		}
+		else
+		{
+			stream->async_handshake(asio::ssl::stream_base::server, self->executor->strand.wrap(handshake_cb));
+		}
 	};
 
 	this->acceptor.async_accept(stream->lowest_layer(), this->executor->strand.wrap(accept_cb));
@@ -21,12 +21,15 @@
 
 #include "asiopal/tls/TLSStreamChannel.h"
 
+#include "asiopal/tls/KernelTLS.h"
+
 namespace asiopal
 {
 
 TLSStreamChannel::TLSStreamChannel(const std::shared_ptr<Executor>& executor, const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream) :
 	IAsyncChannel(executor),
-	stream(stream)
+	stream(stream),
+	attached(KernelTLS::IsAttached(*stream))
 {}
 
 void TLSStreamChannel::BeginReadImpl(openpal::WSlice dest)
@@ -36,6 +39,12 @@ void TLSStreamChannel::BeginReadImpl(openpal::WSlice dest)
 		this->OnReadCallback(ec, num);
 	};
 
+	if (this->attached)
+	{
+		KernelTLS::AsyncReadSome(this->executor, stream, dest, callback);
+		return;
+	}
+
 	stream->async_read_some(asio::buffer(dest, dest.Size()), this->executor->strand.wrap(callback));
 }
 
@@ -46,6 +55,12 @@ void TLSStreamChannel::BeginWriteImpl(const openpal::RSlice& data)
 		this->OnWriteCallback(ec, num);
 	};
 
+	if (this->attached)
+	{
+		KernelTLS::AsyncWrite(this->executor, stream, data, 0, callback);
+		return;
+	}
+
 	asio::async_write(*stream, asio::buffer(data, data.Size()), this->executor->strand.wrap(callback));
 }
 
@@ -61,6 +76,13 @@ void TLSStreamChannel::ShutdownImpl()
 		stream->lowest_layer().close(ec1);
 	};
 
+	if (this->attached)
+	{
+		KernelTLS::Shutdown(*stream);
+		callback(ec);
+		return;
+	}
+
 	stream->async_shutdown(callback);
 }
 
@@ -47,6 +47,9 @@ private:
 	virtual void ShutdownImpl()  override;
 
 	const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>> stream;
+
+	// records are read and written on the socket, see KernelTLS
+	const bool attached;
 };
 
 }
@@ -38,7 +38,7 @@ DecoderImpl::DecoderImpl(IDecoderCallbacks& callbacks, const openpal::Logger& lo
 	callbacks(&callbacks),
 	logger(logger),
 	link(logger),
-	transportRx(logger, 2048)
+	transportRx(logger, 2048, nullptr)
 {}
 
 void DecoderImpl::DecodeLPDU(const openpal::RSlice& data)
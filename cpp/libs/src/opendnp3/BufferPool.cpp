@@ -0,0 +1,73 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "opendnp3/BufferPool.h"
+
+namespace opendnp3
+{
+
+BufferPool::BufferPool(uint64_t maxCachedBytes) : maxCachedBytes(maxCachedBytes)
+{}
+
+BufferPool::Statistics BufferPool::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->statistics;
+}
+
+std::unique_ptr<uint8_t[]> BufferPool::Acquire(uint32_t size)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		this->statistics.bytesInUse += size;
+
+		auto iter = this->cached.find(size);
+		if (iter != this->cached.end() && !iter->second.empty())
+		{
+			auto buffer = std::move(iter->second.back());
+			iter->second.pop_back();
+			this->statistics.bytesCached -= size;
+			return buffer;
+		}
+
+		++this->statistics.numAllocations;
+	}
+
+	// allocate outside the lock
+	return std::unique_ptr<uint8_t[]>(new uint8_t[size]);
+}
+
+void BufferPool::Release(std::unique_ptr<uint8_t[]> buffer, uint32_t size)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	this->statistics.bytesInUse -= size;
+
+	if ((this->statistics.bytesCached + size) <= this->maxCachedBytes)
+	{
+		this->cached[size].push_back(std::move(buffer));
+		this->statistics.bytesCached += size;
+	}
+
+	// otherwise the buffer is freed when it goes out of scope
+}
+
+}
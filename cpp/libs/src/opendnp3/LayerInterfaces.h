@@ -63,6 +63,13 @@ public:
 	// return false if the layer is down
 	virtual bool OnReceive(const openpal::RSlice&) = 0;
 
+	// Called by the lower layer when data sent to a broadcast address arrives.
+	// Layers that don't distinguish broadcasts treat it as ordinary data.
+	virtual bool OnReceiveBroadcast(const openpal::RSlice& data)
+	{
+		return this->OnReceive(data);
+	}
+
 	// Called by lower layer when a previously requested send operation succeeds or fails.
 	// Layers can only have 1 outstanding send operation. The callback is guaranteed
 	// unless the the OnLowerLayerDown() function is called beforehand
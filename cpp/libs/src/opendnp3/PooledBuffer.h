@@ -0,0 +1,75 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_POOLEDBUFFER_H
+#define OPENDNP3_POOLEDBUFFER_H
+
+#include "opendnp3/BufferPool.h"
+
+#include <openpal/container/RSlice.h>
+#include <openpal/container/WSlice.h>
+
+namespace opendnp3
+{
+
+/**
+* Fixed size buffer that is attached from a BufferPool on demand and can be released back to it when idle.
+*
+* Without a pool, the buffer is allocated on construction and Release() does nothing.
+*/
+class PooledBuffer : private openpal::Uncopyable
+{
+
+public:
+
+	PooledBuffer(uint32_t size, const std::shared_ptr<BufferPool>& pool);
+
+	~PooledBuffer();
+
+	/// Attaches a buffer from the pool if necessary
+	openpal::WSlice GetWSlice();
+
+	/// The contents of the attached buffer, empty if detached
+	openpal::RSlice ToRSlice() const;
+
+	/// Return the buffer to the pool. Any slices obtained from the buffer become invalid.
+	void Release();
+
+	uint32_t Size() const
+	{
+		return size;
+	}
+
+	/// Number of heap bytes currently held by the buffer
+	uint32_t AttachedBytes() const
+	{
+		return buffer ? size : 0;
+	}
+
+private:
+
+	const uint32_t size;
+	const std::shared_ptr<BufferPool> pool;
+	std::unique_ptr<uint8_t[]> buffer;
+};
+
+}
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "RTTEstimator.h"
+
+#include <algorithm>
+
+using namespace openpal;
+
+namespace opendnp3
+{
+
+RTTEstimator::RTTEstimator(TimeDuration initial, TimeDuration min, TimeDuration max) :
+	initialMs(initial.GetMilliseconds()),
+	minMs(min.GetMilliseconds()),
+	maxMs(std::max(min.GetMilliseconds(), max.GetMilliseconds())),
+	timeoutMs(Clamp(initial.GetMilliseconds()))
+{
+
+}
+
+void RTTEstimator::OnSample(TimeDuration rtt)
+{
+	const int64_t sample = std::max<int64_t>(rtt.GetMilliseconds(), 0) * 1000;
+
+	if (numSamples == 0)
+	{
+		srttUs = sample;
+		rttvarUs = sample / 2;
+	}
+	else
+	{
+		// alpha = 1/8, beta = 1/4
+		const int64_t error = sample - srttUs;
+		rttvarUs += ((error < 0 ? -error : error) - rttvarUs) / 4;
+		srttUs += error / 8;
+	}
+
+	++numSamples;
+	timeoutMs = Clamp((srttUs + std::max<int64_t>(4 * rttvarUs, 1000) + 999) / 1000);
+}
+
+void RTTEstimator::OnTimeout()
+{
+	timeoutMs = Clamp(2 * timeoutMs);
+}
+
+void RTTEstimator::Reset()
+{
+	srttUs = 0;
+	rttvarUs = 0;
+	numSamples = 0;
+	timeoutMs = Clamp(initialMs);
+}
+
+int64_t RTTEstimator::Clamp(int64_t ms) const
+{
+	return std::min(std::max(ms, minMs), maxMs);
+}
+
+}
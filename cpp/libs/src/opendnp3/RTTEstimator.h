@@ -0,0 +1,90 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_RTTESTIMATOR_H
+#define OPENDNP3_RTTESTIMATOR_H
+
+#include <openpal/executor/TimeDuration.h>
+
+namespace opendnp3
+{
+
+/**
+* Estimates a retransmission timeout from measured round trip times, in the same way TCP does (RFC 6298).
+*
+* The timeout is the smoothed RTT plus four times its mean deviation, clamped to [min, max]. Each expiry
+* doubles the timeout until the next valid sample arrives. Samples from retransmitted requests must not be
+* supplied because the response cannot be matched to a particular transmission (Karn's algorithm).
+*/
+class RTTEstimator
+{
+
+public:
+
+	/// The initial timeout is used until the first sample arrives
+	RTTEstimator(openpal::TimeDuration initial, openpal::TimeDuration min, openpal::TimeDuration max);
+
+	/// Record the time between a request and its response
+	void OnSample(openpal::TimeDuration rtt);
+
+	/// Record that a response timer expired
+	void OnTimeout();
+
+	/// Forget all samples and go back to the initial timeout
+	void Reset();
+
+	openpal::TimeDuration GetTimeout() const
+	{
+		return openpal::TimeDuration::Milliseconds(timeoutMs);
+	}
+
+	openpal::TimeDuration GetSmoothedRTT() const
+	{
+		return openpal::TimeDuration::Milliseconds(srttUs / 1000);
+	}
+
+	openpal::TimeDuration GetVariance() const
+	{
+		return openpal::TimeDuration::Milliseconds(rttvarUs / 1000);
+	}
+
+	uint32_t NumSamples() const
+	{
+		return numSamples;
+	}
+
+private:
+
+	int64_t Clamp(int64_t ms) const;
+
+	const int64_t initialMs;
+	const int64_t minMs;
+	const int64_t maxMs;
+
+	// kept in microseconds so that the integer filters don't stall a few milliseconds short of the true value
+	int64_t srttUs = 0;
+	int64_t rttvarUs = 0;
+	int64_t timeoutMs;
+	uint32_t numSamples = 0;
+};
+
+}
+
+#endif
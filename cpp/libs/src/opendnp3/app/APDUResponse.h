@@ -32,15 +32,13 @@ class APDUResponse : public APDUWrapper
 {
 public:
 
+	APDUResponse() = default;
+
 	explicit APDUResponse(const openpal::WSlice& buffer);
 
 	void SetIIN(const IINField& indications);
 
 	IINField GetIIN() const;
-
-private:
-
-	APDUResponse();
 };
 
 }
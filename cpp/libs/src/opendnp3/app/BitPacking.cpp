@@ -0,0 +1,114 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "BitPacking.h"
+
+#include <assert.h>
+
+namespace opendnp3
+{
+
+void PackBits(const uint8_t* values, uint32_t count, uint8_t* dest)
+{
+	const uint32_t whole = count / 8;
+
+	for (uint32_t i = 0; i < whole; ++i)
+	{
+		dest[i] = PackBitsInByte(values + 8 * i);
+	}
+
+	const uint32_t remainder = count % 8;
+
+	if (remainder > 0)
+	{
+		uint8_t last = 0;
+		for (uint32_t bit = 0; bit < remainder; ++bit)
+		{
+			if (values[8 * whole + bit])
+			{
+				last |= (1 << bit);
+			}
+		}
+		dest[whole] = last;
+	}
+}
+
+void UnpackBits(const openpal::RSlice& buffer, uint32_t position, uint32_t count, uint8_t* values)
+{
+	assert(((position + count + 7) / 8) <= buffer.Size());
+
+	uint32_t i = 0;
+
+	// leading bits up to a byte boundary
+	while (i < count && ((position + i) % 8) != 0)
+	{
+		const uint32_t pos = position + i;
+		values[i] = (buffer[pos / 8] >> (pos % 8)) & 0x01;
+		++i;
+	}
+
+	// whole bytes, 8 values at a time
+	while ((count - i) >= 8)
+	{
+		UnpackBitsFromByte(buffer[(position + i) / 8], values + i);
+		i += 8;
+	}
+
+	// trailing bits
+	while (i < count)
+	{
+		const uint32_t pos = position + i;
+		values[i] = (buffer[pos / 8] >> (pos % 8)) & 0x01;
+		++i;
+	}
+}
+
+void UnpackDoubleBits(const openpal::RSlice& buffer, uint32_t position, uint32_t count, uint8_t* values)
+{
+	assert(((position + count + 3) / 4) <= buffer.Size());
+
+	uint32_t i = 0;
+
+	while (i < count && ((position + i) % 4) != 0)
+	{
+		const uint32_t pos = position + i;
+		values[i] = (buffer[pos / 4] >> (2 * (pos % 4))) & 0x03;
+		++i;
+	}
+
+	while ((count - i) >= 4)
+	{
+		const uint8_t byte = buffer[(position + i) / 4];
+		values[i] = byte & 0x03;
+		values[i + 1] = (byte >> 2) & 0x03;
+		values[i + 2] = (byte >> 4) & 0x03;
+		values[i + 3] = (byte >> 6) & 0x03;
+		i += 4;
+	}
+
+	while (i < count)
+	{
+		const uint32_t pos = position + i;
+		values[i] = (buffer[pos / 4] >> (2 * (pos % 4))) & 0x03;
+		++i;
+	}
+}
+
+}
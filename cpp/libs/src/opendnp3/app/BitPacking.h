@@ -0,0 +1,101 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_BITPACKING_H
+#define OPENDNP3_BITPACKING_H
+
+#include <openpal/container/RSlice.h>
+
+#include <cstdint>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace opendnp3
+{
+
+/**
+* Bulk conversion between DNP3 bitfields (LSB first) and arrays of one byte per value.
+*
+* Eight values are converted per step using a 64-bit multiply (or PEXT/PDEP when the
+* target supports BMI2) instead of one shift and mask per point.
+*/
+namespace bitpacking
+{
+const uint64_t LANE_LSB = 0x0101010101010101ULL;
+
+inline uint64_t LoadLE64(const uint8_t* src)
+{
+	return static_cast<uint64_t>(src[0]) |
+	       (static_cast<uint64_t>(src[1]) << 8) |
+	       (static_cast<uint64_t>(src[2]) << 16) |
+	       (static_cast<uint64_t>(src[3]) << 24) |
+	       (static_cast<uint64_t>(src[4]) << 32) |
+	       (static_cast<uint64_t>(src[5]) << 40) |
+	       (static_cast<uint64_t>(src[6]) << 48) |
+	       (static_cast<uint64_t>(src[7]) << 56);
+}
+
+inline void StoreLE64(uint64_t value, uint8_t* dest)
+{
+	for (int i = 0; i < 8; ++i)
+	{
+		dest[i] = static_cast<uint8_t>(value >> (8 * i));
+	}
+}
+}
+
+/// Pack 8 values (each 0 or 1) into a single byte, the first value in the least significant bit
+inline uint8_t PackBitsInByte(const uint8_t* values)
+{
+	const uint64_t lanes = bitpacking::LoadLE64(values) & bitpacking::LANE_LSB;
+#if defined(__BMI2__)
+	return static_cast<uint8_t>(_pext_u64(lanes, bitpacking::LANE_LSB));
+#else
+	// lane i lands on bit 56 + i and no two partial products overlap
+	return static_cast<uint8_t>((lanes * 0x0102040810204080ULL) >> 56);
+#endif
+}
+
+/// Expand a byte into 8 values (each 0 or 1), the least significant bit first
+inline void UnpackBitsFromByte(uint8_t byte, uint8_t* values)
+{
+#if defined(__BMI2__)
+	bitpacking::StoreLE64(_pdep_u64(byte, bitpacking::LANE_LSB), values);
+#else
+	// broadcast the byte to every lane, isolate bit i in lane i, then collapse each lane to 0 or 1
+	const uint64_t selected = (byte * bitpacking::LANE_LSB) & 0x8040201008040201ULL;
+	bitpacking::StoreLE64(((selected + 0x7F7F7F7F7F7F7F7FULL) >> 7) & bitpacking::LANE_LSB, values);
+#endif
+}
+
+/// Pack 'count' values into 'dest' starting at bit 0. Unused bits of the final byte are cleared.
+void PackBits(const uint8_t* values, uint32_t count, uint8_t* dest);
+
+/// Unpack 'count' bits beginning at bit 'position' of the buffer into one value per byte
+void UnpackBits(const openpal::RSlice& buffer, uint32_t position, uint32_t count, uint8_t* values);
+
+/// Unpack 'count' 2-bit fields beginning at field 'position' of the buffer into one value per byte
+void UnpackDoubleBits(const openpal::RSlice& buffer, uint32_t position, uint32_t count, uint8_t* values);
+
+}
+
+#endif
@@ -23,6 +23,8 @@
 
 #include <openpal/serialization/Format.h>
 
+#include "opendnp3/app/BitPacking.h"
+
 namespace opendnp3
 {
 
@@ -98,6 +100,50 @@ public:
 		}
 	}
 
+	/**
+	* Write a block of values (each 0 or 1), packing whole bytes at a time
+	*
+	* @return the number of values written, which is less than num if the buffer is full
+	*/
+	uint32_t Write(const uint8_t* values, uint32_t num)
+	{
+		if (!isValid)
+		{
+			return 0;
+		}
+
+		const uint32_t available = maxCount - count;
+		if (num > available)
+		{
+			num = available;
+		}
+
+		uint32_t i = 0;
+
+		// complete a partially written byte one bit at a time
+		while (i < num && (count % 8) != 0)
+		{
+			Write(values[i] != 0);
+			++i;
+		}
+
+		const uint32_t whole = ((num - i) / 8) * 8;
+		if (whole > 0)
+		{
+			PackBits(values + i, whole, static_cast<uint8_t*>(*pPosition) + (count / 8));
+			count = static_cast<typename IndexType::Type>(count + whole);
+			i += whole;
+		}
+
+		while (i < num)
+		{
+			Write(values[i] != 0);
+			++i;
+		}
+
+		return num;
+	}
+
 	bool IsValid() const
 	{
 		return isValid;
@@ -0,0 +1,308 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_FIXEDSIZECODEC_H
+#define OPENDNP3_FIXEDSIZECODEC_H
+
+#include <openpal/serialization/Serialization.h>
+#include <openpal/util/Uncopyable.h>
+
+#include "opendnp3/app/DownSampling.h"
+#include "opendnp3/app/MeasurementFactory.h"
+#include "opendnp3/app/WriteConversions.h"
+
+namespace opendnp3
+{
+
+/**
+* Maps the type of a field in a fixed size object to the serializer for its wire format
+*/
+template <class T> struct FieldFormat;
+template <> struct FieldFormat<uint8_t>
+{
+	typedef openpal::UInt8 Type;
+};
+template <> struct FieldFormat<uint16_t>
+{
+	typedef openpal::UInt16 Type;
+};
+template <> struct FieldFormat<int16_t>
+{
+	typedef openpal::Int16 Type;
+};
+template <> struct FieldFormat<uint32_t>
+{
+	typedef openpal::UInt32 Type;
+};
+template <> struct FieldFormat<int32_t>
+{
+	typedef openpal::Int32 Type;
+};
+template <> struct FieldFormat<float>
+{
+	typedef openpal::SingleFloat Type;
+};
+template <> struct FieldFormat<double>
+{
+	typedef openpal::DoubleFloat Type;
+};
+
+/// Converts a measurement value to the wire type, truncating as the generated conversions do
+template <class Source, class Target>
+struct TruncateValue : private openpal::StaticOnly
+{
+	static bool Apply(Source src, Target& target)
+	{
+		target = static_cast<Target>(src);
+		return false;
+	}
+};
+
+/// Converts a measurement value to the wire type, clamping and reporting overrange
+template <class Source, class Target>
+struct RangeCheckValue : private openpal::StaticOnly
+{
+	static bool Apply(Source src, Target& target)
+	{
+		return DownSampling<Source, Target>::Apply(src, target);
+	}
+};
+
+/**
+* Common Read/Write adapters for codecs that implement Encode/Decode on raw memory.
+*
+* The size check happens once per object and the field accesses inline into the caller.
+* Codecs are stateless, but default constructible so that iterators can hold them by value.
+*/
+template <class Codec, class GV>
+struct FixedSizeCodecBase
+{
+	typedef typename GV::Target Target;
+
+	static GroupVariationID ID()
+	{
+		return GV::ID();
+	}
+
+	static uint32_t Size()
+	{
+		return GV::Size();
+	}
+
+	static bool Write(const Target& value, openpal::WSlice& dest)
+	{
+		if (dest.Size() < GV::Size())
+		{
+			return false;
+		}
+
+		Codec::Encode(value, dest);
+		dest.Advance(GV::Size());
+		return true;
+	}
+
+	static bool Read(openpal::RSlice& src, Target& value)
+	{
+		if (src.Size() < GV::Size())
+		{
+			return false;
+		}
+
+		Codec::Decode(src, value);
+		src.Advance(GV::Size());
+		return true;
+	}
+};
+
+/// flags
+template <class GV, class Factory>
+struct FlagsCodec : FixedSizeCodecBase<FlagsCodec<GV, Factory>, GV>
+{
+	static void Encode(const typename GV::Target& value, uint8_t* dest)
+	{
+		dest[0] = value.flags.value;
+	}
+
+	static void Decode(const uint8_t* src, typename GV::Target& value)
+	{
+		value = Factory::From(src[0]);
+	}
+};
+
+/// flags, 48-bit time
+template <class GV, class Factory>
+struct FlagsTimeCodec : FixedSizeCodecBase<FlagsTimeCodec<GV, Factory>, GV>
+{
+	static void Encode(const typename GV::Target& value, uint8_t* dest)
+	{
+		dest[0] = value.flags.value;
+		openpal::UInt48::Write(dest + 1, value.time);
+	}
+
+	static void Decode(const uint8_t* src, typename GV::Target& value)
+	{
+		value = Factory::From(src[0], DNPTime(openpal::UInt48::Read(src + 1)));
+	}
+};
+
+/// value
+template <class GV, class Factory, template <class, class> class Conversion>
+struct ValueCodec : FixedSizeCodecBase<ValueCodec<GV, Factory, Conversion>, GV>
+{
+	typedef typename GV::ValueType ValueType;
+	typedef typename FieldFormat<ValueType>::Type Format;
+
+	static void Encode(const typename GV::Target& value, uint8_t* dest)
+	{
+		ValueType wire;
+		Conversion<typename GV::Target::Type, ValueType>::Apply(value.value, wire);
+		Format::Write(dest, wire);
+	}
+
+	static void Decode(const uint8_t* src, typename GV::Target& value)
+	{
+		value = Factory::From(Format::Read(src));
+	}
+};
+
+/// flags, value. Values out of range set the OVERRANGE flag (0x20) when range checked.
+template <class GV, class Factory, template <class, class> class Conversion>
+struct FlagsValueCodec : FixedSizeCodecBase<FlagsValueCodec<GV, Factory, Conversion>, GV>
+{
+	typedef typename GV::ValueType ValueType;
+	typedef typename FieldFormat<ValueType>::Type Format;
+
+	static void Encode(const typename GV::Target& value, uint8_t* dest)
+	{
+		ValueType wire;
+		const bool overrange = Conversion<typename GV::Target::Type, ValueType>::Apply(value.value, wire);
+		dest[0] = overrange ? (value.flags.value | 0x20) : value.flags.value;
+		Format::Write(dest + 1, wire);
+	}
+
+	static void Decode(const uint8_t* src, typename GV::Target& value)
+	{
+		value = Factory::From(src[0], Format::Read(src + 1));
+	}
+};
+
+/// flags, value, 48-bit time
+template <class GV, class Factory, template <class, class> class Conversion>
+struct FlagsValueTimeCodec : FixedSizeCodecBase<FlagsValueTimeCodec<GV, Factory, Conversion>, GV>
+{
+	typedef typename GV::ValueType ValueType;
+	typedef typename FieldFormat<ValueType>::Type Format;
+
+	static void Encode(const typename GV::Target& value, uint8_t* dest)
+	{
+		ValueType wire;
+		const bool overrange = Conversion<typename GV::Target::Type, ValueType>::Apply(value.value, wire);
+		dest[0] = overrange ? (value.flags.value | 0x20) : value.flags.value;
+		Format::Write(dest + 1, wire);
+		openpal::UInt48::Write(dest + 1 + Format::SIZE, value.time);
+	}
+
+	static void Decode(const uint8_t* src, typename GV::Target& value)
+	{
+		value = Factory::From(src[0], Format::Read(src + 1), DNPTime(openpal::UInt48::Read(src + 1 + Format::SIZE)));
+	}
+};
+
+/**
+* Compile-time encoder/decoder for a fixed size object (GV) and its measurement type.
+*
+* The common measurement variations are specialized below so that encoding and decoding
+* inline into the range iterators and parsers. Every other variation falls back to the
+* generated ReadTarget/WriteTarget functions, still without dispatch through a function pointer.
+*/
+template <class GV>
+struct FixedSizeCodec : FixedSizeCodecBase<FixedSizeCodec<GV>, GV>
+{
+	static void Encode(const typename GV::Target& value, uint8_t* dest)
+	{
+		openpal::WSlice slice(dest, GV::Size());
+		GV::WriteTarget(value, slice);
+	}
+
+	static void Decode(const uint8_t* src, typename GV::Target& value)
+	{
+		openpal::RSlice slice(src, GV::Size());
+		GV::ReadTarget(slice, value);
+	}
+};
+
+// Group 1 - 4
+template <> struct FixedSizeCodec<Group1Var2> : FlagsCodec<Group1Var2, BinaryFactory> {};
+template <> struct FixedSizeCodec<Group2Var1> : FlagsCodec<Group2Var1, BinaryFactory> {};
+template <> struct FixedSizeCodec<Group2Var2> : FlagsTimeCodec<Group2Var2, BinaryFactory> {};
+template <> struct FixedSizeCodec<Group3Var2> : FlagsCodec<Group3Var2, DoubleBitBinaryFactory> {};
+template <> struct FixedSizeCodec<Group4Var1> : FlagsCodec<Group4Var1, DoubleBitBinaryFactory> {};
+template <> struct FixedSizeCodec<Group4Var2> : FlagsTimeCodec<Group4Var2, DoubleBitBinaryFactory> {};
+
+// Group 10 / 11
+template <> struct FixedSizeCodec<Group10Var2> : FlagsCodec<Group10Var2, BinaryOutputStatusFactory> {};
+template <> struct FixedSizeCodec<Group11Var1> : FlagsCodec<Group11Var1, BinaryOutputStatusFactory> {};
+template <> struct FixedSizeCodec<Group11Var2> : FlagsTimeCodec<Group11Var2, BinaryOutputStatusFactory> {};
+
+// Group 20 / 21 / 22
+template <> struct FixedSizeCodec<Group20Var1> : FlagsValueCodec<Group20Var1, CounterFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group20Var2> : FlagsValueCodec<Group20Var2, CounterFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group20Var5> : ValueCodec<Group20Var5, CounterFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group20Var6> : ValueCodec<Group20Var6, CounterFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group21Var1> : FlagsValueCodec<Group21Var1, FrozenCounterFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group21Var5> : FlagsValueTimeCodec<Group21Var5, FrozenCounterFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group22Var1> : FlagsValueCodec<Group22Var1, CounterFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group22Var2> : FlagsValueCodec<Group22Var2, CounterFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group22Var5> : FlagsValueTimeCodec<Group22Var5, CounterFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group22Var6> : FlagsValueTimeCodec<Group22Var6, CounterFactory, TruncateValue> {};
+
+// Group 30 / 32
+template <> struct FixedSizeCodec<Group30Var1> : FlagsValueCodec<Group30Var1, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group30Var2> : FlagsValueCodec<Group30Var2, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group30Var3> : ValueCodec<Group30Var3, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group30Var4> : ValueCodec<Group30Var4, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group30Var5> : FlagsValueCodec<Group30Var5, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group30Var6> : FlagsValueCodec<Group30Var6, AnalogFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group32Var1> : FlagsValueCodec<Group32Var1, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group32Var2> : FlagsValueCodec<Group32Var2, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group32Var3> : FlagsValueTimeCodec<Group32Var3, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group32Var4> : FlagsValueTimeCodec<Group32Var4, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group32Var5> : FlagsValueCodec<Group32Var5, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group32Var6> : FlagsValueCodec<Group32Var6, AnalogFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group32Var7> : FlagsValueTimeCodec<Group32Var7, AnalogFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group32Var8> : FlagsValueTimeCodec<Group32Var8, AnalogFactory, TruncateValue> {};
+
+// Group 40 / 42
+template <> struct FixedSizeCodec<Group40Var1> : FlagsValueCodec<Group40Var1, AnalogOutputStatusFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group40Var2> : FlagsValueCodec<Group40Var2, AnalogOutputStatusFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group40Var3> : FlagsValueCodec<Group40Var3, AnalogOutputStatusFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group40Var4> : FlagsValueCodec<Group40Var4, AnalogOutputStatusFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group42Var1> : FlagsValueCodec<Group42Var1, AnalogOutputStatusFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group42Var2> : FlagsValueCodec<Group42Var2, AnalogOutputStatusFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group42Var3> : FlagsValueTimeCodec<Group42Var3, AnalogOutputStatusFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group42Var4> : FlagsValueTimeCodec<Group42Var4, AnalogOutputStatusFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group42Var5> : FlagsValueCodec<Group42Var5, AnalogOutputStatusFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group42Var6> : FlagsValueCodec<Group42Var6, AnalogOutputStatusFactory, TruncateValue> {};
+template <> struct FixedSizeCodec<Group42Var7> : FlagsValueTimeCodec<Group42Var7, AnalogOutputStatusFactory, RangeCheckValue> {};
+template <> struct FixedSizeCodec<Group42Var8> : FlagsValueTimeCodec<Group42Var8, AnalogOutputStatusFactory, TruncateValue> {};
+
+}
+
+#endif
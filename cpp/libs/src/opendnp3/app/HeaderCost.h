@@ -0,0 +1,69 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_HEADERCOST_H
+#define OPENDNP3_HEADERCOST_H
+
+#include <openpal/util/Uncopyable.h>
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Encoded sizes of object headers, used by the outstation to choose between
+* start-stop qualifiers and index-prefixed qualifiers for a run of points
+*/
+class HeaderCost : private openpal::StaticOnly
+{
+public:
+
+	/// group, variation and qualifier
+	static const uint32_t OBJECT_HEADER_SIZE = 3;
+
+	/// size of a start-stop header (0x00 / 0x01) carrying 'count' objects
+	static uint32_t StartStop(uint32_t indexSize, uint32_t count, uint32_t objectSize)
+	{
+		return OBJECT_HEADER_SIZE + 2 * indexSize + count * objectSize;
+	}
+
+	/// size of a count header with index prefixes (0x17 / 0x28) carrying 'count' objects
+	static uint32_t CountWithPrefix(uint32_t prefixSize, uint32_t count, uint32_t objectSize)
+	{
+		return OBJECT_HEADER_SIZE + prefixSize + count * (prefixSize + objectSize);
+	}
+
+	/// the smallest start-stop index size that can represent the range [start, stop]
+	static uint32_t StartStopIndexSize(uint16_t start, uint16_t stop)
+	{
+		return (start <= 255 && stop <= 255) ? 1 : 2;
+	}
+
+	/// the smallest prefix size that can represent 'count' objects with a largest index of 'maxIndex'
+	static uint32_t PrefixSize(uint32_t count, uint16_t maxIndex)
+	{
+		return (count <= 255 && maxIndex <= 255) ? 1 : 2;
+	}
+};
+
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include "opendnp3/app/CountWriteIterator.h"
 #include "opendnp3/app/PrefixedWriteIterator.h"
 #include "opendnp3/app/BitfieldRangeWriteIterator.h"
+#include "opendnp3/app/FixedSizeCodec.h"
 
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/GroupVariationID.h"
@@ -51,6 +52,9 @@ public:
 	template <class IndexType, class WriteType>
 	RangeWriteIterator<IndexType, WriteType> IterateOverRange(QualifierCode qc, const DNP3Serializer<WriteType>& serializer, typename IndexType::Type start);
 
+	template <class IndexType, class GV>
+	RangeWriteIterator<IndexType, typename GV::Target, FixedSizeCodec<GV>> IterateOverFixedSizeRange(QualifierCode qc, typename IndexType::Type start);
+
 	template <class IndexType>
 	bool WriteRangeHeader(QualifierCode qc, GroupVariationID gvId, typename IndexType::Type start, typename IndexType::Type stop);
 
@@ -77,6 +81,9 @@ public:
 	template <class PrefixType, class WriteType>
 	PrefixedWriteIterator<PrefixType, WriteType> IterateOverCountWithPrefix(QualifierCode qc, const DNP3Serializer<WriteType>& serializer);
 
+	template <class PrefixType, class GV>
+	PrefixedWriteIterator<PrefixType, typename GV::Target, FixedSizeCodec<GV>> IterateOverFixedSizeCountWithPrefix(QualifierCode qc);
+
 	template <class PrefixType, class WriteType, class CTOType>
 	PrefixedWriteIterator<PrefixType, WriteType> IterateOverCountWithPrefixAndCTO(QualifierCode qc, const DNP3Serializer<WriteType>& serializer, const CTOType& cto);
 
@@ -183,6 +190,19 @@ RangeWriteIterator<IndexType, WriteType> HeaderWriter::IterateOverRange(Qualifie
 	else return RangeWriteIterator<IndexType, WriteType>::Null();
 }
 
+template <class IndexType, class GV>
+RangeWriteIterator<IndexType, typename GV::Target, FixedSizeCodec<GV>> HeaderWriter::IterateOverFixedSizeRange(QualifierCode qc, typename IndexType::Type start)
+{
+	typedef RangeWriteIterator<IndexType, typename GV::Target, FixedSizeCodec<GV>> Iterator;
+
+	uint32_t reserveSize = 2 * IndexType::SIZE + GV::Size();
+	if (this->WriteHeaderWithReserve(GV::ID(), qc, reserveSize))
+	{
+		return Iterator(start, FixedSizeCodec<GV>(), *position);
+	}
+	else return Iterator::Null();
+}
+
 template <class CountType, class WriteType>
 CountWriteIterator<CountType, WriteType> HeaderWriter::IterateOverCount(QualifierCode qc, const DNP3Serializer<WriteType>& serializer)
 {
@@ -216,6 +236,19 @@ PrefixedWriteIterator<PrefixType, WriteType> HeaderWriter::IterateOverCountWithP
 	else return PrefixedWriteIterator<PrefixType, WriteType>::Null();
 }
 
+template <class PrefixType, class GV>
+PrefixedWriteIterator<PrefixType, typename GV::Target, FixedSizeCodec<GV>> HeaderWriter::IterateOverFixedSizeCountWithPrefix(QualifierCode qc)
+{
+	typedef PrefixedWriteIterator<PrefixType, typename GV::Target, FixedSizeCodec<GV>> Iterator;
+
+	uint32_t reserveSize = 2 * PrefixType::SIZE + GV::Size(); //enough space for the count, 1 prefix + object
+	if (this->WriteHeaderWithReserve(GV::ID(), qc, reserveSize))
+	{
+		return Iterator(FixedSizeCodec<GV>(), *position);
+	}
+	else return Iterator::Null();
+}
+
 template <class PrefixType, class WriteType, class CTOType>
 PrefixedWriteIterator<PrefixType, WriteType> HeaderWriter::IterateOverCountWithPrefixAndCTO(QualifierCode qc, const DNP3Serializer<WriteType>& serializer, const CTOType& cto)
 {
@@ -27,7 +27,9 @@ namespace opendnp3
 {
 
 // A facade for writing APDUs to an external buffer
-template <class PrefixType, class WriteType>
+//
+// The serializer is either a runtime openpal::Serializer or a compile-time FixedSizeCodec
+template <class PrefixType, class WriteType, class SerializerType = openpal::Serializer<WriteType>>
 class PrefixedWriteIterator
 {
 public:
@@ -44,7 +46,7 @@ public:
 		pPosition(nullptr)
 	{}
 
-	PrefixedWriteIterator(const openpal::Serializer<WriteType>& serializer_, openpal::WSlice& position) :
+	PrefixedWriteIterator(const SerializerType& serializer_, openpal::WSlice& position) :
 		serializer(serializer_),
 		sizeOfTypePlusIndex(serializer.Size() + PrefixType::SIZE),
 		count(0),
@@ -88,7 +90,7 @@ public:
 
 private:
 
-	openpal::Serializer<WriteType> serializer;
+	SerializerType serializer;
 	uint32_t sizeOfTypePlusIndex;
 
 	typename PrefixType::Type count;
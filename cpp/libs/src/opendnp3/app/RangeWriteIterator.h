@@ -28,7 +28,10 @@ namespace opendnp3
 {
 
 // A facade for writing APDUs to an external buffer
-template <class IndexType, class WriteType>
+//
+// The serializer is either a runtime openpal::Serializer or a compile-time FixedSizeCodec,
+// the latter also enabling the bulk Write below.
+template <class IndexType, class WriteType, class SerializerType = openpal::Serializer<WriteType>>
 class RangeWriteIterator
 {
 public:
@@ -41,7 +44,7 @@ public:
 	RangeWriteIterator() : start(0), count(0), isValid(false), pPosition(nullptr)
 	{}
 
-	RangeWriteIterator(typename IndexType::Type start_, const openpal::Serializer<WriteType>& serializer_, openpal::WSlice& position) :
+	RangeWriteIterator(typename IndexType::Type start_, const SerializerType& serializer_, openpal::WSlice& position) :
 		start(start_),
 		serializer(serializer_),
 		count(0),
@@ -79,6 +82,42 @@ public:
 		}
 	}
 
+	/**
+	* Encode up to 'num' values, obtained from getValue(i), in a single pass with one capacity check.
+	* Only available with a compile-time codec.
+	*
+	* @return the number of values written, which is less than num if the buffer or range is full
+	*/
+	template <class GetValue>
+	uint32_t Write(uint32_t num, const GetValue& getValue)
+	{
+		if (!isValid)
+		{
+			return 0;
+		}
+
+		const uint32_t SIZE = SerializerType::Size();
+		const uint32_t byIndex = (static_cast<uint32_t>(IndexType::Max) + 1) - count;
+		const uint32_t bySpace = pPosition->Size() / SIZE;
+		const uint32_t available = (byIndex < bySpace) ? byIndex : bySpace;
+
+		if (num > available)
+		{
+			num = available;
+		}
+
+		uint8_t* dest = *pPosition;
+		for (uint32_t i = 0; i < num; ++i)
+		{
+			SerializerType::Encode(getValue(i), dest);
+			dest += SIZE;
+		}
+
+		pPosition->Advance(num * SIZE);
+		count += num;
+		return num;
+	}
+
 	bool IsValid() const
 	{
 		return isValid;
@@ -87,7 +126,7 @@ public:
 private:
 
 	typename IndexType::Type start;
-	openpal::Serializer<WriteType> serializer;
+	SerializerType serializer;
 	uint32_t count;
 
 	bool isValid;
@@ -31,7 +31,9 @@ class TxBuffer
 {
 public:
 
-	TxBuffer(uint32_t maxTxSize) : buffer(maxTxSize)
+	TxBuffer(uint32_t maxTxSize, bool doubleBuffered = false) :
+		buffer(maxTxSize),
+		spare(doubleBuffered ? maxTxSize : 0)
 	{}
 
 	APDUResponse Start()
@@ -40,6 +42,19 @@ public:
 		return response;
 	}
 
+	/// Start a response in the spare buffer, leaving the last response untouched. Requires double buffering.
+	APDUResponse StartSpare()
+	{
+		APDUResponse response(spare.GetWSlice());
+		return response;
+	}
+
+	/// Exchange the active and spare buffers so that a response started with StartSpare() can be transmitted
+	void Swap()
+	{
+		buffer.Swap(spare);
+	}
+
 	void Record(const AppControlField& control, const openpal::RSlice& view)
 	{
 		this->control = control;
@@ -62,6 +77,7 @@ private:
 	AppControlField control;
 
 	openpal::Buffer buffer;
+	openpal::Buffer spare;
 };
 
 }
@@ -0,0 +1,100 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_BITFIELDCOLLECTION_H
+#define OPENDNP3_BITFIELDCOLLECTION_H
+
+#include "opendnp3/app/parsing/ICollection.h"
+#include "opendnp3/app/Indexed.h"
+#include "opendnp3/app/BitPacking.h"
+
+namespace opendnp3
+{
+
+/**
+* A collection over a packed bitfield (single or double bit) that unpacks the values in batches
+* rather than extracting each value individually as it is visited.
+*/
+template <class T, class ConvertFunc>
+class BitfieldCollection : public ICollection<Indexed<T>>
+{
+	typedef void (*UnpackFun)(const openpal::RSlice& buffer, uint32_t position, uint32_t count, uint8_t* values);
+
+	static const uint32_t BATCH_SIZE = 64;
+
+public:
+
+	BitfieldCollection(const openpal::RSlice& buffer, uint16_t start, uint32_t count, UnpackFun unpack, const ConvertFunc& convert) :
+		buffer(buffer),
+		START(start),
+		COUNT(count),
+		unpack(unpack),
+		convert(convert)
+	{}
+
+	virtual size_t Count() const override final
+	{
+		return COUNT;
+	}
+
+	virtual void Foreach(IVisitor<Indexed<T>>& visitor) const override final
+	{
+		uint8_t values[BATCH_SIZE];
+
+		uint32_t pos = 0;
+		while (pos < COUNT)
+		{
+			const uint32_t num = ((COUNT - pos) < BATCH_SIZE) ? (COUNT - pos) : BATCH_SIZE;
+
+			unpack(buffer, pos, num, values);
+
+			for (uint32_t i = 0; i < num; ++i)
+			{
+				visitor.OnValue(WithIndex(convert(values[i]), static_cast<uint16_t>(START + pos + i)));
+			}
+
+			pos += num;
+		}
+	}
+
+private:
+
+	openpal::RSlice buffer;
+	const uint16_t START;
+	const uint32_t COUNT;
+	UnpackFun unpack;
+	ConvertFunc convert;
+};
+
+template <class T, class ConvertFunc>
+BitfieldCollection<T, ConvertFunc> CreateBitfieldCollection(const openpal::RSlice& buffer, uint16_t start, uint32_t count, const ConvertFunc& convert)
+{
+	return BitfieldCollection<T, ConvertFunc>(buffer, start, count, &UnpackBits, convert);
+}
+
+template <class T, class ConvertFunc>
+BitfieldCollection<T, ConvertFunc> CreateDoubleBitfieldCollection(const openpal::RSlice& buffer, uint16_t start, uint32_t count, const ConvertFunc& convert)
+{
+	return BitfieldCollection<T, ConvertFunc>(buffer, start, count, &UnpackDoubleBits, convert);
+}
+
+}
+
+#endif
@@ -31,6 +31,7 @@
 #include "opendnp3/app/parsing/ParserSettings.h"
 
 #include "opendnp3/app/parsing/BufferedCollection.h"
+#include "opendnp3/app/FixedSizeCodec.h"
 
 namespace opendnp3
 {
@@ -104,7 +105,7 @@ void CountIndexParser::InvokeCountOf(const HeaderRecord& record, uint16_t count,
 	{
 		Indexed<typename Descriptor::Target> pair;
 		pair.index = numparser.ReadNum(buffer);
-		Descriptor::ReadTarget(buffer, pair.value);
+		FixedSizeCodec<Descriptor>::Read(buffer, pair.value);
 		return pair;
 	};
 
@@ -33,6 +33,8 @@
 
 #include "opendnp3/app/Range.h"
 #include "opendnp3/app/parsing/BufferedCollection.h"
+#include "opendnp3/app/FixedSizeCodec.h"
+#include "opendnp3/app/parsing/BitfieldCollection.h"
 
 
 namespace opendnp3
@@ -121,7 +123,7 @@ void RangeParser::InvokeRangeOf(const HeaderRecord& record, const Range& range,
 	auto read = [range](openpal::RSlice & buffer, uint32_t pos)
 	{
 		typename Descriptor::Target target;
-		Descriptor::ReadTarget(buffer, target);
+		FixedSizeCodec<Descriptor>::Read(buffer, target);
 		return WithIndex(target, range.start + pos);
 	};
 
@@ -160,13 +162,12 @@ void RangeParser::InvokeRangeBitfieldType(const HeaderRecord& record, const Rang
 {
 	const uint32_t COUNT = range.Count();
 
-	auto read = [range](openpal::RSlice & buffer, uint32_t pos) -> Indexed<Type>
+	auto convert = [](uint8_t value) -> Type
 	{
-		Type value(GetBit(buffer, pos));
-		return WithIndex(value, range.start + pos);
+		return Type(value != 0);
 	};
 
-	auto collection = CreateBufferedCollection<Indexed<Type>>(buffer, COUNT, read);
+	auto collection = CreateBitfieldCollection<Type>(buffer, range.start, COUNT, convert);
 
 	handler.OnHeader(RangeHeader(record, range), collection);
 }
@@ -183,13 +184,12 @@ void RangeParser::InvokeRangeDoubleBitfieldType(const HeaderRecord& record, cons
 {
 	const uint32_t COUNT = range.Count();
 
-	auto read = [range](openpal::RSlice & buffer, uint32_t pos) -> Indexed<Type>
+	auto convert = [](uint8_t value) -> Type
 	{
-		Type value(GetDoubleBit(buffer, pos));
-		return WithIndex(value, range.start + pos);
+		return Type(DoubleBitFromType(value));
 	};
 
-	auto collection = CreateBufferedCollection<Indexed<Type>>(buffer, COUNT, read);
+	auto collection = CreateDoubleBitfieldCollection<Type>(buffer, range.start, COUNT, convert);
 
 	handler.OnHeader(RangeHeader(record, range), collection);
 }
@@ -54,12 +54,15 @@ LinkContext::LinkContext(
 	isRemoteReset(false),
 	keepAliveTimeout(false),
 	lastMessageTimestamp(executor->GetTime()),
+	rtt(config.Timeout, config.MinTimeout, config.Timeout),
 	pPriState(&PLLS_Idle::Instance()),
 	pSecState(&SLLS_NotReset::Instance()),
 	listener(listener),
 	upper(upper),
 	pSession(&session)
-{}
+{
+	this->statistics.responseTimeoutMs = static_cast<uint32_t>(config.Timeout.GetMilliseconds());
+}
 
 bool LinkContext::OnLowerLayerUp()
 {
@@ -102,6 +105,12 @@ bool LinkContext::OnLowerLayerDown()
 	rspTimeoutTimer.Cancel();
 	keepAliveTimer.Cancel();
 
+	// the next session may take a different path to the remote
+	rtt.Reset();
+	isRttSampleValid = isRetransmission = false;
+	statistics.smoothedRttMs = statistics.rttVarianceMs = 0;
+	statistics.responseTimeoutMs = static_cast<uint32_t>(config.Timeout.GetMilliseconds());
+
 	pPriState = &PLLS_Idle::Instance();
 	pSecState = &SLLS_NotReset::Instance();
 
@@ -228,6 +237,7 @@ void LinkContext::QueueRequestLinkStatus()
 void LinkContext::ResetRetry()
 {
 	this->numRetryRemaining = config.NumRetry;
+	this->isRetransmission = false;
 }
 
 bool LinkContext::Retry()
@@ -235,6 +245,7 @@ bool LinkContext::Retry()
 	if (numRetryRemaining > 0)
 	{
 		--numRetryRemaining;
+		this->isRetransmission = true;
 		return true;
 	}
 	else
@@ -248,6 +259,11 @@ void LinkContext::PushDataUp(const openpal::RSlice& data)
 	upper->OnReceive(data);
 }
 
+void LinkContext::PushBroadcastUp(const openpal::RSlice& data)
+{
+	upper->OnReceiveBroadcast(data);
+}
+
 void LinkContext::CompleteSendOperation(bool success)
 {
 	this->pSegments = nullptr;
@@ -293,6 +309,12 @@ void LinkContext::OnKeepAliveTimeout()
 
 void LinkContext::OnResponseTimeout()
 {
+	if (config.AdaptiveTimeout)
+	{
+		this->rtt.OnTimeout();
+		this->statistics.responseTimeoutMs = static_cast<uint32_t>(rtt.GetTimeout().GetMilliseconds());
+	}
+
 	this->pPriState = &(this->pPriState->OnTimeout(*this));
 
 	this->TryStartTransmission();
@@ -300,8 +322,12 @@ void LinkContext::OnResponseTimeout()
 
 void LinkContext::StartResponseTimer()
 {
+	this->rspTimerStart = executor->GetTime();
+	this->isRttSampleValid = !this->isRetransmission;
+	this->isRetransmission = false;
+
 	rspTimeoutTimer.Start(
-	    TimeDuration(config.Timeout),
+	    config.AdaptiveTimeout ? rtt.GetTimeout() : config.Timeout,
 	    [this]()
 	{
 		this->OnResponseTimeout();
@@ -309,6 +335,26 @@ void LinkContext::StartResponseTimer()
 	);
 }
 
+void LinkContext::SampleResponseTime()
+{
+	if (!this->isRttSampleValid)
+	{
+		return;
+	}
+
+	this->isRttSampleValid = false;
+
+	const auto now = executor->GetTime();
+	this->rtt.OnSample(TimeDuration::Milliseconds(now.milliseconds - rspTimerStart.milliseconds));
+
+	this->statistics.smoothedRttMs = static_cast<uint32_t>(rtt.GetSmoothedRTT().GetMilliseconds());
+	this->statistics.rttVarianceMs = static_cast<uint32_t>(rtt.GetVariance().GetMilliseconds());
+	if (config.AdaptiveTimeout)
+	{
+		this->statistics.responseTimeoutMs = static_cast<uint32_t>(rtt.GetTimeout().GetMilliseconds());
+	}
+}
+
 void LinkContext::StartKeepAliveTimer(const MonotonicTimestamp& expiration)
 {
 	auto callback = [this]()
@@ -353,6 +399,19 @@ bool LinkContext::OnFrame(const LinkHeaderFields& header, const openpal::RSlice&
 	// reset the keep-alive timestamp
 	this->lastMessageTimestamp = this->executor->GetTime();
 
+	if (IsBroadcastAddress(header.dest))
+	{
+		// broadcasts are never answered at the link layer, so only unconfirmed user data is meaningful
+		if (header.func == LinkFunction::PRI_UNCONFIRMED_USER_DATA)
+		{
+			this->PushBroadcastUp(userdata);
+			return true;
+		}
+
+		FORMAT_LOG_BLOCK(logger, flags::WARN, "Ignoring broadcast frame with function: %s", LinkFunctionToString(header.func));
+		return false;
+	}
+
 	switch (header.func)
 	{
 	case(LinkFunction::SEC_ACK) :
@@ -396,7 +455,7 @@ bool LinkContext::Validate(bool isMaster, uint16_t src, uint16_t dest)
 		return false;
 	}
 
-	if (dest != config.LocalAddr)
+	if (dest != config.LocalAddr && !(IsBroadcastAddress(dest) && !config.IsMaster))
 	{
 		++statistics.numUnknownDestination;
 		SIMPLE_LOG_BLOCK(logger, flags::WARN, "Frame for unknown destintation");
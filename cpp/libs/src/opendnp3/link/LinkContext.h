@@ -35,6 +35,7 @@
 #include "opendnp3/link/ILinkListener.h"
 #include "opendnp3/link/ILinkTx.h"
 #include "opendnp3/StackStatistics.h"
+#include "opendnp3/RTTEstimator.h"
 
 namespace opendnp3
 {
@@ -100,11 +101,13 @@ public:
 	void ResetRetry();
 	bool Retry();
 	void PushDataUp(const openpal::RSlice& data);
+	void PushBroadcastUp(const openpal::RSlice& data);
 	void CompleteSendOperation(bool success);
 	void TryStartTransmission();
 	void OnKeepAliveTimeout();
 	void OnResponseTimeout();
 	void StartResponseTimer();
+	void SampleResponseTime();
 	void StartKeepAliveTimer(const openpal::MonotonicTimestamp& expiration);
 	void CancelTimer();
 	void FailKeepAlive(bool timeout);
@@ -138,6 +141,12 @@ public:
 	openpal::MonotonicTimestamp lastMessageTimestamp;
 	StackStatistics::Link statistics;
 
+	// round trip time of confirmed frames, only sampled when the frame wasn't retransmitted
+	RTTEstimator rtt;
+	openpal::MonotonicTimestamp rspTimerStart;
+	bool isRetransmission = false;
+	bool isRttSampleValid = false;
+
 	ILinkTx* linktx = nullptr;
 
 	PriStateBase* pPriState;
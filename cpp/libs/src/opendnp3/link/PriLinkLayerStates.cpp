@@ -224,6 +224,7 @@ PriStateBase& PLLS_ResetLinkWait::OnAck(LinkContext& ctx, bool rxBuffFull)
 {
 	ctx.isRemoteReset = true;
 	ctx.ResetWriteFCB();
+	ctx.SampleResponseTime();
 	ctx.CancelTimer();
 	auto buffer = ctx.FormatPrimaryBufferWithConfirmed(ctx.pSegments->GetSegment(), ctx.nextWriteFCB);
 	ctx.QueueTransmit(buffer, true);
@@ -263,6 +264,7 @@ PLLS_ConfDataWait PLLS_ConfDataWait::instance;
 PriStateBase& PLLS_ConfDataWait::OnAck(LinkContext& ctx, bool rxBuffFull)
 {
 	ctx.ToggleWriteFCB();
+	ctx.SampleResponseTime();
 	ctx.CancelTimer();
 
 	if (ctx.pSegments->Advance())
@@ -282,6 +284,8 @@ PriStateBase& PLLS_ConfDataWait::OnNack(LinkContext& ctx, bool rxBuffFull)
 {
 	ctx.listener->OnStateChange(opendnp3::LinkStatus::UNRESET);
 
+	ctx.SampleResponseTime();
+
 	if (rxBuffFull)
 	{
 		return Failure(ctx);
@@ -329,6 +333,7 @@ PLLS_RequestLinkStatusWait PLLS_RequestLinkStatusWait::instance;
 
 PriStateBase& PLLS_RequestLinkStatusWait::OnNack(LinkContext& ctx, bool)
 {
+	ctx.SampleResponseTime();
 	ctx.CancelTimer();
 	ctx.FailKeepAlive(false);
 	return PLLS_Idle::Instance();
@@ -336,6 +341,7 @@ PriStateBase& PLLS_RequestLinkStatusWait::OnNack(LinkContext& ctx, bool)
 
 PriStateBase& PLLS_RequestLinkStatusWait::OnLinkStatus(LinkContext& ctx, bool)
 {
+	ctx.SampleResponseTime();
 	ctx.CancelTimer();
 	ctx.CompleteKeepAlive();
 	return PLLS_Idle::Instance();
@@ -343,6 +349,7 @@ PriStateBase& PLLS_RequestLinkStatusWait::OnLinkStatus(LinkContext& ctx, bool)
 
 PriStateBase& PLLS_RequestLinkStatusWait::OnNotSupported(LinkContext& ctx, bool)
 {
+	ctx.SampleResponseTime();
 	ctx.CancelTimer();
 	ctx.FailKeepAlive(false);
 	return PLLS_Idle::Instance();
@@ -0,0 +1,151 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_CACHINGSOEHANDLER_H
+#define OPENDNP3_CACHINGSOEHANDLER_H
+
+#include "opendnp3/master/ISOEHandler.h"
+#include "opendnp3/master/MeasurementCache.h"
+
+#include <memory>
+
+namespace opendnp3
+{
+
+/**
+* Writes measurements into the master's last-value cache before forwarding them to the user's handler.
+*
+* Each object header is a single write to the cache's sequence lock, so readers never wait on the user's callbacks.
+*/
+class CachingSOEHandler final : public ISOEHandler
+{
+public:
+
+	CachingSOEHandler(const std::shared_ptr<MeasurementCache>& cache, const std::shared_ptr<ISOEHandler>& handler) :
+		cache(cache),
+		handler(handler)
+	{}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override
+	{
+		this->CacheAndForward(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override
+	{
+		this->CacheAndForward(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override
+	{
+		this->CacheAndForward(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override
+	{
+		this->CacheAndForward(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override
+	{
+		this->CacheAndForward(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override
+	{
+		this->CacheAndForward(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override
+	{
+		this->CacheAndForward(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override
+	{
+		this->CacheAndForward(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<SecurityStat>>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void BeginResponse(MasterTaskType type, TaskId id) override
+	{
+		this->handler->BeginResponse(type, id);
+	}
+
+	virtual void EndResponse(MasterTaskType type, TaskId id, bool success) override
+	{
+		this->handler->EndResponse(type, id, success);
+	}
+
+protected:
+
+	virtual void Start() override
+	{
+		Transaction::Start(this->handler.get());
+	}
+
+	virtual void End() override
+	{
+		Transaction::End(this->handler.get());
+	}
+
+private:
+
+	template <class T>
+	void CacheAndForward(const HeaderInfo& info, const ICollection<Indexed<T>>& values)
+	{
+		this->cache->BeginUpdate();
+		this->cache->Update(values);
+		this->cache->EndUpdate();
+
+		this->handler->Process(info, values);
+	}
+
+	const std::shared_ptr<MeasurementCache> cache;
+	const std::shared_ptr<ISOEHandler> handler;
+};
+
+}
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "CoalescedPollTask.h"
+
+#include "opendnp3/master/MasterScheduler.h"
+
+using namespace openpal;
+
+namespace opendnp3
+{
+
+CoalescedPollTask::CoalescedPollTask(
+    IMasterApplication& app,
+    ISOEHandler& soeHandler,
+    openpal::Logger logger,
+    bool groupFragments,
+    MasterScheduler& scheduler,
+    std::vector<std::shared_ptr<IMasterTask>>&& members
+) :
+	PollTaskBase(app, soeHandler, MonotonicTimestamp(0), logger, TaskConfig::Default(), groupFragments),
+	pScheduler(&scheduler),
+	members(std::move(members))
+{}
+
+bool CoalescedPollTask::BuildRequest(APDURequest& request, uint8_t seq)
+{
+	rxCount = 0;
+	request.SetFunction(FunctionCode::READ);
+	request.SetControl(AppControlField::Request(seq));
+	auto writer = request.GetWriter();
+
+	for (auto& task : members)
+	{
+		if (!task->WriteHeaders(writer))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void CoalescedPollTask::OnStart()
+{
+	for (auto& task : members)
+	{
+		task->OnStart();
+	}
+
+	this->Initialize();
+}
+
+IMasterTask::TaskState CoalescedPollTask::OnPollComplete(TaskCompletion result, openpal::MonotonicTimestamp now)
+{
+	for (auto& task : members)
+	{
+		task->Complete(result, now);
+
+		// when the layer closes, recurring tasks are rescheduled when it comes back up
+		if (task->IsRecurring() && result != TaskCompletion::FAILURE_NO_COMMS)
+		{
+			pScheduler->Schedule(task);
+		}
+	}
+
+	members.clear();
+
+	return TaskState::Infinite();
+}
+
+}
@@ -0,0 +1,102 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_COALESCEDPOLLTASK_H
+#define OPENDNP3_COALESCEDPOLLTASK_H
+
+#include "opendnp3/master/PollTaskBase.h"
+#include "opendnp3/master/TaskPriority.h"
+
+#include <memory>
+#include <vector>
+
+namespace opendnp3
+{
+
+class MasterScheduler;
+
+/**
+* A single READ request carrying the object headers of several coalescable poll tasks that were due at the same time.
+*
+* Measurements flow to the shared ISOEHandler as usual. The start and the result of the request are reported to every
+* member as if it had executed alone, and recurring members are returned to the scheduler when the request completes.
+*/
+class CoalescedPollTask final : public PollTaskBase
+{
+
+public:
+
+	CoalescedPollTask(
+	    IMasterApplication& app,
+	    ISOEHandler& soeHandler,
+	    openpal::Logger logger,
+	    bool groupFragments,
+	    MasterScheduler& scheduler,
+	    std::vector<std::shared_ptr<IMasterTask>>&& members
+	);
+
+	virtual int Priority() const override
+	{
+		return priority::USER_POLL;
+	}
+
+	virtual bool BuildRequest(APDURequest& request, uint8_t seq) override;
+
+	virtual bool BlocksLowerPriority() const override
+	{
+		return false;
+	}
+
+	virtual bool IsRecurring() const override
+	{
+		return false;
+	}
+
+	virtual bool IsEnabled() const override
+	{
+		return true;
+	}
+
+	virtual void OnStart() override;
+
+	size_t NumMembers() const
+	{
+		return members.size();
+	}
+
+private:
+
+	virtual IMasterTask::TaskState OnPollComplete(TaskCompletion result, openpal::MonotonicTimestamp now) override;
+
+	// the members notify the user themselves
+	virtual void NotifyResult(TaskCompletion result) override {}
+
+	virtual MasterTaskType GetTaskType() const override
+	{
+		return MasterTaskType::USER_TASK;
+	}
+
+	MasterScheduler* pScheduler;
+	std::vector<std::shared_ptr<IMasterTask>> members;
+};
+
+}
+
+#endif
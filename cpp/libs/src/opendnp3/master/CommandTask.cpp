@@ -62,12 +62,14 @@ void CommandTask::LoadSelectAndOperate()
 	functionCodes.clear();
 	functionCodes.push_back(FunctionCode::SELECT);
 	functionCodes.push_back(FunctionCode::OPERATE);
+	operateFunction = FunctionCode::OPERATE;
 }
 
 void CommandTask::LoadDirectOperate()
 {
 	functionCodes.clear();
 	functionCodes.push_back(FunctionCode::DIRECT_OPERATE);
+	operateFunction = FunctionCode::DIRECT_OPERATE;
 }
 
 bool CommandTask::BuildRequest(APDURequest& request, uint8_t seq)
@@ -74,6 +74,11 @@ public:
 
 	virtual bool BuildRequest(APDURequest& request, uint8_t seq) override final;
 
+	virtual FunctionCode OperateFunction() const override final
+	{
+		return operateFunction;
+	}
+
 private:
 
 	virtual bool IsEnabled() const override final
@@ -98,6 +103,7 @@ private:
 	void LoadDirectOperate();
 
 	std::deque<FunctionCode> functionCodes;
+	FunctionCode operateFunction = FunctionCode::UNKNOWN;
 
 	CommandStatus statusResult;
 	CommandCallbackT commandCallback;
@@ -57,8 +57,8 @@ using namespace openpal;
 namespace opendnp3
 {
 
-EventScanTask::EventScanTask(IMasterApplication& application, ISOEHandler& soeHandler, ClassField classes_, TimeDuration retryPeriod_, openpal::Logger logger) :
-	PollTaskBase(application, soeHandler, MonotonicTimestamp::Max(), logger, TaskConfig::Default()),
+EventScanTask::EventScanTask(IMasterApplication& application, ISOEHandler& soeHandler, ClassField classes_, TimeDuration retryPeriod_, openpal::Logger logger, bool groupFragments) :
+	PollTaskBase(application, soeHandler, MonotonicTimestamp::Max(), logger, TaskConfig::Default(), groupFragments),
 	classes(classes_.OnlyEventClasses()),
 	retryPeriod(retryPeriod_)
 {
@@ -76,7 +76,7 @@ bool EventScanTask::IsEnabled() const
 	return classes.HasEventClass();
 }
 
-IMasterTask::TaskState EventScanTask::OnTaskComplete(TaskCompletion result, openpal::MonotonicTimestamp now)
+IMasterTask::TaskState EventScanTask::OnPollComplete(TaskCompletion result, openpal::MonotonicTimestamp now)
 {
 	switch (result)
 	{
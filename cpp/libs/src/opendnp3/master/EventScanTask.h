@@ -38,7 +38,7 @@ class EventScanTask final : public PollTaskBase
 
 public:
 
-	EventScanTask(IMasterApplication& application, ISOEHandler& soeHandler, ClassField classes, openpal::TimeDuration retryPeriod, openpal::Logger logger);
+	EventScanTask(IMasterApplication& application, ISOEHandler& soeHandler, ClassField classes, openpal::TimeDuration retryPeriod, openpal::Logger logger, bool groupFragments);
 
 	virtual bool IsRecurring() const override
 	{
@@ -70,7 +70,7 @@ private:
 
 	virtual bool IsEnabled() const override;
 
-	virtual IMasterTask::TaskState OnTaskComplete(TaskCompletion result, openpal::MonotonicTimestamp now) override;
+	virtual IMasterTask::TaskState OnPollComplete(TaskCompletion result, openpal::MonotonicTimestamp now) override;
 
 };
 
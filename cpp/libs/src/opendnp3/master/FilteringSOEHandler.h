@@ -0,0 +1,246 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_FILTERINGSOEHANDLER_H
+#define OPENDNP3_FILTERINGSOEHANDLER_H
+
+#include "opendnp3/master/ISOEHandler.h"
+#include "opendnp3/app/parsing/Collections.h"
+#include "opendnp3/StackStatistics.h"
+
+#include <memory>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* Removes static values that haven't changed since they were last delivered before forwarding them to the user's handler.
+*
+* A compact shadow of the value and flags of every point is kept per measurement type. Points seen for the first
+* time and points whose value or flags differ from the shadow are forwarded, the rest are only counted. Events are
+* never filtered, but they refresh the shadow so that a subsequent integrity poll doesn't deliver them a second time.
+*/
+class FilteringSOEHandler final : public ISOEHandler
+{
+	template <class T>
+	struct Shadow
+	{
+		typename T::Type value;
+		uint8_t flags;
+		bool seen;
+	};
+
+	template <class T>
+	struct Table
+	{
+		std::vector<Shadow<T>> shadows;
+
+		// reused between headers so that filtering doesn't allocate in steady state
+		std::vector<Indexed<T>> changes;
+
+		void Clear()
+		{
+			shadows.clear();
+		}
+	};
+
+public:
+
+	explicit FilteringSOEHandler(const std::shared_ptr<ISOEHandler>& handler) : handler(handler)
+	{}
+
+	/// Forget every delivered value, e.g. when the session closes
+	void Reset()
+	{
+		binaries.Clear();
+		doubleBinaries.Clear();
+		analogs.Clear();
+		counters.Clear();
+		frozenCounters.Clear();
+		binaryOutputStatii.Clear();
+		analogOutputStatii.Clear();
+	}
+
+	StackStatistics::Master GetStatistics() const
+	{
+		return statistics;
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override
+	{
+		this->FilterAndForward(info, values, binaries);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override
+	{
+		this->FilterAndForward(info, values, doubleBinaries);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override
+	{
+		this->FilterAndForward(info, values, analogs);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override
+	{
+		this->FilterAndForward(info, values, counters);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override
+	{
+		this->FilterAndForward(info, values, frozenCounters);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override
+	{
+		this->FilterAndForward(info, values, binaryOutputStatii);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override
+	{
+		this->FilterAndForward(info, values, analogOutputStatii);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<SecurityStat>>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override
+	{
+		this->handler->Process(info, values);
+	}
+
+	virtual void BeginResponse(MasterTaskType type, TaskId id) override
+	{
+		this->handler->BeginResponse(type, id);
+	}
+
+	virtual void EndResponse(MasterTaskType type, TaskId id, bool success) override
+	{
+		this->handler->EndResponse(type, id, success);
+	}
+
+protected:
+
+	virtual void Start() override
+	{
+		Transaction::Start(this->handler.get());
+	}
+
+	virtual void End() override
+	{
+		Transaction::End(this->handler.get());
+	}
+
+private:
+
+	/// update the shadow, returning true if the point is new or its value or flags changed
+	template <class T>
+	static bool Update(Table<T>& table, const Indexed<T>& item)
+	{
+		if (item.index >= table.shadows.size())
+		{
+			table.shadows.resize(static_cast<size_t>(item.index) + 1, Shadow<T> { typename T::Type(), 0, false });
+		}
+
+		auto& shadow = table.shadows[item.index];
+
+		if (shadow.seen && (shadow.value == item.value.value) && (shadow.flags == item.value.flags.value))
+		{
+			return false;
+		}
+
+		shadow.value = item.value.value;
+		shadow.flags = item.value.flags.value;
+		shadow.seen = true;
+		return true;
+	}
+
+	template <class T>
+	void FilterAndForward(const HeaderInfo& info, const ICollection<Indexed<T>>& values, Table<T>& table)
+	{
+		if (info.isEventVariation)
+		{
+			values.ForeachItem([&table](const Indexed<T>& item)
+			{
+				Update(table, item);
+			});
+			this->handler->Process(info, values);
+			return;
+		}
+
+		table.changes.clear();
+		values.ForeachItem([&table](const Indexed<T>& item)
+		{
+			if (Update(table, item))
+			{
+				table.changes.push_back(item);
+			}
+		});
+
+		const auto numChanged = table.changes.size();
+		this->statistics.numStaticForwarded += static_cast<uint32_t>(numChanged);
+		this->statistics.numStaticSuppressed += static_cast<uint32_t>(values.Count() - numChanged);
+
+		if (numChanged > 0)
+		{
+			ArrayCollection<Indexed<T>> changes(table.changes.data(), numChanged);
+			this->handler->Process(info, changes);
+		}
+	}
+
+	const std::shared_ptr<ISOEHandler> handler;
+
+	StackStatistics::Master statistics;
+
+	Table<Binary> binaries;
+	Table<DoubleBitBinary> doubleBinaries;
+	Table<Analog> analogs;
+	Table<Counter> counters;
+	Table<FrozenCounter> frozenCounters;
+	Table<BinaryOutputStatus> binaryOutputStatii;
+	Table<AnalogOutputStatus> analogOutputStatii;
+};
+
+}
+
+#endif
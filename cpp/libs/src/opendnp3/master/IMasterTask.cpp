@@ -66,16 +66,13 @@ IMasterTask::ResponseResult IMasterTask::OnResponse(const APDUResponseHeader& re
 	switch (result)
 	{
 	case(ResponseResult::ERROR_BAD_RESPONSE) :
-		this->state = this->OnTaskComplete(TaskCompletion::FAILURE_BAD_RESPONSE, now);
-		this->NotifyResult(TaskCompletion::FAILURE_BAD_RESPONSE);
+		this->Complete(TaskCompletion::FAILURE_BAD_RESPONSE, now);
 		break;
 	case(ResponseResult::ERROR_INTERNAL_FAILURE) :
-		this->state = this->OnTaskComplete(TaskCompletion::FAILURE_INTERNAL_ERROR, now);
-		this->NotifyResult(TaskCompletion::FAILURE_INTERNAL_ERROR);
+		this->Complete(TaskCompletion::FAILURE_INTERNAL_ERROR, now);
 		break;
 	case(ResponseResult::OK_FINAL) :
-		this->state = this->OnTaskComplete(TaskCompletion::SUCCESS, now);
-		this->NotifyResult(TaskCompletion::SUCCESS);
+		this->Complete(TaskCompletion::SUCCESS, now);
 		break;
 	default:
 		break;
@@ -86,44 +83,43 @@ IMasterTask::ResponseResult IMasterTask::OnResponse(const APDUResponseHeader& re
 
 void IMasterTask::OnResponseTimeout(openpal::MonotonicTimestamp now)
 {
-	this->state = this->OnTaskComplete(TaskCompletion::FAILURE_RESPONSE_TIMEOUT, now);
-	this->NotifyResult(TaskCompletion::FAILURE_RESPONSE_TIMEOUT);
+	this->Complete(TaskCompletion::FAILURE_RESPONSE_TIMEOUT, now);
 }
 
 void IMasterTask::OnLowerLayerClose(openpal::MonotonicTimestamp now)
 {
-	this->state = this->OnTaskComplete(TaskCompletion::FAILURE_NO_COMMS, now);
-	this->NotifyResult(TaskCompletion::FAILURE_NO_COMMS);
+	this->Complete(TaskCompletion::FAILURE_NO_COMMS, now);
 }
 
 void IMasterTask::OnStartTimeout(openpal::MonotonicTimestamp now)
 {
-	this->state = this->OnTaskComplete(TaskCompletion::FAILURE_START_TIMEOUT, now);
-	this->NotifyResult(TaskCompletion::FAILURE_START_TIMEOUT);
+	this->Complete(TaskCompletion::FAILURE_START_TIMEOUT, now);
 }
 
 void IMasterTask::OnNoUser(openpal::MonotonicTimestamp now)
 {
-	this->state = this->OnTaskComplete(TaskCompletion::FAILURE_NO_USER, now);
-	this->NotifyResult(TaskCompletion::FAILURE_NO_USER);
+	this->Complete(TaskCompletion::FAILURE_NO_USER, now);
 }
 
 void IMasterTask::OnInternalError(openpal::MonotonicTimestamp now)
 {
-	this->state = this->OnTaskComplete(TaskCompletion::FAILURE_INTERNAL_ERROR, now);
-	this->NotifyResult(TaskCompletion::FAILURE_INTERNAL_ERROR);
+	this->Complete(TaskCompletion::FAILURE_INTERNAL_ERROR, now);
 }
 
 void IMasterTask::OnAuthenticationFailure(openpal::MonotonicTimestamp now)
 {
-	this->state = this->OnTaskComplete(TaskCompletion::FAILURE_BAD_AUTHENTICATION, now);
-	this->NotifyResult(TaskCompletion::FAILURE_BAD_AUTHENTICATION);
+	this->Complete(TaskCompletion::FAILURE_BAD_AUTHENTICATION, now);
 }
 
 void IMasterTask::OnAuthorizationFailure(openpal::MonotonicTimestamp now)
 {
-	this->state = this->OnTaskComplete(TaskCompletion::FAILURE_NOT_AUTHORIZED, now);
-	this->NotifyResult(TaskCompletion::FAILURE_NOT_AUTHORIZED);
+	this->Complete(TaskCompletion::FAILURE_NOT_AUTHORIZED, now);
+}
+
+void IMasterTask::Complete(TaskCompletion result, openpal::MonotonicTimestamp now)
+{
+	this->state = this->OnTaskComplete(result, now);
+	this->NotifyResult(result);
 }
 
 void IMasterTask::NotifyResult(TaskCompletion result)
@@ -156,6 +156,35 @@ public:
 	 */
 	virtual bool BuildRequest(APDURequest& request, uint8_t seq) = 0;
 
+	/**
+	* Indicates if the task is a READ whose object headers may be merged into another task's request
+	*/
+	virtual bool IsCoalescable() const
+	{
+		return false;
+	}
+
+	/**
+	* Write only the object headers of the request. Only called on tasks that are coalescable.
+	*/
+	virtual bool WriteHeaders(HeaderWriter& writer)
+	{
+		return false;
+	}
+
+	/**
+	* Indicates if the task can be abandoned between the fragments of its response so that a command can run
+	*/
+	virtual bool IsPreemptible() const
+	{
+		return false;
+	}
+
+	/**
+	* Called when the task is abandoned at a fragment boundary. It is rescheduled and starts over later.
+	*/
+	virtual void OnPreempted() {}
+
 	/**
 	 * Handler for responses
 	 */
@@ -196,16 +225,39 @@ public:
 	*/
 	void OnAuthorizationFailure(openpal::MonotonicTimestamp now);
 
+	/**
+	* Complete the task with a result that was determined elsewhere, e.g. by a request it was coalesced into
+	*/
+	void Complete(TaskCompletion result, openpal::MonotonicTimestamp now);
+
 	/**
 	* Called when the task first starts, before the first request is formatted
 	*/
-	void OnStart();
+	virtual void OnStart();
 
 	/**
 	* Demand that the task run immediately by setting the expiration to 0
 	*/
 	void Demand();
 
+	MasterTaskType TaskType() const
+	{
+		return GetTaskType();
+	}
+
+	TaskId GetTaskId() const
+	{
+		return config.taskId;
+	}
+
+	/**
+	* The function code that executes the commands of the task, UNKNOWN if the task does not operate
+	*/
+	virtual FunctionCode OperateFunction() const
+	{
+		return FunctionCode::UNKNOWN;
+	}
+
 protected:
 
 	// called during OnStart() to initialize any state for a new run
@@ -228,7 +280,7 @@ protected:
 	bool ValidateNoObjects(const openpal::RSlice& objects);
 	bool ValidateInternalIndications(const APDUResponseHeader& header);
 
-	void NotifyResult(TaskCompletion result);
+	virtual void NotifyResult(TaskCompletion result);
 
 private:
 
@@ -22,6 +22,9 @@
 #define OPENDNP3_ITASKLOCK_H
 
 #include <openpal/util/Uncopyable.h>
+#include <cstdint>
+#include <openpal/executor/MonotonicTimestamp.h>
+#include <openpal/executor/TimeDuration.h>
 
 #include "opendnp3/master/IScheduleCallback.h"
 
@@ -42,6 +45,18 @@ public:
 	/// Release a lock
 	virtual bool Release(IScheduleCallback&) = 0;
 
+	/// Set the relative share of the channel given to a master by locks that schedule the channel
+	virtual void SetWeight(IScheduleCallback&, uint16_t weight) {}
+
+	/// Report the outcome of a request made while holding the lock, and the bus time it consumed
+	virtual void OnRequestComplete(IScheduleCallback&, openpal::MonotonicTimestamp now, openpal::TimeDuration busTime, bool responded) {}
+
+	/// Forget a master that no longer uses the channel, releasing the lock if it holds it
+	virtual void Remove(IScheduleCallback& callback)
+	{
+		this->Release(callback);
+	}
+
 };
 
 class NullTaskLock final : public ITaskLock, private openpal::Uncopyable
@@ -26,6 +26,9 @@
 #include "opendnp3/app/parsing/APDUHeaderParser.h"
 #include "opendnp3/app/APDUBuilders.h"
 #include "opendnp3/master/MeasurementHandler.h"
+#include "opendnp3/master/CachingSOEHandler.h"
+#include "opendnp3/master/CoalescedPollTask.h"
+#include "opendnp3/master/TaskPriority.h"
 #include "opendnp3/master/EmptyResponseTask.h"
 #include "opendnp3/master/RestartOperationTask.h"
 #include "opendnp3/objects/Group12.h"
@@ -38,6 +41,17 @@ using namespace openpal;
 
 namespace opendnp3
 {
+
+static std::shared_ptr<ISOEHandler> CreateHandlerChain(
+    const std::shared_ptr<MeasurementCache>& cache,
+    const std::shared_ptr<FilteringSOEHandler>& filter,
+    const std::shared_ptr<ISOEHandler>& handler)
+{
+	// the cache sees every value, the filter only limits what reaches the user
+	std::shared_ptr<ISOEHandler> chain = filter ? std::static_pointer_cast<ISOEHandler>(filter) : handler;
+	return cache ? std::make_shared<CachingSOEHandler>(cache, chain) : chain;
+}
+
 MContext::MContext(
     const openpal::Logger& logger,
     const std::shared_ptr<openpal::IExecutor>& executor,
@@ -51,15 +65,19 @@ MContext::MContext(
 	executor(executor),
 	lower(lower),
 	params(params),
-	SOEHandler(SOEHandler),
+	cache(MeasurementCache::IsEnabled(params.cacheSizes) ? std::make_shared<MeasurementCache>(params.cacheSizes) : nullptr),
+	filter(params.filterUnchangedStatic ? std::make_shared<FilteringSOEHandler>(SOEHandler) : nullptr),
+	latencies(params.latencyHistograms ? std::make_shared<MasterLatencies>(params.maxTaskIdLatencyHistograms) : nullptr),
+	SOEHandler(CreateHandlerChain(cache, filter, SOEHandler)),
 	application(application),
 	pTaskLock(&taskLock),
+	rtt(params.responseTimeout, params.minResponseTimeout, params.responseTimeout),
 	responseTimer(*executor),
 	scheduleTimer(*executor),
 	taskStartTimeoutTimer(*executor),
-	tasks(params, logger, *application, *SOEHandler),
+	tasks(params, logger, *application, *this->SOEHandler),
 	scheduler(*this),
-	txBuffer(params.maxTxFragSize),
+	txBuffer(params.maxTxFragSize, params.bufferPool),
 	tstate(TaskState::IDLE)
 {}
 
@@ -71,6 +89,7 @@ bool MContext::OnLowerLayerUp()
 	}
 
 	isOnline = true;
+	pTaskLock->SetWeight(*this, params.channelWeight);
 	tasks.Initialize(scheduler);
 	this->PostCheckForTask();
 	return true;
@@ -94,7 +113,7 @@ bool MContext::OnLowerLayerDown()
 
 	tstate = TaskState::IDLE;
 
-	pTaskLock->Release(*this);
+	pTaskLock->Remove(*this);
 
 	responseTimer.Cancel();
 	taskStartTimeoutTimer.Cancel();
@@ -103,6 +122,17 @@ bool MContext::OnLowerLayerDown()
 	solSeq = unsolSeq = 0;
 	isOnline = isSending = false;
 
+	// the next session may take a different path to the outstation
+	rtt.Reset();
+
+	if (filter)
+	{
+		// the first integrity poll of the next session delivers every value
+		filter->Reset();
+	}
+
+	txBuffer.Release();
+
 	return true;
 }
 
@@ -146,9 +176,58 @@ bool MContext::OnSendResult(bool isSucccess)
 	this->isSending = false;
 	this->CheckConfirmTransmit();
 	this->CheckForTask();
+
+	if (!this->isSending)
+	{
+		// nothing else to transmit, return the buffer to the pool until the next request
+		this->txBuffer.Release();
+	}
+
 	return true;
 }
 
+StackStatistics::Master MContext::GetStatistics() const
+{
+	auto statistics = filter ? filter->GetStatistics() : StackStatistics::Master();
+	statistics.smoothedRttMs = static_cast<uint32_t>(rtt.GetSmoothedRTT().GetMilliseconds());
+	statistics.rttVarianceMs = static_cast<uint32_t>(rtt.GetVariance().GetMilliseconds());
+	statistics.responseTimeoutMs = static_cast<uint32_t>(this->GetResponseTimeout().GetMilliseconds());
+	if (latencies)
+	{
+		statistics.requestLatency = latencies->RequestLatency().Summarize();
+		auto commands = latencies->directOperate;
+		commands.Merge(latencies->selectAndOperate);
+		statistics.commandLatency = commands.Summarize();
+	}
+	return statistics;
+}
+
+uint64_t MContext::ElapsedMicros(int64_t since) const
+{
+	const auto now = executor->GetMicroseconds();
+	return (now > since) ? static_cast<uint64_t>(now - since) : 0;
+}
+
+void MContext::RecordCommandLatency(const IMasterTask& task)
+{
+	switch (task.OperateFunction())
+	{
+	case(FunctionCode::DIRECT_OPERATE) :
+		latencies->directOperate.Record(ElapsedMicros(this->taskStartMicros));
+		break;
+	case(FunctionCode::OPERATE) :
+		latencies->selectAndOperate.Record(ElapsedMicros(this->taskStartMicros));
+		break;
+	default:
+		break;
+	}
+}
+
+openpal::TimeDuration MContext::GetResponseTimeout() const
+{
+	return params.adaptiveResponseTimeout ? rtt.GetTimeout() : params.responseTimeout;
+}
+
 void MContext::CheckForTask()
 {
 	if (isOnline)
@@ -314,7 +393,7 @@ void MContext::StartResponseTimer()
 	{
 		this->OnResponseTimeout();
 	};
-	this->responseTimer.Start(this->params.responseTimeout, timeout);
+	this->responseTimer.Start(this->GetResponseTimeout(), timeout);
 }
 
 void MContext::PostCheckForTask()
@@ -328,7 +407,7 @@ void MContext::PostCheckForTask()
 
 std::shared_ptr<IMasterTask> MContext::AddScan(openpal::TimeDuration period, const HeaderBuilderT& builder, TaskConfig config)
 {
-	auto task = std::make_shared<UserPollTask>(builder, true, period, params.taskRetryPeriod, *application, *SOEHandler, logger, config);
+	auto task = std::make_shared<UserPollTask>(builder, true, period, params.taskRetryPeriod, *application, *SOEHandler, logger, config, params.groupResponseFragments);
 	this->ScheduleRecurringPollTask(task);
 	return task;
 }
@@ -362,7 +441,7 @@ std::shared_ptr<IMasterTask> MContext::AddRangeScan(GroupVariationID gvId, uint1
 
 void MContext::Scan(const HeaderBuilderT& builder, TaskConfig config)
 {
-	auto task = std::make_shared<UserPollTask>(builder, false, TimeDuration::Max(), params.taskRetryPeriod, *application, *SOEHandler, logger, config);
+	auto task = std::make_shared<UserPollTask>(builder, false, TimeDuration::Max(), params.taskRetryPeriod, *application, *SOEHandler, logger, config, params.groupResponseFragments);
 	this->ScheduleAdhocTask(task);
 }
 
@@ -469,10 +548,82 @@ MContext::TaskState MContext::BeginNewTask(const std::shared_ptr<IMasterTask>& t
 {
 	this->activeTask = task;
 	this->activeTask->OnStart();
+	this->taskStartMicros = executor->GetMicroseconds();
 	FORMAT_LOG_BLOCK(logger, flags::INFO, "Begining task: %s", this->activeTask->Name());
 	return this->ResumeActiveTask();
 }
 
+bool MContext::ShouldPreemptActiveTask(const openpal::MonotonicTimestamp& now) const
+{
+	return this->params.preemptPollsForCommands && this->activeTask->IsPreemptible() && this->scheduler.HasDueTask(now, priority::COMMAND);
+}
+
+void MContext::PreemptActiveTask(const openpal::MonotonicTimestamp& now)
+{
+	FORMAT_LOG_BLOCK(logger, flags::INFO, "Preempting task at fragment boundary: %s", this->activeTask->Name());
+
+	this->activeTask->OnPreempted();
+
+	if (!this->activeTask->IsRecurring())
+	{
+		// the task already started once, give it a fresh start timeout
+		this->activeTask->ConfigureStartExpiration(now.Add(this->params.taskStartTimeout));
+	}
+
+	// even one-shot tasks are rescheduled because they haven't completed
+	this->scheduler.Schedule(std::move(this->activeTask));
+
+	pTaskLock->Release(*this);
+	this->PostCheckForTask();
+}
+
+std::shared_ptr<IMasterTask> MContext::CoalesceDueTasks(const std::shared_ptr<IMasterTask>& task, const openpal::MonotonicTimestamp& now)
+{
+	if (!task->IsCoalescable())
+	{
+		return task;
+	}
+
+	std::vector<std::shared_ptr<IMasterTask>> due;
+	this->scheduler.TakeCoalescable(now, due);
+
+	if (due.empty())
+	{
+		return task;
+	}
+
+	// write the headers into the tx buffer to find out which of the due tasks fit into a single request
+	APDURequest request(this->txBuffer.GetWSlice());
+	auto writer = request.GetWriter();
+	const bool firstFits = task->WriteHeaders(writer);
+
+	std::vector<std::shared_ptr<IMasterTask>> members;
+	members.push_back(task);
+
+	for (auto& other : due)
+	{
+		writer.Mark();
+		if (firstFits && other->WriteHeaders(writer))
+		{
+			members.push_back(other);
+		}
+		else
+		{
+			writer.Rollback();
+			this->scheduler.Schedule(other);
+		}
+	}
+
+	if (members.size() == 1)
+	{
+		return task;
+	}
+
+	FORMAT_LOG_BLOCK(logger, flags::INFO, "Coalescing %u due polls into a single request", static_cast<unsigned int>(members.size()));
+
+	return std::make_shared<CoalescedPollTask>(*this->application, *this->SOEHandler, this->logger, this->params.groupResponseFragments, this->scheduler, std::move(members));
+}
+
 MContext::TaskState MContext::ResumeActiveTask()
 {
 	if (!this->pTaskLock->Acquire(*this))
@@ -494,6 +645,8 @@ MContext::TaskState MContext::ResumeActiveTask()
 	auto apdu = request.ToRSlice();
 	this->RecordLastRequest(apdu);
 	this->Transmit(apdu);
+	this->requestTime = executor->GetTime();
+	this->requestMicros = executor->GetMicroseconds();
 
 	return TaskState::WAIT_FOR_RESPONSE;
 }
@@ -547,11 +700,12 @@ MContext::TaskState MContext::StartTask_Idle()
 	}
 
 	MonotonicTimestamp next;
-	auto task = this->scheduler.GetNext(executor->GetTime(), next);
+	const auto now = executor->GetTime();
+	auto task = this->scheduler.GetNext(now, next);
 
 	if (task)
 	{
-		return this->BeginNewTask(task);
+		return this->BeginNewTask(this->CoalesceDueTasks(task, now));
 	}
 	else
 	{
@@ -591,8 +745,33 @@ MContext::TaskState MContext::OnResponse_WaitForResponse(const APDUResponseHeade
 
 	auto now = this->executor->GetTime();
 
+	const auto elapsed = TimeDuration::Milliseconds(now.milliseconds - this->requestTime.milliseconds);
+	if (this->params.adaptiveResponseTimeout)
+	{
+		this->rtt.OnSample(elapsed);
+	}
+	this->pTaskLock->OnRequestComplete(*this, now, elapsed, true);
+	this->requestTime = now;
+
+	if (this->latencies && header.control.FIR)
+	{
+		this->latencies->RecordRequest(this->activeTask->TaskType(), this->activeTask->GetTaskId(), ElapsedMicros(this->requestMicros));
+	}
+
 	auto result = this->activeTask->OnResponse(header, objects, now);
 
+	if (this->latencies && (result == IMasterTask::ResponseResult::OK_FINAL))
+	{
+		this->RecordCommandLatency(*this->activeTask);
+	}
+
+	if ((result == IMasterTask::ResponseResult::OK_CONTINUE) && this->ShouldPreemptActiveTask(now))
+	{
+		// the fragment isn't confirmed, the outstation abandons the rest of the response when the next request arrives
+		this->PreemptActiveTask(now);
+		return TaskState::IDLE;
+	}
+
 	if (header.control.CON)
 	{
 		this->QueueConfirm(APDUHeader::SolicitedConfirm(header.control.SEQ));
@@ -615,6 +794,11 @@ MContext::TaskState MContext::OnResponse_WaitForResponse(const APDUResponseHeade
 MContext::TaskState MContext::OnResponseTimeout_WaitForResponse()
 {
 	auto now = this->executor->GetTime();
+	if (this->params.adaptiveResponseTimeout)
+	{
+		this->rtt.OnTimeout();
+	}
+	this->pTaskLock->OnRequestComplete(*this, now, TimeDuration::Milliseconds(now.milliseconds - this->requestTime.milliseconds), false);
 	this->activeTask->OnResponseTimeout(now);
 	this->solSeq.Increment();
 	this->CompleteActiveTask();
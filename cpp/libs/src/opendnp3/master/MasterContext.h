@@ -23,10 +23,11 @@
 
 #include <openpal/executor/IExecutor.h>
 #include <openpal/logging/Logger.h>
-#include <openpal/container/Buffer.h>
 #include <openpal/executor/TimerRef.h>
 
 #include "opendnp3/LayerInterfaces.h"
+#include "opendnp3/PooledBuffer.h"
+#include "opendnp3/RTTEstimator.h"
 
 #include "opendnp3/app/AppSeqNum.h"
 #include "opendnp3/app/MeasurementTypes.h"
@@ -40,6 +41,10 @@
 #include "opendnp3/master/IMasterApplication.h"
 #include "opendnp3/master/HeaderBuilder.h"
 #include "opendnp3/master/RestartOperationResult.h"
+#include "opendnp3/master/MeasurementCache.h"
+#include "opendnp3/master/FilteringSOEHandler.h"
+#include "opendnp3/master/MasterLatencies.h"
+#include "opendnp3/StackStatistics.h"
 
 namespace opendnp3
 {
@@ -76,6 +81,9 @@ public:
 
 	// ------- configuration --------
 	MasterParams params;
+	const std::shared_ptr<MeasurementCache> cache;
+	const std::shared_ptr<FilteringSOEHandler> filter;
+	const std::shared_ptr<MasterLatencies> latencies;
 	const std::shared_ptr<ISOEHandler> SOEHandler;
 	const std::shared_ptr<IMasterApplication> application;
 	ITaskLock* pTaskLock;
@@ -87,13 +95,17 @@ public:
 	AppSeqNum solSeq;
 	AppSeqNum unsolSeq;
 	std::shared_ptr<IMasterTask> activeTask;
+	openpal::MonotonicTimestamp requestTime;
+	int64_t requestMicros = 0;
+	int64_t taskStartMicros = 0;
+	RTTEstimator rtt;
 	openpal::TimerRef responseTimer;
 	openpal::TimerRef scheduleTimer;
 	openpal::TimerRef taskStartTimeoutTimer;
 	MasterTasks tasks;
 	MasterScheduler scheduler;
 	std::deque<APDUHeader> confirmQueue;
-	openpal::Buffer txBuffer;
+	PooledBuffer txBuffer;
 	TaskState tstate;
 
 	/// --- implement  IUpperLayer ------
@@ -164,6 +176,12 @@ public:
 
 	TaskState BeginNewTask(const std::shared_ptr<IMasterTask>& task);
 
+	bool ShouldPreemptActiveTask(const openpal::MonotonicTimestamp& now) const;
+
+	void PreemptActiveTask(const openpal::MonotonicTimestamp& now);
+
+	std::shared_ptr<IMasterTask> CoalesceDueTasks(const std::shared_ptr<IMasterTask>& task, const openpal::MonotonicTimestamp& now);
+
 	TaskState ResumeActiveTask();
 
 	void CompleteActiveTask();
@@ -172,10 +190,19 @@ public:
 
 	void StartResponseTimer();
 
+	/// The fixed response timeout, or the current estimate in adaptive mode
+	openpal::TimeDuration GetResponseTimeout() const;
+
+	uint64_t ElapsedMicros(int64_t since) const;
+
+	void RecordCommandLatency(const IMasterTask& task);
+
 	void ProcessAPDU(const APDUResponseHeader& header, const openpal::RSlice& objects);
 
 	void CheckForTask();
 
+	StackStatistics::Master GetStatistics() const;
+
 	bool CheckConfirmTransmit();
 
 	void PostCheckForTask();
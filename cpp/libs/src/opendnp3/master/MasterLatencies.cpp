@@ -0,0 +1,90 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "opendnp3/master/MasterLatencies.h"
+
+namespace opendnp3
+{
+
+MasterLatencies::MasterLatencies(uint16_t maxTaskIds) : byTaskId(maxTaskIds)
+{
+
+}
+
+const openpal::Histogram& MasterLatencies::RequestLatency(MasterTaskType type) const
+{
+	return byTaskType[static_cast<uint8_t>(type) % NUM_TASK_TYPES];
+}
+
+const openpal::Histogram* MasterLatencies::RequestLatency(TaskId id) const
+{
+	if (!id.IsDefined())
+	{
+		return nullptr;
+	}
+
+	for (uint16_t i = 0; i < numTaskIds; ++i)
+	{
+		if (byTaskId[i].id == id.GetId())
+		{
+			return &byTaskId[i].latency;
+		}
+	}
+
+	return nullptr;
+}
+
+openpal::Histogram MasterLatencies::RequestLatency() const
+{
+	openpal::Histogram all;
+	for (auto& histogram : byTaskType)
+	{
+		all.Merge(histogram);
+	}
+	return all;
+}
+
+void MasterLatencies::RecordRequest(MasterTaskType type, TaskId id, uint64_t micros)
+{
+	byTaskType[static_cast<uint8_t>(type) % NUM_TASK_TYPES].Record(micros);
+
+	if (!id.IsDefined())
+	{
+		return;
+	}
+
+	for (uint16_t i = 0; i < numTaskIds; ++i)
+	{
+		if (byTaskId[i].id == id.GetId())
+		{
+			byTaskId[i].latency.Record(micros);
+			return;
+		}
+	}
+
+	if (numTaskIds < byTaskId.size())
+	{
+		byTaskId[numTaskIds].id = id.GetId();
+		byTaskId[numTaskIds].latency.Record(micros);
+		++numTaskIds;
+	}
+}
+
+}
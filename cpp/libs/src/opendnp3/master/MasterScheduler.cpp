@@ -93,6 +93,33 @@ std::shared_ptr<IMasterTask> MasterScheduler::GetNext(const MonotonicTimestamp&
 	}
 }
 
+bool MasterScheduler::HasDueTask(const openpal::MonotonicTimestamp& now, int priority) const
+{
+	auto due = [this, now, priority](const std::shared_ptr<IMasterTask>& task)
+	{
+		// lower numbers are higher priority
+		return (task->Priority() <= priority) && (task->ExpirationTime().milliseconds <= now.milliseconds) && this->m_filter->CanRun(*task);
+	};
+
+	return std::any_of(m_tasks.begin(), m_tasks.end(), due);
+}
+
+void MasterScheduler::TakeCoalescable(const openpal::MonotonicTimestamp& now, std::vector<std::shared_ptr<IMasterTask>>& tasks)
+{
+	auto take = [this, now, &tasks](const std::shared_ptr<IMasterTask>& task)
+	{
+		if (task->IsCoalescable() && (task->ExpirationTime().milliseconds <= now.milliseconds) && this->m_filter->CanRun(*task))
+		{
+			tasks.push_back(task);
+			return true;
+		}
+
+		return false;
+	};
+
+	m_tasks.erase(std::remove_if(m_tasks.begin(), m_tasks.end(), take), m_tasks.end());
+}
+
 void MasterScheduler::Shutdown(const MonotonicTimestamp& now)
 {
 	m_tasks.clear();
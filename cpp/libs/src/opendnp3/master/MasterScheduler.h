@@ -55,6 +55,16 @@ public:
 	*/
 	std::shared_ptr<IMasterTask> GetNext(const openpal::MonotonicTimestamp& now, openpal::MonotonicTimestamp& next);
 
+	/**
+	* Check if a task with at least the specified priority is due and allowed to run
+	*/
+	bool HasDueTask(const openpal::MonotonicTimestamp& now, int priority) const;
+
+	/**
+	* Remove every task that is due, allowed to run, and coalescable
+	*/
+	void TakeCoalescable(const openpal::MonotonicTimestamp& now, std::vector<std::shared_ptr<IMasterTask>>& tasks);
+
 	/**
 	* Cleanup all existing tasks & cancel any timers
 	*/
@@ -29,10 +29,10 @@ MasterTasks::MasterTasks(const MasterParams& params, const openpal::Logger& logg
 	enableUnsol(std::make_shared<EnableUnsolicitedTask>(app, params.unsolClassMask, params.taskRetryPeriod, logger)),
 	clearRestart(std::make_shared<ClearRestartTask>(app, params.taskRetryPeriod, logger)),
 	assignClass(std::make_shared<AssignClassTask>(app, params.taskRetryPeriod, logger)),
-	startupIntegrity(std::make_shared<StartupIntegrityPoll>(app, SOEHandler, params.startupIntegrityClassMask, params.taskRetryPeriod, logger)),
+	startupIntegrity(std::make_shared<StartupIntegrityPoll>(app, SOEHandler, params.startupIntegrityClassMask, params.taskRetryPeriod, logger, params.groupResponseFragments)),
 	disableUnsol(std::make_shared<DisableUnsolicitedTask>(app, params.disableUnsolOnStartup, params.taskRetryPeriod, logger)),
 	timeSync(std::make_shared<SerialTimeSyncTask>(app, logger)),
-	eventScan(std::make_shared<EventScanTask>(app, SOEHandler, params.eventScanOnEventsAvailableClassMask, params.taskRetryPeriod, logger))
+	eventScan(std::make_shared<EventScanTask>(app, SOEHandler, params.eventScanOnEventsAvailableClassMask, params.taskRetryPeriod, logger, params.groupResponseFragments))
 {
 
 }
@@ -0,0 +1,61 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "opendnp3/master/MeasurementCache.h"
+
+namespace opendnp3
+{
+
+MeasurementCache::MeasurementCache(const DatabaseSizes& sizes) :
+	version(0),
+	sequence(0),
+	binaries(sizes.numBinary),
+	doubleBinaries(sizes.numDoubleBinary),
+	analogs(sizes.numAnalog),
+	counters(sizes.numCounter),
+	frozenCounters(sizes.numFrozenCounter),
+	binaryOutputStatii(sizes.numBinaryOutputStatus),
+	analogOutputStatii(sizes.numAnalogOutputStatus),
+	timeAndIntervals(sizes.numTimeAndInterval)
+{}
+
+bool MeasurementCache::IsEnabled(const DatabaseSizes& sizes)
+{
+	return (sizes.numBinary + sizes.numDoubleBinary + sizes.numAnalog + sizes.numCounter + sizes.numFrozenCounter +
+	        sizes.numBinaryOutputStatus + sizes.numAnalogOutputStatus + sizes.numTimeAndInterval) > 0;
+}
+
+uint64_t MeasurementCache::GetSequence() const
+{
+	return this->sequence.load(std::memory_order_relaxed);
+}
+
+void MeasurementCache::BeginUpdate()
+{
+	this->version.store(this->version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+void MeasurementCache::EndUpdate()
+{
+	this->version.store(this->version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+}
@@ -29,16 +29,17 @@ using namespace openpal;
 namespace opendnp3
 {
 
-ParseResult MeasurementHandler::ProcessMeasurements(const openpal::RSlice& objects, openpal::Logger& logger, ISOEHandler* pHandler)
+ParseResult MeasurementHandler::ProcessMeasurements(const openpal::RSlice& objects, openpal::Logger& logger, ISOEHandler* pHandler, bool startTransaction)
 {
-	MeasurementHandler handler(logger, pHandler);
+	MeasurementHandler handler(logger, pHandler, startTransaction);
 	return APDUParser::Parse(objects, handler, &logger);
 }
 
-MeasurementHandler::MeasurementHandler(const openpal::Logger& logger_, ISOEHandler* pSOEHandler_) :
+MeasurementHandler::MeasurementHandler(const openpal::Logger& logger_, ISOEHandler* pSOEHandler_, bool startTransaction) :
 	logger(logger_),
 	txInitiated(false),
 	pSOEHandler(pSOEHandler_),
+	pTransactable(startTransaction ? pSOEHandler_ : nullptr),
 	ctoMode(TimestampMode::INVALID),
 	commonTimeOccurence(0)
 {
@@ -49,7 +50,7 @@ MeasurementHandler::~MeasurementHandler()
 {
 	if (txInitiated)
 	{
-		Transaction::End(pSOEHandler);
+		Transaction::End(pTransactable);
 	}
 }
 
@@ -64,7 +65,7 @@ void MeasurementHandler::CheckForTxStart()
 	if (!txInitiated)
 	{
 		txInitiated = true;
-		Transaction::Start(pSOEHandler);
+		Transaction::Start(pTransactable);
 	}
 }
 
@@ -45,8 +45,10 @@ public:
 
 	/**
 	* Static helper function for interpreting a response as a measurement response
+	*
+	* @param startTransaction if false, the caller manages the handler's transaction, e.g. across multiple fragments
 	*/
-	static ParseResult ProcessMeasurements(const openpal::RSlice& objects, openpal::Logger& logger, ISOEHandler* pHandler);
+	static ParseResult ProcessMeasurements(const openpal::RSlice& objects, openpal::Logger& logger, ISOEHandler* pHandler, bool startTransaction = true);
 
 	// TODO
 	virtual bool IsAllowed(uint32_t headerCount, GroupVariation gv, QualifierCode qc) override
@@ -59,7 +61,7 @@ public:
 	*
 	* @param logger	the Logger that the loader should use for message reporting
 	*/
-	MeasurementHandler(const openpal::Logger& logger, ISOEHandler* pSOEHandler);
+	MeasurementHandler(const openpal::Logger& logger, ISOEHandler* pSOEHandler, bool startTransaction = true);
 
 	~MeasurementHandler();
 
@@ -128,6 +130,7 @@ private:
 
 	bool txInitiated;
 	ISOEHandler* pSOEHandler;
+	ITransactable* pTransactable;
 
 	TimestampMode ctoMode;
 	DNPTime commonTimeOccurence;
@@ -20,10 +20,17 @@
  */
 #include "MultidropTaskLock.h"
 
+#include <algorithm>
+
+using namespace openpal;
+
 namespace opendnp3
 {
 
-MultidropTaskLock::MultidropTaskLock() : m_is_online(false), m_active(nullptr)
+MultidropTaskLock::MultidropTaskLock(const MultidropSchedulerConfig& config) :
+	config(config),
+	m_is_online(false),
+	m_active(nullptr)
 {
 
 }
@@ -42,15 +49,25 @@ bool MultidropTaskLock::Acquire(IScheduleCallback& callback)
 			return true;
 		}
 
-
-		this->AddIfNotContained(callback);
+		this->AddIfNotWaiting(m_sessions[&callback]);
 		return false;
 	}
-	else
+
+	// the channel is idle, but a backed off master may still have to wait for its probe time
+	this->AddIfNotWaiting(m_sessions[&callback]);
+	this->GrantNext();
+
+	if (m_active == &callback)
 	{
-		m_active = &callback;
 		return true;
 	}
+
+	if (m_active)
+	{
+		m_active->OnPendingTask();
+	}
+
+	return false;
 }
 
 bool MultidropTaskLock::Release(IScheduleCallback& callback)
@@ -67,30 +84,154 @@ bool MultidropTaskLock::Release(IScheduleCallback& callback)
 		return true;
 	}
 
-	if (m_callback_queue.empty())
+	if (this->GrantNext())
 	{
-		return true;
+		m_active->OnPendingTask();
 	}
 
-	m_active = m_callback_queue.front();
-	m_callback_queue.pop_front();
-	m_callback_set.erase(m_active);
-	m_active->OnPendingTask();
 	return true;
 }
 
-bool MultidropTaskLock::AddIfNotContained(IScheduleCallback& callback)
+void MultidropTaskLock::SetWeight(IScheduleCallback& callback, uint16_t weight)
+{
+	m_sessions[&callback].weight = std::max<uint16_t>(weight, 1);
+}
+
+void MultidropTaskLock::OnRequestComplete(IScheduleCallback& callback, MonotonicTimestamp now, TimeDuration busTime, bool responded)
+{
+	m_now = std::max(m_now, now);
+
+	auto& session = m_sessions[&callback];
+	const auto milliseconds = static_cast<double>(busTime.GetMilliseconds());
+
+	session.finish += milliseconds / session.weight;
+
+	if (responded)
+	{
+		session.latency = (session.latency < 0) ? milliseconds : session.latency + (milliseconds - session.latency) / 8;
+		session.consecutiveTimeouts = 0;
+		session.backoff = TimeDuration::Zero();
+	}
+	else
+	{
+		++session.consecutiveTimeouts;
+
+		if (this->IsBackedOff(session))
+		{
+			session.backoff = (session.backoff.GetMilliseconds() == 0) ? config.minBackoff : TimeDuration::Milliseconds(std::min(2 * session.backoff.GetMilliseconds(), config.maxBackoff.GetMilliseconds()));
+			session.probeTime = now.Add(session.backoff);
+		}
+	}
+}
+
+void MultidropTaskLock::Remove(IScheduleCallback& callback)
+{
+	// erase first so that the lock can't be granted back to the master being removed
+	m_sessions.erase(&callback);
+	this->Release(callback);
+}
+
+bool MultidropTaskLock::IsBackedOff(IScheduleCallback& callback) const
+{
+	auto iter = m_sessions.find(&callback);
+	return (iter != m_sessions.end()) && this->IsBackedOff(iter->second);
+}
+
+TimeDuration MultidropTaskLock::GetLatency(IScheduleCallback& callback) const
+{
+	auto iter = m_sessions.find(&callback);
+	if (iter == m_sessions.end() || iter->second.latency < 0)
+	{
+		return TimeDuration::Milliseconds(-1);
+	}
+	return TimeDuration::Milliseconds(static_cast<int64_t>(iter->second.latency));
+}
+
+void MultidropTaskLock::AddIfNotWaiting(Session& session)
+{
+	if (!session.waiting)
+	{
+		// a master that was idle doesn't get credit for the time it didn't use
+		session.waiting = true;
+		session.order = ++m_order;
+		session.finish = std::max(session.finish, m_virtual_time);
+	}
+}
+
+bool MultidropTaskLock::GrantNext()
 {
-	auto result = m_callback_set.find(&callback);
-	if (result != m_callback_set.end())
+	auto next = this->SelectNext();
+
+	if (next == m_sessions.end())
 	{
 		return false;
 	}
 
-	m_callback_set.insert(&callback);
-	m_callback_queue.push_back(&callback);
+	next->second.waiting = false;
+	m_virtual_time = std::max(m_virtual_time, next->second.finish);
+	m_active = next->first;
 	return true;
 }
 
+bool MultidropTaskLock::HasHealthySession() const
+{
+	for (auto& entry : m_sessions)
+	{
+		if (!this->IsBackedOff(entry.second))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+std::map<IScheduleCallback*, MultidropTaskLock::Session>::iterator MultidropTaskLock::SelectNext()
+{
+	auto best = m_sessions.end();
+	auto probe = m_sessions.end();
+
+	for (auto iter = m_sessions.begin(); iter != m_sessions.end(); ++iter)
+	{
+		const auto& session = iter->second;
+
+		if (!session.waiting)
+		{
+			continue;
+		}
+
+		if (!config.fairQueuing)
+		{
+			if (best == m_sessions.end() || session.order < best->second.order)
+			{
+				best = iter;
+			}
+			continue;
+		}
+
+		if (this->IsBackedOff(session) && session.probeTime > m_now)
+		{
+			if (probe == m_sessions.end() || session.probeTime < probe->second.probeTime)
+			{
+				probe = iter;
+			}
+			continue;
+		}
+
+		if (best == m_sessions.end() || session.finish < best->second.finish || (session.finish == best->second.finish && session.order < best->second.order))
+		{
+			best = iter;
+		}
+	}
+
+	if (best != m_sessions.end())
+	{
+		return best;
+	}
+
+	// if every master is failing, nobody else would wake them up at their probe times, so the earliest one probes now.
+	// Otherwise the channel stays idle and the backed off masters are reconsidered when the other masters use it.
+	return this->HasHealthySession() ? m_sessions.end() : probe;
 }
 
+}
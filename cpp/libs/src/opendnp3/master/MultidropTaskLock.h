@@ -22,18 +22,51 @@
 #define OPENDNP3_MULTIDROPTASKLOCK_H
 
 #include "opendnp3/master/ITaskLock.h"
+#include "opendnp3/master/MultidropSchedulerConfig.h"
 
-#include <set>
-#include <deque>
+#include <map>
 
 namespace opendnp3
 {
 
+/**
+* Task lock shared by the masters of a multidrop channel so that only one of them has a request outstanding at a time.
+*
+* By default the lock is granted in FIFO order. With fair queuing, each master is charged the bus time of its requests
+* divided by its weight and the waiting master with the least charge is granted the lock next (start-time fair queuing).
+* Masters whose outstations stop responding are demoted to a back-off schedule and are only granted the channel once
+* their probe time has passed. The lock has no clock, so probe times are checked whenever another master acquires or
+* releases it.
+*/
 class MultidropTaskLock final : public opendnp3::ITaskLock
 {
+	struct Session
+	{
+		uint16_t weight = 1;
+
+		// virtual time at which the bus time charged to this master ends
+		double finish = 0;
+
+		// FIFO order between masters with the same charge
+		uint64_t order = 0;
+		bool waiting = false;
+
+		uint32_t consecutiveTimeouts = 0;
+		openpal::TimeDuration backoff;
+		openpal::MonotonicTimestamp probeTime;
+
+		// smoothed response latency in milliseconds, negative until the first response
+		double latency = -1;
+	};
+
 public:
 
-	MultidropTaskLock();
+	explicit MultidropTaskLock(const MultidropSchedulerConfig& config = MultidropSchedulerConfig());
+
+	void Configure(const MultidropSchedulerConfig& config)
+	{
+		this->config = config;
+	}
 
 	/// these are controlled by the link layer router
 	void SetOnline()
@@ -49,15 +82,44 @@ public:
 	virtual bool Acquire(IScheduleCallback&) override;
 	virtual bool Release(IScheduleCallback&) override;
 
+	virtual void SetWeight(IScheduleCallback&, uint16_t weight) override;
+	virtual void OnRequestComplete(IScheduleCallback&, openpal::MonotonicTimestamp now, openpal::TimeDuration busTime, bool responded) override;
+	virtual void Remove(IScheduleCallback&) override;
+
+	/// True if the master's outstation has stopped responding and is only probed on the back-off schedule
+	bool IsBackedOff(IScheduleCallback&) const;
+
+	/// Smoothed response latency of the master's outstation, negative until the first response
+	openpal::TimeDuration GetLatency(IScheduleCallback&) const;
+
 private:
 
-	bool AddIfNotContained(IScheduleCallback&);
+	bool IsBackedOff(const Session& session) const
+	{
+		return config.fairQueuing && (session.consecutiveTimeouts >= config.timeoutsBeforeBackoff);
+	}
+
+	void AddIfNotWaiting(Session& session);
+
+	// select the next master and make it the active one, returns false if no master can be granted the lock
+	bool GrantNext();
+
+	bool HasHealthySession() const;
+
+	std::map<IScheduleCallback*, Session>::iterator SelectNext();
+
+	MultidropSchedulerConfig config;
 
 	bool m_is_online;
-	std::set<IScheduleCallback*> m_callback_set;
-	std::deque<IScheduleCallback*> m_callback_queue;
+	std::map<IScheduleCallback*, Session> m_sessions;
 
 	IScheduleCallback* m_active;
+
+	uint64_t m_order = 0;
+	double m_virtual_time = 0;
+
+	// the lock has no clock of its own, this is the last time reported by a master
+	openpal::MonotonicTimestamp m_now;
 };
 
 }
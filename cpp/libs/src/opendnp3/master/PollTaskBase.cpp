@@ -31,10 +31,11 @@ using namespace openpal;
 namespace opendnp3
 {
 
-PollTaskBase::PollTaskBase(IMasterApplication& application, ISOEHandler& soeHandler, openpal::MonotonicTimestamp expiration, openpal::Logger logger, TaskConfig config) :
+PollTaskBase::PollTaskBase(IMasterApplication& application, ISOEHandler& soeHandler, openpal::MonotonicTimestamp expiration, openpal::Logger logger, TaskConfig config, bool groupFragments) :
 	IMasterTask(application, expiration, logger, config),
 	rxCount(0),
-	pSOEHandler(&soeHandler)
+	pSOEHandler(&soeHandler),
+	groupFragments(groupFragments)
 {
 
 }
@@ -76,7 +77,14 @@ IMasterTask::ResponseResult PollTaskBase::ProcessMeasurements(const APDUResponse
 {
 	++rxCount;
 
-	if (MeasurementHandler::ProcessMeasurements(objects, logger, pSOEHandler) == ParseResult::OK)
+	if (groupFragments && !inGroupedResponse)
+	{
+		inGroupedResponse = true;
+		pSOEHandler->BeginResponse(this->GetTaskType(), this->GetTaskId());
+		Transaction::Start(pSOEHandler);
+	}
+
+	if (MeasurementHandler::ProcessMeasurements(objects, logger, pSOEHandler, !groupFragments) == ParseResult::OK)
 	{
 		if (header.control.FIN)
 		{
@@ -93,4 +101,26 @@ IMasterTask::ResponseResult PollTaskBase::ProcessMeasurements(const APDUResponse
 	}
 }
 
+IMasterTask::TaskState PollTaskBase::OnTaskComplete(TaskCompletion result, openpal::MonotonicTimestamp now)
+{
+	// every way a task can finish passes through here, so a grouped transaction is never left open
+	this->EndGroupedResponse(result == TaskCompletion::SUCCESS);
+	return this->OnPollComplete(result, now);
+}
+
+void PollTaskBase::OnPreempted()
+{
+	this->EndGroupedResponse(false);
+}
+
+void PollTaskBase::EndGroupedResponse(bool success)
+{
+	if (inGroupedResponse)
+	{
+		inGroupedResponse = false;
+		Transaction::End(pSOEHandler);
+		pSOEHandler->EndResponse(this->GetTaskType(), this->GetTaskId(), success);
+	}
+}
+
 } //end ns
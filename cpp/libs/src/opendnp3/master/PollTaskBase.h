@@ -38,13 +38,20 @@ class PollTaskBase : public IMasterTask, openpal::Uncopyable
 
 public:
 
-	PollTaskBase(IMasterApplication& application, ISOEHandler& soeHandler, openpal::MonotonicTimestamp expiration, openpal::Logger logger, TaskConfig config);
+	PollTaskBase(IMasterApplication& application, ISOEHandler& soeHandler, openpal::MonotonicTimestamp expiration, openpal::Logger logger, TaskConfig config, bool groupFragments);
 
 	virtual const char* Name() const override final
 	{
 		return "Application Poll";
 	};
 
+	virtual bool IsPreemptible() const override final
+	{
+		return true;
+	}
+
+	virtual void OnPreempted() override final;
+
 protected:
 
 	virtual ResponseResult ProcessResponse(const APDUResponseHeader& response, const openpal::RSlice& objects) override final;
@@ -53,8 +60,21 @@ protected:
 
 	virtual void Initialize() override final;
 
+	virtual TaskState OnTaskComplete(TaskCompletion result, openpal::MonotonicTimestamp now) override final;
+
+	/// Inherited classes define the next task state here
+	virtual TaskState OnPollComplete(TaskCompletion result, openpal::MonotonicTimestamp now) = 0;
+
 	uint16_t rxCount;
 	ISOEHandler* pSOEHandler;
+
+private:
+
+	void EndGroupedResponse(bool success);
+
+	// if true, one transaction spans all the fragments of the response
+	const bool groupFragments;
+	bool inGroupedResponse = false;
 };
 
 } //end ns
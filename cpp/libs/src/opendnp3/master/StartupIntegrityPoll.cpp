@@ -36,8 +36,8 @@ using namespace openpal;
 namespace opendnp3
 {
 
-StartupIntegrityPoll::StartupIntegrityPoll(IMasterApplication& app, ISOEHandler& soeHandler, ClassField classes_, TimeDuration retryPeriod_, openpal::Logger logger) :
-	PollTaskBase(app, soeHandler, openpal::MonotonicTimestamp(0), logger, TaskConfig::Default()),
+StartupIntegrityPoll::StartupIntegrityPoll(IMasterApplication& app, ISOEHandler& soeHandler, ClassField classes_, TimeDuration retryPeriod_, openpal::Logger logger, bool groupFragments) :
+	PollTaskBase(app, soeHandler, openpal::MonotonicTimestamp(0), logger, TaskConfig::Default(), groupFragments),
 	classes(classes_),
 	retryPeriod(retryPeriod_)
 {
@@ -57,7 +57,7 @@ bool StartupIntegrityPoll::IsEnabled() const
 	return classes.HasAnyClass();
 }
 
-IMasterTask::TaskState StartupIntegrityPoll::OnTaskComplete(TaskCompletion result, openpal::MonotonicTimestamp now)
+IMasterTask::TaskState StartupIntegrityPoll::OnPollComplete(TaskCompletion result, openpal::MonotonicTimestamp now)
 {
 	switch (result)
 	{
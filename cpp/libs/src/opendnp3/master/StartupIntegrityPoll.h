@@ -39,7 +39,7 @@ class StartupIntegrityPoll final : public PollTaskBase
 
 public:
 
-	StartupIntegrityPoll(IMasterApplication& app, ISOEHandler& soeHandler, ClassField classes, openpal::TimeDuration retryPeriod, openpal::Logger logger);
+	StartupIntegrityPoll(IMasterApplication& app, ISOEHandler& soeHandler, ClassField classes, openpal::TimeDuration retryPeriod, openpal::Logger logger, bool groupFragments);
 
 	virtual bool IsRecurring() const override
 	{
@@ -71,7 +71,7 @@ private:
 		return MasterTaskType::STARTUP_INTEGRITY_POLL;
 	}
 
-	virtual IMasterTask::TaskState OnTaskComplete(TaskCompletion result, openpal::MonotonicTimestamp now) override;
+	virtual IMasterTask::TaskState OnPollComplete(TaskCompletion result, openpal::MonotonicTimestamp now) override;
 
 };
 
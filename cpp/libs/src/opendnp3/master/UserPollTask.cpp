@@ -33,13 +33,15 @@ UserPollTask::UserPollTask(
     IMasterApplication& app,
     ISOEHandler& soeHandler,
     openpal::Logger logger,
-    TaskConfig config
+    TaskConfig config,
+    bool groupFragments
 ) :
-	PollTaskBase(app, soeHandler, openpal::MonotonicTimestamp(0), logger, config),
+	PollTaskBase(app, soeHandler, openpal::MonotonicTimestamp(0), logger, config, groupFragments),
 	builder(builder_),
 	recurring(recurring_),
 	period(period_),
-	retryDelay(retryDelay_)
+	retryDelay(retryDelay_),
+	coalesce(config.coalesce)
 {}
 
 bool UserPollTask::BuildRequest(APDURequest& request, uint8_t seq)
@@ -48,10 +50,10 @@ bool UserPollTask::BuildRequest(APDURequest& request, uint8_t seq)
 	request.SetFunction(FunctionCode::READ);
 	request.SetControl(AppControlField::Request(seq));
 	auto writer = request.GetWriter();
-	return builder(writer);
+	return this->WriteHeaders(writer);
 }
 
-IMasterTask::TaskState UserPollTask::OnTaskComplete(TaskCompletion result, openpal::MonotonicTimestamp now)
+IMasterTask::TaskState UserPollTask::OnPollComplete(TaskCompletion result, openpal::MonotonicTimestamp now)
 {
 	switch (result)
 	{
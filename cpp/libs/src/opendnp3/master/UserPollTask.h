@@ -50,7 +50,8 @@ public:
 	    IMasterApplication& app,
 	    ISOEHandler& soeHandler,
 	    openpal::Logger logger,
-	    TaskConfig config
+	    TaskConfig config,
+	    bool groupFragments
 	);
 
 	virtual int Priority() const override
@@ -60,6 +61,16 @@ public:
 
 	virtual bool BuildRequest(APDURequest& request, uint8_t seq) override;
 
+	virtual bool IsCoalescable() const override
+	{
+		return coalesce;
+	}
+
+	virtual bool WriteHeaders(HeaderWriter& writer) override
+	{
+		return builder(writer);
+	}
+
 	virtual bool BlocksLowerPriority() const override
 	{
 		return false;
@@ -77,7 +88,7 @@ public:
 
 private:
 
-	virtual IMasterTask::TaskState OnTaskComplete(TaskCompletion result, openpal::MonotonicTimestamp now) override;
+	virtual IMasterTask::TaskState OnPollComplete(TaskCompletion result, openpal::MonotonicTimestamp now) override;
 
 	virtual MasterTaskType GetTaskType() const override
 	{
@@ -89,6 +100,7 @@ private:
 	bool recurring;
 	openpal::TimeDuration period;
 	openpal::TimeDuration retryDelay;
+	bool coalesce;
 };
 
 
@@ -0,0 +1,86 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_ASYNCCOMMANDACTIONADAPTER_H
+#define OPENDNP3_ASYNCCOMMANDACTIONADAPTER_H
+
+#include "ICommandAction.h"
+
+#include "opendnp3/outstation/AsyncCommandBatch.h"
+#include "opendnp3/outstation/IAsyncCommandHandler.h"
+
+namespace opendnp3
+{
+
+/**
+* Dispatches commands to an IAsyncCommandHandler, reserving a slot in the batch for each one.
+*
+* The returned status is only a placeholder, the real status is recorded in the batch when the command completes.
+*/
+class AsyncCommandActionAdapter : public ICommandAction
+{
+
+public:
+
+	AsyncCommandActionAdapter(IAsyncCommandHandler* handler, const std::shared_ptr<AsyncCommandBatch>& batch, bool isSelect, OperateType opType);
+
+	~AsyncCommandActionAdapter();
+
+	virtual CommandStatus Action(const ControlRelayOutputBlock& command, uint16_t index) final;
+
+	virtual CommandStatus Action(const AnalogOutputInt16& command, uint16_t index) final;
+
+	virtual CommandStatus Action(const AnalogOutputInt32& command, uint16_t index) final;
+
+	virtual CommandStatus Action(const AnalogOutputFloat32& command, uint16_t index) final;
+
+	virtual CommandStatus Action(const AnalogOutputDouble64& command, uint16_t index) final;
+
+private:
+
+	template <class T>
+	CommandStatus ActionT(const T& command, uint16_t index)
+	{
+		this->CheckStart();
+		CommandCompletion completion(m_batch, m_batch->Add());
+		if (m_isSelect)
+		{
+			m_handler->Select(command, index, completion);
+		}
+		else
+		{
+			m_handler->Operate(command, index, m_opType, completion);
+		}
+		return CommandStatus::SUCCESS;
+	}
+
+	void CheckStart();
+
+	IAsyncCommandHandler* m_handler;
+	std::shared_ptr<AsyncCommandBatch> m_batch;
+	bool m_isSelect;
+	OperateType m_opType;
+	bool m_isStarted;
+
+};
+
+}
+
+#endif
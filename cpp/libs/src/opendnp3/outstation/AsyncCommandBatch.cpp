@@ -0,0 +1,135 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "AsyncCommandBatch.h"
+
+#include "opendnp3/outstation/IAsyncCommandHandler.h"
+#include "opendnp3/outstation/OutstationContext.h"
+
+namespace opendnp3
+{
+
+CommandCompletion::CommandCompletion(const std::shared_ptr<AsyncCommandBatch>& batch, uint8_t position) :
+	batch(batch),
+	position(position)
+{}
+
+void CommandCompletion::Complete(CommandStatus status) const
+{
+	AsyncCommandBatch::Complete(this->batch, this->position, status);
+}
+
+AsyncCommandBatch::AsyncCommandBatch(const std::shared_ptr<openpal::IExecutor>& executor, uint8_t maxCommands, uint32_t maxRequestSize) :
+	request(maxRequestSize),
+	executor(executor),
+	slots(maxCommands)
+{}
+
+void AsyncCommandBatch::Complete(const std::shared_ptr<AsyncCommandBatch>& batch, uint8_t position, CommandStatus status)
+{
+	auto complete = [batch, position, status]()
+	{
+		batch->OnComplete(position, status);
+	};
+
+	batch->executor->Post(complete);
+}
+
+void AsyncCommandBatch::Attach(OContext& context)
+{
+	this->context = &context;
+}
+
+void AsyncCommandBatch::Detach()
+{
+	this->context = nullptr;
+}
+
+uint8_t AsyncCommandBatch::Add()
+{
+	return this->numAdded++;
+}
+
+bool AsyncCommandBatch::IsComplete() const
+{
+	return this->numComplete == this->numAdded;
+}
+
+void AsyncCommandBatch::Timeout()
+{
+	for (uint8_t i = 0; i < this->numAdded; ++i)
+	{
+		if (!this->slots[i].isComplete)
+		{
+			this->slots[i].isComplete = true;
+			this->slots[i].status = CommandStatus::TIMEOUT;
+			++this->numComplete;
+		}
+	}
+}
+
+void AsyncCommandBatch::OnComplete(uint8_t position, CommandStatus status)
+{
+	if ((position >= this->numAdded) || this->slots[position].isComplete)
+	{
+		return;
+	}
+
+	this->slots[position].isComplete = true;
+	this->slots[position].status = status;
+	++this->numComplete;
+
+	if (this->context && this->IsComplete())
+	{
+		this->context->CheckForTaskStart();
+	}
+}
+
+CommandStatus AsyncCommandBatch::Next()
+{
+	return (this->numReplayed < this->numAdded) ? this->slots[this->numReplayed++].status : CommandStatus::UNDEFINED;
+}
+
+CommandStatus AsyncCommandBatch::Action(const ControlRelayOutputBlock& command, uint16_t index)
+{
+	return this->Next();
+}
+
+CommandStatus AsyncCommandBatch::Action(const AnalogOutputInt16& command, uint16_t index)
+{
+	return this->Next();
+}
+
+CommandStatus AsyncCommandBatch::Action(const AnalogOutputInt32& command, uint16_t index)
+{
+	return this->Next();
+}
+
+CommandStatus AsyncCommandBatch::Action(const AnalogOutputFloat32& command, uint16_t index)
+{
+	return this->Next();
+}
+
+CommandStatus AsyncCommandBatch::Action(const AnalogOutputDouble64& command, uint16_t index)
+{
+	return this->Next();
+}
+
+}
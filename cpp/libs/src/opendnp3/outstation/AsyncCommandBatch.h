@@ -0,0 +1,104 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_ASYNCCOMMANDBATCH_H
+#define OPENDNP3_ASYNCCOMMANDBATCH_H
+
+#include "opendnp3/outstation/DeferredRequest.h"
+#include "opendnp3/outstation/ICommandAction.h"
+
+#include <openpal/container/Array.h>
+#include <openpal/executor/IExecutor.h>
+
+#include <memory>
+
+namespace opendnp3
+{
+
+class OContext;
+
+/**
+* Tracks the commands from a single request that were dispatched to an IAsyncCommandHandler.
+*
+* Completions are marshalled onto the executor, so all other methods are only called from the executor.
+* Once every command has completed the batch acts as an ICommandAction that replays the recorded statuses in order.
+*/
+class AsyncCommandBatch final : public ICommandAction, private openpal::Uncopyable
+{
+	struct Slot
+	{
+		bool isComplete = false;
+		CommandStatus status = CommandStatus::UNDEFINED;
+	};
+
+public:
+
+	AsyncCommandBatch(const std::shared_ptr<openpal::IExecutor>& executor, uint8_t maxCommands, uint32_t maxRequestSize);
+
+	/// Called from any thread, posts the result to the executor
+	static void Complete(const std::shared_ptr<AsyncCommandBatch>& batch, uint8_t position, CommandStatus status);
+
+	/// Notify the context via CheckForTaskStart() once every command has completed
+	void Attach(OContext& context);
+
+	/// Ignore any future completions
+	void Detach();
+
+	/// Reserve the next slot for a command being dispatched
+	uint8_t Add();
+
+	/// True when every command that was added has completed
+	bool IsComplete() const;
+
+	/// Complete any outstanding commands with CommandStatus::TIMEOUT
+	void Timeout();
+
+	/// A copy of the request used to build the response
+	DeferredRequest request;
+
+	// ------ replay the recorded statuses ------
+
+	virtual CommandStatus Action(const ControlRelayOutputBlock& command, uint16_t index) override final;
+
+	virtual CommandStatus Action(const AnalogOutputInt16& command, uint16_t index) override final;
+
+	virtual CommandStatus Action(const AnalogOutputInt32& command, uint16_t index) override final;
+
+	virtual CommandStatus Action(const AnalogOutputFloat32& command, uint16_t index) override final;
+
+	virtual CommandStatus Action(const AnalogOutputDouble64& command, uint16_t index) override final;
+
+private:
+
+	void OnComplete(uint8_t position, CommandStatus status);
+
+	CommandStatus Next();
+
+	const std::shared_ptr<openpal::IExecutor> executor;
+	OContext* context = nullptr;
+	openpal::Array<Slot, uint8_t> slots;
+	uint8_t numAdded = 0;
+	uint8_t numComplete = 0;
+	uint8_t numReplayed = 0;
+};
+
+}
+
+#endif
@@ -29,10 +29,10 @@ using namespace openpal;
 namespace opendnp3
 {
 
-Database::Database(const DatabaseSizes& dbSizes, IEventReceiver& eventReceiver, IndexMode indexMode, StaticTypeBitField allowedClass0Types) :
+Database::Database(const DatabaseSizes& dbSizes, IEventReceiver& eventReceiver, IndexMode indexMode, StaticTypeBitField allowedClass0Types, StaticTypeBitField compactStaticTypes, bool optimizeQualifiers) :
 	eventReceiver(&eventReceiver),
 	indexMode(indexMode),
-	buffers(dbSizes, allowedClass0Types, indexMode)
+	buffers(dbSizes, allowedClass0Types, indexMode, compactStaticTypes, optimizeQualifiers)
 {
 
 }
@@ -38,7 +38,7 @@ class Database final : public IDatabase, private openpal::Uncopyable
 {
 public:
 
-	Database(const DatabaseSizes&, IEventReceiver& eventReceiver, IndexMode indexMode, StaticTypeBitField allowedClass0Types);
+	Database(const DatabaseSizes&, IEventReceiver& eventReceiver, IndexMode indexMode, StaticTypeBitField allowedClass0Types, StaticTypeBitField compactStaticTypes = StaticTypeBitField(), bool optimizeQualifiers = false);
 
 	// ------- IDatabase --------------
 
@@ -75,6 +75,16 @@ public:
 		return buffers.buffers.GetView();
 	}
 
+	uint32_t NumCompactedStaticValues() const
+	{
+		return buffers.NumCompactedStaticValues();
+	}
+
+	uint32_t NumStaticBytesSaved() const
+	{
+		return buffers.NumStaticBytesSaved();
+	}
+
 private:
 
 	template <class Spec>
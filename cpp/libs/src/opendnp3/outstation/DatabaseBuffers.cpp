@@ -22,17 +22,22 @@
 
 #include "openpal/logging/LogMacros.h"
 
+#include "openpal/util/Limits.h"
+
 #include <assert.h>
+#include <cmath>
 
 using namespace openpal;
 
 namespace opendnp3
 {
 
-DatabaseBuffers::DatabaseBuffers(const DatabaseSizes& dbSizes, StaticTypeBitField allowedClass0Types, IndexMode indexMode) :
+DatabaseBuffers::DatabaseBuffers(const DatabaseSizes& dbSizes, StaticTypeBitField allowedClass0Types, IndexMode indexMode, StaticTypeBitField compactStaticTypes, bool optimizeQualifiers) :
 	buffers(dbSizes),
 	class0(allowedClass0Types),
-	indexMode(indexMode)
+	indexMode(indexMode),
+	compactTypes(compactStaticTypes),
+	optimizeQualifiers(optimizeQualifiers)
 {
 
 }
@@ -316,6 +321,164 @@ StaticBinaryVariation DatabaseBuffers::CheckForPromotion<BinarySpec>(const Binar
 	}
 }
 
+namespace
+{
+template <class T>
+bool IsInRange(double value)
+{
+	return (value >= static_cast<double>(openpal::MinValue<T>())) && (value <= static_cast<double>(openpal::MaxValue<T>()));
+}
+
+// floating point values can only be sent as integers if nothing is lost
+bool IsIntegral(double value, bool integerConfigured)
+{
+	return integerConfigured || (std::floor(value) == value);
+}
+}
+
+template <>
+bool DatabaseBuffers::GetCompactVariation<BinarySpec>(const openpal::ArrayView<Cell<BinarySpec>, uint16_t>& view, const Range& range, StaticBinaryVariation& variation)
+{
+	// packed for every value, CheckForPromotion moves values with non-online flags to Group1Var2
+	variation = StaticBinaryVariation::Group1Var1;
+	return true;
+}
+
+template <>
+uint32_t DatabaseBuffers::SizeInBits<BinarySpec>(StaticBinaryVariation variation)
+{
+	return (variation == StaticBinaryVariation::Group1Var1) ? 1 : 8;
+}
+
+template <>
+bool DatabaseBuffers::GetCompactVariation<AnalogSpec>(const openpal::ArrayView<Cell<AnalogSpec>, uint16_t>& view, const Range& range, StaticAnalogVariation& variation)
+{
+	bool online = true;
+	bool fits16 = true;
+
+	for (uint32_t i = range.start; i <= range.stop; ++i)
+	{
+		const auto& cell = view[i];
+		const auto configured = cell.config.svariation;
+		const bool integerConfigured = (configured != StaticAnalogVariation::Group30Var5) && (configured != StaticAnalogVariation::Group30Var6);
+
+		if (!(IsIntegral(cell.value.value, integerConfigured) && IsInRange<int32_t>(cell.value.value)))
+		{
+			return false;
+		}
+
+		online = online && (cell.value.flags.value == static_cast<uint8_t>(AnalogQuality::ONLINE));
+		fits16 = fits16 && IsInRange<int16_t>(cell.value.value);
+	}
+
+	if (fits16)
+	{
+		variation = online ? StaticAnalogVariation::Group30Var4 : StaticAnalogVariation::Group30Var2;
+	}
+	else
+	{
+		variation = online ? StaticAnalogVariation::Group30Var3 : StaticAnalogVariation::Group30Var1;
+	}
+
+	return true;
+}
+
+template <>
+uint32_t DatabaseBuffers::SizeInBits<AnalogSpec>(StaticAnalogVariation variation)
+{
+	switch (variation)
+	{
+	case(StaticAnalogVariation::Group30Var2):
+		return 24;
+	case(StaticAnalogVariation::Group30Var3):
+		return 32;
+	case(StaticAnalogVariation::Group30Var4):
+		return 16;
+	case(StaticAnalogVariation::Group30Var6):
+		return 72;
+	default:
+		return 40;
+	}
+}
+
+template <>
+bool DatabaseBuffers::GetCompactVariation<CounterSpec>(const openpal::ArrayView<Cell<CounterSpec>, uint16_t>& view, const Range& range, StaticCounterVariation& variation)
+{
+	bool online = true;
+	bool fits16 = true;
+
+	for (uint32_t i = range.start; i <= range.stop; ++i)
+	{
+		const auto& cell = view[i];
+		online = online && (cell.value.flags.value == static_cast<uint8_t>(CounterQuality::ONLINE));
+		fits16 = fits16 && (cell.value.value <= openpal::MaxValue<uint16_t>());
+	}
+
+	if (fits16)
+	{
+		variation = online ? StaticCounterVariation::Group20Var6 : StaticCounterVariation::Group20Var2;
+	}
+	else
+	{
+		variation = online ? StaticCounterVariation::Group20Var5 : StaticCounterVariation::Group20Var1;
+	}
+
+	return true;
+}
+
+template <>
+uint32_t DatabaseBuffers::SizeInBits<CounterSpec>(StaticCounterVariation variation)
+{
+	switch (variation)
+	{
+	case(StaticCounterVariation::Group20Var2):
+		return 24;
+	case(StaticCounterVariation::Group20Var5):
+		return 32;
+	case(StaticCounterVariation::Group20Var6):
+		return 16;
+	default:
+		return 40;
+	}
+}
+
+template <>
+bool DatabaseBuffers::GetCompactVariation<AnalogOutputStatusSpec>(const openpal::ArrayView<Cell<AnalogOutputStatusSpec>, uint16_t>& view, const Range& range, StaticAnalogOutputStatusVariation& variation)
+{
+	bool fits16 = true;
+
+	for (uint32_t i = range.start; i <= range.stop; ++i)
+	{
+		const auto& cell = view[i];
+		const auto configured = cell.config.svariation;
+		const bool integerConfigured = (configured == StaticAnalogOutputStatusVariation::Group40Var1) || (configured == StaticAnalogOutputStatusVariation::Group40Var2);
+
+		if (!(IsIntegral(cell.value.value, integerConfigured) && IsInRange<int32_t>(cell.value.value)))
+		{
+			return false;
+		}
+
+		fits16 = fits16 && IsInRange<int16_t>(cell.value.value);
+	}
+
+	variation = fits16 ? StaticAnalogOutputStatusVariation::Group40Var2 : StaticAnalogOutputStatusVariation::Group40Var1;
+	return true;
+}
+
+template <>
+uint32_t DatabaseBuffers::SizeInBits<AnalogOutputStatusSpec>(StaticAnalogOutputStatusVariation variation)
+{
+	switch (variation)
+	{
+	case(StaticAnalogOutputStatusVariation::Group40Var2):
+		return 24;
+	case(StaticAnalogOutputStatusVariation::Group40Var4):
+		return 72;
+	default:
+		return 40;
+	}
+}
+
 Range DatabaseBuffers::RangeOf(uint16_t size)
 {
 	return size > 0 ? Range::From(0, size - 1) : Range::Invalid();
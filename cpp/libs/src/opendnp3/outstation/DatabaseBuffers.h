@@ -46,7 +46,7 @@ class DatabaseBuffers : public IStaticSelector, public IResponseLoader, public I
 {
 public:
 
-	DatabaseBuffers(const DatabaseSizes&, StaticTypeBitField allowedClass0Types, IndexMode indexMode);
+	DatabaseBuffers(const DatabaseSizes&, StaticTypeBitField allowedClass0Types, IndexMode indexMode, StaticTypeBitField compactStaticTypes = StaticTypeBitField(), bool optimizeQualifiers = false);
 
 	// ------- IStaticSelector -------------
 
@@ -69,6 +69,18 @@ public:
 	//used to unselect selected points
 	void Unselect();
 
+	/// number of static values written with a smaller variation than the configured one
+	uint32_t NumCompactedStaticValues() const
+	{
+		return numCompactedValues;
+	}
+
+	/// object bytes saved by compact static variation selection
+	uint32_t NumStaticBytesSaved() const
+	{
+		return static_cast<uint32_t>(numBitsSaved / 8);
+	}
+
 	// stores the most revent values and event information
 	StaticBuffers buffers;
 
@@ -76,6 +88,11 @@ private:
 
 	StaticTypeBitField class0;
 	IndexMode indexMode;
+	StaticTypeBitField compactTypes;
+	bool optimizeQualifiers;
+
+	uint32_t numCompactedValues = 0;
+	uint64_t numBitsSaved = 0;
 
 	SelectedRanges ranges;
 
@@ -92,6 +109,7 @@ private:
 			for (uint16_t i = range.start; i <= range.stop; ++i)
 			{
 				view[i].selection.selected = false;
+				view[i].selection.bitsSaved = 0;
 			}
 			ranges.Clear<Spec>();
 		}
@@ -104,6 +122,57 @@ private:
 		return variation;
 	}
 
+	/**
+	* Scan a range and determine the smallest static variation that can represent every value in it
+	* without loss. Specialized in the cpp file for the types that support compaction.
+	*/
+	template <class Spec>
+	static bool GetCompactVariation(const openpal::ArrayView<Cell<Spec>, uint16_t>& view, const Range& range, typename Spec::static_variation_t& variation)
+	{
+		return false;
+	}
+
+	/// size of a single object in bits, specialized alongside GetCompactVariation
+	template <class Spec>
+	static uint32_t SizeInBits(typename Spec::static_variation_t variation)
+	{
+		return 0;
+	}
+
+	template <class Spec>
+	static typename Spec::static_variation_t Compact(SelectedValue<Spec>& selection, typename Spec::static_variation_t configured, typename Spec::static_variation_t compact)
+	{
+		const auto candidate = CheckForPromotion<Spec>(selection.value, compact);
+		const auto configuredBits = SizeInBits<Spec>(configured);
+		const auto candidateBits = SizeInBits<Spec>(candidate);
+
+		if (candidateBits < configuredBits)
+		{
+			selection.bitsSaved = static_cast<uint8_t>(configuredBits - candidateBits);
+			return candidate;
+		}
+		else
+		{
+			return configured;
+		}
+	}
+
+	// count the compacted values between start and end that were written, i.e. deselected by the load
+	template <class Spec>
+	void CountCompacted(openpal::ArrayView<Cell<Spec>, uint16_t>& view, uint16_t start, uint32_t end)
+	{
+		for (uint32_t i = start; i < end; ++i)
+		{
+			auto& selection = view[static_cast<uint16_t>(i)].selection;
+			if (!selection.selected && selection.bitsSaved > 0)
+			{
+				++numCompactedValues;
+				numBitsSaved += selection.bitsSaved;
+				selection.bitsSaved = 0;
+			}
+		}
+	}
+
 	static Range RangeOf(uint16_t size);
 
 	template <class T>
@@ -193,6 +262,10 @@ IINField DatabaseBuffers::GenericSelect(
 			// return code depends on if the range was truncated to match the database
 			IINField ret = allowed.Equals(range) ? IINField() : IINBit::PARAM_ERROR;
 
+			// default variations may be replaced by the smallest lossless encoding of the range
+			typename T::static_variation_t compactVariation;
+			const bool compact = useDefault && compactTypes.IsSet(T::StaticTypeEnum) && GetCompactVariation<T>(view, allowed, compactVariation);
+
 			for (uint16_t i = allowed.start; i <= allowed.stop; ++i)
 			{
 				if (view[i].selection.selected)
@@ -203,8 +276,10 @@ IINField DatabaseBuffers::GenericSelect(
 				{
 					view[i].selection.selected = true;
 					view[i].selection.value = view[i].value;
+					view[i].selection.bitsSaved = 0;
 					auto var = useDefault ? view[i].config.svariation : variation;
-					view[i].selection.variation = CheckForPromotion<T>(view[i].selection.value, var);
+					var = CheckForPromotion<T>(view[i].selection.value, var);
+					view[i].selection.variation = compact ? Compact<T>(view[i].selection, var, compactVariation) : var;
 				}
 			}
 
@@ -242,7 +317,10 @@ bool DatabaseBuffers::LoadType(HeaderWriter& writer)
 				auto writeFun = GetStaticWriter(view[range.start].selection.variation);
 
 				// start writing a header, the invoked function will advance the range appropriately
-				spaceRemaining = writeFun(view, writer, range);
+				const auto start = range.start;
+				const uint32_t stop = range.stop;
+				spaceRemaining = writeFun(view, writer, range, optimizeQualifiers);
+				this->CountCompacted(view, start, range.IsValid() ? range.start : stop + 1);
 			}
 			else
 			{
@@ -25,9 +25,11 @@
 namespace opendnp3
 {
 
-EventBuffer::EventBuffer(const EventBufferConfig& config_) :
+EventBuffer::EventBuffer(const EventBufferConfig& config_, bool optimizeQualifiers_, openpal::IMonotonicTimeSource* timeSource_) :
 	overflow(false),
 	config(config_),
+	optimizeQualifiers(optimizeQualifiers_),
+	timeSource(timeSource_),
 	events(config_.TotalEvents())
 {
 
@@ -182,7 +184,7 @@ bool EventBuffer::HasAnySelection() const
 
 bool EventBuffer::Load(HeaderWriter& writer)
 {
-	return EventWriter::Write(writer, *this, events.Iterate());
+	return EventWriter::Write(writer, *this, events.Iterate(), optimizeQualifiers);
 }
 
 bool EventBuffer::HasMoreUnwrittenEvents() const
@@ -190,9 +192,15 @@ bool EventBuffer::HasMoreUnwrittenEvents() const
 	return HasAnySelection();
 }
 
-void EventBuffer::RecordWritten(EventClass ec, EventType et)
+void EventBuffer::RecordWritten(const SOERecord& record)
 {
-	writtenCounts.Increment(ec, et);
+	writtenCounts.Increment(record.clazz, record.type);
+
+	if (timeSource)
+	{
+		const auto now = timeSource->GetMicroseconds();
+		eventAge.Record((now > record.recordedMicros) ? static_cast<uint64_t>(now - record.recordedMicros) : 0);
+	}
 }
 
 ClassField EventBuffer::UnwrittenClassField() const
@@ -30,6 +30,8 @@
 #include "opendnp3/outstation/SOERecord.h"
 
 #include <openpal/container/LinkedList.h>
+#include <openpal/executor/IMonotonicTimeSource.h>
+#include <openpal/util/Histogram.h>
 
 namespace opendnp3
 {
@@ -50,7 +52,10 @@ class EventBuffer : public IEventReceiver, public IEventSelector, public IRespon
 
 public:
 
-	explicit EventBuffer(const EventBufferConfig& config);
+	/**
+	* @param timeSource optional source of the time stamps used to measure the age of events when they are written
+	*/
+	explicit EventBuffer(const EventBufferConfig& config, bool optimizeQualifiers = false, openpal::IMonotonicTimeSource* timeSource = nullptr);
 
 	// ------- IEventReceiver ------
 
@@ -101,7 +106,7 @@ public:
 
 	virtual bool HasMoreUnwrittenEvents() const override final;
 
-	virtual void RecordWritten(EventClass ec, EventType et) override final;
+	virtual void RecordWritten(const SOERecord& record) override final;
 
 	// ------- Misc -------
 
@@ -111,8 +116,24 @@ public:
 
 	ClassField UnwrittenClassField() const;
 
+	uint32_t NumUnwritten(EventClass ec) const
+	{
+		return totalCounts.NumOfClass(ec) - writtenCounts.NumOfClass(ec);
+	}
+
+	uint32_t NumWritten() const
+	{
+		return writtenCounts.TotatCount();
+	}
+
 	bool IsOverflown();
 
+	/// time in microseconds from recording an event to writing it into a response
+	const openpal::Histogram& EventAge() const
+	{
+		return eventAge;
+	}
+
 private:
 
 	inline bool HasUnwrittenEvents(EventClass ec) const
@@ -154,6 +175,9 @@ private:
 	bool overflow;
 
 	EventBufferConfig config;
+	bool optimizeQualifiers;
+	openpal::IMonotonicTimeSource* timeSource;
+	openpal::Histogram eventAge;
 
 	openpal::LinkedList<SOERecord, uint32_t> events;
 
@@ -182,7 +206,12 @@ void EventBuffer::UpdateAny(const Event<Spec>& evt)
 		}
 
 		// Add the event, the Reset() ensures that selected/written == false
-		events.Add(SOERecord(evt.value, evt.index, evt.clazz, evt.variation))->value.Reset();
+		auto& record = events.Add(SOERecord(evt.value, evt.index, evt.clazz, evt.variation))->value;
+		record.Reset();
+		if (timeSource)
+		{
+			record.recordedMicros = timeSource->GetMicroseconds();
+		}
 		totalCounts.Increment(evt.clazz, Spec::EventTypeEnum);
 	}
 }
@@ -34,7 +34,7 @@ using namespace openpal;
 
 namespace opendnp3
 {
-bool EventWriter::Write(HeaderWriter& writer, IEventRecorder& recorder, openpal::LinkedListIterator<SOERecord> iterator)
+bool EventWriter::Write(HeaderWriter& writer, IEventRecorder& recorder, openpal::LinkedListIterator<SOERecord> iterator, bool optimizeQualifiers)
 {
 	while (iterator.HasNext() && recorder.HasMoreUnwrittenEvents())
 	{
@@ -42,7 +42,7 @@ bool EventWriter::Write(HeaderWriter& writer, IEventRecorder& recorder, openpal:
 
 		if (IsWritable(pCurrent->value))
 		{
-			auto result = LoadHeader(writer, recorder, pCurrent);
+			auto result = LoadHeader(writer, recorder, pCurrent, optimizeQualifiers);
 			iterator = result.location;
 
 			if (result.isFragmentFull)
@@ -55,184 +55,184 @@ bool EventWriter::Write(HeaderWriter& writer, IEventRecorder& recorder, openpal:
 	return true;
 }
 
-EventWriter::Result EventWriter::LoadHeader(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation)
+EventWriter::Result EventWriter::LoadHeader(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers)
 {
 	switch (pLocation->value.type)
 	{
 	case(EventType::Binary) :
-		return LoadHeaderBinary(writer, recorder, pLocation);
+		return LoadHeaderBinary(writer, recorder, pLocation, optimizeQualifiers);
 	case(EventType::DoubleBitBinary) :
-		return LoadHeaderDoubleBinary(writer, recorder, pLocation);
+		return LoadHeaderDoubleBinary(writer, recorder, pLocation, optimizeQualifiers);
 	case(EventType::Counter):
-		return LoadHeaderCounter(writer, recorder, pLocation);
+		return LoadHeaderCounter(writer, recorder, pLocation, optimizeQualifiers);
 	case(EventType::FrozenCounter):
-		return LoadHeaderFrozenCounter(writer, recorder, pLocation);
+		return LoadHeaderFrozenCounter(writer, recorder, pLocation, optimizeQualifiers);
 	case(EventType::Analog):
-		return LoadHeaderAnalog(writer, recorder, pLocation);
+		return LoadHeaderAnalog(writer, recorder, pLocation, optimizeQualifiers);
 	case(EventType::BinaryOutputStatus):
-		return LoadHeaderBinaryOutputStatus(writer, recorder, pLocation);
+		return LoadHeaderBinaryOutputStatus(writer, recorder, pLocation, optimizeQualifiers);
 	case(EventType::AnalogOutputStatus) :
-		return LoadHeaderAnalogOutputStatus(writer, recorder, pLocation);
+		return LoadHeaderAnalogOutputStatus(writer, recorder, pLocation, optimizeQualifiers);
 	case(EventType::SecurityStat) :
-		return LoadHeaderSecurityStat(writer, recorder, pLocation);
+		return LoadHeaderSecurityStat(writer, recorder, pLocation, optimizeQualifiers);
 	default:
 		return Result(false, LinkedListIterator<SOERecord>::Undefined());
 	}
 }
 
-EventWriter::Result EventWriter::LoadHeaderBinary(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation)
+EventWriter::Result EventWriter::LoadHeaderBinary(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers)
 {
 	auto variation = pLocation->value.GetValue<BinarySpec>().selectedVariation;
 
 	switch (variation)
 	{
 	case(EventBinaryVariation::Group2Var1):
-		return WriteTypeWithSerializer<BinarySpec>(writer, recorder, pLocation, Group2Var1::Inst(), variation);
+		return WriteTypeWithSerializer<BinarySpec>(writer, recorder, pLocation, Group2Var1::Inst(), variation, optimizeQualifiers);
 	case(EventBinaryVariation::Group2Var2):
-		return WriteTypeWithSerializer<BinarySpec>(writer, recorder, pLocation, Group2Var2::Inst(), variation);
+		return WriteTypeWithSerializer<BinarySpec>(writer, recorder, pLocation, Group2Var2::Inst(), variation, optimizeQualifiers);
 	case(EventBinaryVariation::Group2Var3) :
-		return WriteCTOTypeWithSerializer<BinarySpec, Group51Var1>(writer, recorder, pLocation, Group2Var3::Inst(), variation);
+		return WriteCTOTypeWithSerializer<BinarySpec, Group51Var1>(writer, recorder, pLocation, Group2Var3::Inst(), variation, optimizeQualifiers);
 	default:
-		return WriteTypeWithSerializer<BinarySpec>(writer, recorder, pLocation, Group2Var1::Inst(), variation);
+		return WriteTypeWithSerializer<BinarySpec>(writer, recorder, pLocation, Group2Var1::Inst(), variation, optimizeQualifiers);
 	}
 }
 
-EventWriter::Result EventWriter::LoadHeaderDoubleBinary(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation)
+EventWriter::Result EventWriter::LoadHeaderDoubleBinary(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers)
 {
 	auto variation = pLocation->value.GetValue<DoubleBitBinarySpec>().selectedVariation;
 
 	switch (variation)
 	{
 	case(EventDoubleBinaryVariation::Group4Var1) :
-		return WriteTypeWithSerializer<DoubleBitBinarySpec>(writer, recorder, pLocation, Group4Var1::Inst(), variation);
+		return WriteTypeWithSerializer<DoubleBitBinarySpec>(writer, recorder, pLocation, Group4Var1::Inst(), variation, optimizeQualifiers);
 	case(EventDoubleBinaryVariation::Group4Var2) :
-		return WriteTypeWithSerializer<DoubleBitBinarySpec>(writer, recorder, pLocation, Group4Var2::Inst(), variation);
+		return WriteTypeWithSerializer<DoubleBitBinarySpec>(writer, recorder, pLocation, Group4Var2::Inst(), variation, optimizeQualifiers);
 	case(EventDoubleBinaryVariation::Group4Var3) :
-		return WriteCTOTypeWithSerializer<DoubleBitBinarySpec, Group51Var1>(writer, recorder, pLocation, Group4Var3::Inst(), variation);
+		return WriteCTOTypeWithSerializer<DoubleBitBinarySpec, Group51Var1>(writer, recorder, pLocation, Group4Var3::Inst(), variation, optimizeQualifiers);
 	default:
-		return WriteTypeWithSerializer<DoubleBitBinarySpec>(writer, recorder, pLocation, Group4Var1::Inst(), variation);
+		return WriteTypeWithSerializer<DoubleBitBinarySpec>(writer, recorder, pLocation, Group4Var1::Inst(), variation, optimizeQualifiers);
 	}
 }
 
-EventWriter::Result EventWriter::LoadHeaderCounter(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation)
+EventWriter::Result EventWriter::LoadHeaderCounter(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers)
 {
 	auto variation = pLocation->value.GetValue<CounterSpec>().selectedVariation;
 
 	switch (variation)
 	{
 	case(EventCounterVariation::Group22Var1) :
-		return WriteTypeWithSerializer<CounterSpec>(writer, recorder, pLocation, Group22Var1::Inst(), variation);
+		return WriteTypeWithSerializer<CounterSpec>(writer, recorder, pLocation, Group22Var1::Inst(), variation, optimizeQualifiers);
 	case(EventCounterVariation::Group22Var2) :
-		return WriteTypeWithSerializer<CounterSpec>(writer, recorder, pLocation, Group22Var2::Inst(), variation);
+		return WriteTypeWithSerializer<CounterSpec>(writer, recorder, pLocation, Group22Var2::Inst(), variation, optimizeQualifiers);
 	case(EventCounterVariation::Group22Var5) :
-		return WriteTypeWithSerializer<CounterSpec>(writer, recorder, pLocation, Group22Var5::Inst(), variation);
+		return WriteTypeWithSerializer<CounterSpec>(writer, recorder, pLocation, Group22Var5::Inst(), variation, optimizeQualifiers);
 	case(EventCounterVariation::Group22Var6) :
-		return WriteTypeWithSerializer<CounterSpec>(writer, recorder, pLocation, Group22Var6::Inst(), variation);
+		return WriteTypeWithSerializer<CounterSpec>(writer, recorder, pLocation, Group22Var6::Inst(), variation, optimizeQualifiers);
 	default:
-		return WriteTypeWithSerializer<CounterSpec>(writer, recorder, pLocation, Group22Var1::Inst(), variation);
+		return WriteTypeWithSerializer<CounterSpec>(writer, recorder, pLocation, Group22Var1::Inst(), variation, optimizeQualifiers);
 	}
 }
 
-EventWriter::Result EventWriter::LoadHeaderFrozenCounter(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation)
+EventWriter::Result EventWriter::LoadHeaderFrozenCounter(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers)
 {
 	auto variation = pLocation->value.GetValue<FrozenCounterSpec>().selectedVariation;
 
 	switch (variation)
 	{
 	case(EventFrozenCounterVariation::Group23Var1) :
-		return WriteTypeWithSerializer<FrozenCounterSpec>(writer, recorder, pLocation, Group23Var1::Inst(), variation);
+		return WriteTypeWithSerializer<FrozenCounterSpec>(writer, recorder, pLocation, Group23Var1::Inst(), variation, optimizeQualifiers);
 	case(EventFrozenCounterVariation::Group23Var2) :
-		return WriteTypeWithSerializer<FrozenCounterSpec>(writer, recorder, pLocation, Group23Var2::Inst(), variation);
+		return WriteTypeWithSerializer<FrozenCounterSpec>(writer, recorder, pLocation, Group23Var2::Inst(), variation, optimizeQualifiers);
 	case(EventFrozenCounterVariation::Group23Var5) :
-		return WriteTypeWithSerializer<FrozenCounterSpec>(writer, recorder, pLocation, Group23Var5::Inst(), variation);
+		return WriteTypeWithSerializer<FrozenCounterSpec>(writer, recorder, pLocation, Group23Var5::Inst(), variation, optimizeQualifiers);
 	case(EventFrozenCounterVariation::Group23Var6) :
-		return WriteTypeWithSerializer<FrozenCounterSpec>(writer, recorder, pLocation, Group23Var6::Inst(), variation);
+		return WriteTypeWithSerializer<FrozenCounterSpec>(writer, recorder, pLocation, Group23Var6::Inst(), variation, optimizeQualifiers);
 	default:
-		return WriteTypeWithSerializer<FrozenCounterSpec>(writer, recorder, pLocation, Group23Var1::Inst(), variation);
+		return WriteTypeWithSerializer<FrozenCounterSpec>(writer, recorder, pLocation, Group23Var1::Inst(), variation, optimizeQualifiers);
 	}
 }
 
-EventWriter::Result EventWriter::LoadHeaderAnalog(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation)
+EventWriter::Result EventWriter::LoadHeaderAnalog(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers)
 {
 	auto variation = pLocation->value.GetValue<AnalogSpec>().selectedVariation;
 
 	switch (variation)
 	{
 	case(EventAnalogVariation::Group32Var1) :
-		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var1::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var1::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogVariation::Group32Var2) :
-		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var2::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var2::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogVariation::Group32Var3) :
-		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var3::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var3::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogVariation::Group32Var4) :
-		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var4::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var4::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogVariation::Group32Var5) :
-		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var5::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var5::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogVariation::Group32Var6) :
-		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var6::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var6::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogVariation::Group32Var7) :
-		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var7::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var7::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogVariation::Group32Var8) :
-		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var8::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var8::Inst(), variation, optimizeQualifiers);
 	default:
-		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var1::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogSpec>(writer, recorder, pLocation, Group32Var1::Inst(), variation, optimizeQualifiers);
 	}
 }
 
-EventWriter::Result EventWriter::LoadHeaderBinaryOutputStatus(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation)
+EventWriter::Result EventWriter::LoadHeaderBinaryOutputStatus(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers)
 {
 	auto variation = pLocation->value.GetValue<BinaryOutputStatusSpec>().selectedVariation;
 
 	switch (variation)
 	{
 	case(EventBinaryOutputStatusVariation::Group11Var1) :
-		return WriteTypeWithSerializer<BinaryOutputStatusSpec>(writer, recorder, pLocation, Group11Var1::Inst(), variation);
+		return WriteTypeWithSerializer<BinaryOutputStatusSpec>(writer, recorder, pLocation, Group11Var1::Inst(), variation, optimizeQualifiers);
 	case(EventBinaryOutputStatusVariation::Group11Var2) :
-		return WriteTypeWithSerializer<BinaryOutputStatusSpec>(writer, recorder, pLocation, Group11Var2::Inst(), variation);
+		return WriteTypeWithSerializer<BinaryOutputStatusSpec>(writer, recorder, pLocation, Group11Var2::Inst(), variation, optimizeQualifiers);
 	default:
-		return WriteTypeWithSerializer<BinaryOutputStatusSpec>(writer, recorder, pLocation, Group11Var1::Inst(), variation);
+		return WriteTypeWithSerializer<BinaryOutputStatusSpec>(writer, recorder, pLocation, Group11Var1::Inst(), variation, optimizeQualifiers);
 	}
 }
 
-EventWriter::Result EventWriter::LoadHeaderAnalogOutputStatus(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation)
+EventWriter::Result EventWriter::LoadHeaderAnalogOutputStatus(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers)
 {
 	auto variation = pLocation->value.GetValue<AnalogOutputStatusSpec>().selectedVariation;
 
 	switch (variation)
 	{
 	case(EventAnalogOutputStatusVariation::Group42Var1) :
-		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var1::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var1::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogOutputStatusVariation::Group42Var2) :
-		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var2::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var2::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogOutputStatusVariation::Group42Var3) :
-		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var3::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var3::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogOutputStatusVariation::Group42Var4) :
-		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var4::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var4::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogOutputStatusVariation::Group42Var5) :
-		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var5::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var5::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogOutputStatusVariation::Group42Var6) :
-		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var6::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var6::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogOutputStatusVariation::Group42Var7) :
-		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var7::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var7::Inst(), variation, optimizeQualifiers);
 	case(EventAnalogOutputStatusVariation::Group42Var8) :
-		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var8::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var8::Inst(), variation, optimizeQualifiers);
 	default:
-		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var1::Inst(), variation);
+		return WriteTypeWithSerializer<AnalogOutputStatusSpec>(writer, recorder, pLocation, Group42Var1::Inst(), variation, optimizeQualifiers);
 	}
 }
 
-EventWriter::Result EventWriter::LoadHeaderSecurityStat(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation)
+EventWriter::Result EventWriter::LoadHeaderSecurityStat(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers)
 {
 	auto variation = pLocation->value.GetValue<SecurityStatSpec>().selectedVariation;
 
 	switch (variation)
 	{
 	case(EventSecurityStatVariation::Group122Var1) :
-		return WriteTypeWithSerializer<SecurityStatSpec>(writer, recorder, pLocation, Group122Var1::Inst(), variation);
+		return WriteTypeWithSerializer<SecurityStatSpec>(writer, recorder, pLocation, Group122Var1::Inst(), variation, optimizeQualifiers);
 	case(EventSecurityStatVariation::Group122Var2) :
-		return WriteTypeWithSerializer<SecurityStatSpec>(writer, recorder, pLocation, Group122Var2::Inst(), variation);
+		return WriteTypeWithSerializer<SecurityStatSpec>(writer, recorder, pLocation, Group122Var2::Inst(), variation, optimizeQualifiers);
 	default:
-		return WriteTypeWithSerializer<SecurityStatSpec>(writer, recorder, pLocation, Group122Var1::Inst(), variation);
+		return WriteTypeWithSerializer<SecurityStatSpec>(writer, recorder, pLocation, Group122Var1::Inst(), variation, optimizeQualifiers);
 	}
 }
 
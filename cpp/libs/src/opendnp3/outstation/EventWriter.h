@@ -35,7 +35,7 @@ class EventWriter : openpal::StaticOnly
 {
 public:
 
-	static bool Write(HeaderWriter& writer, IEventRecorder& recorder, openpal::LinkedListIterator<SOERecord> iterator);
+	static bool Write(HeaderWriter& writer, IEventRecorder& recorder, openpal::LinkedListIterator<SOERecord> iterator, bool optimizeQualifiers);
 
 private:
 
@@ -55,29 +55,81 @@ private:
 		Result() = delete;
 	};
 
-	static Result LoadHeader(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation);
+	static Result LoadHeader(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers);
 
-	static Result LoadHeaderBinary(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation);
-	static Result LoadHeaderDoubleBinary(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation);
-	static Result LoadHeaderCounter(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation);
-	static Result LoadHeaderFrozenCounter(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation);
-	static Result LoadHeaderAnalog(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation);
-	static Result LoadHeaderBinaryOutputStatus(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation);
-	static Result LoadHeaderAnalogOutputStatus(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation);
-	static Result LoadHeaderSecurityStat(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation);
+	static Result LoadHeaderBinary(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers);
+	static Result LoadHeaderDoubleBinary(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers);
+	static Result LoadHeaderCounter(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers);
+	static Result LoadHeaderFrozenCounter(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers);
+	static Result LoadHeaderAnalog(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers);
+	static Result LoadHeaderBinaryOutputStatus(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers);
+	static Result LoadHeaderAnalogOutputStatus(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers);
+	static Result LoadHeaderSecurityStat(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, bool optimizeQualifiers);
 
 	inline static bool IsWritable(const SOERecord& record)
 	{
 		return record.selected && !record.written;
 	}
 
+	/**
+	* Scan the events that will be written in the header starting at pLocation and determine if
+	* all of their indices fit in a 1-byte prefix (0x17) instead of a 2-byte prefix (0x28)
+	*/
 	template <class Spec>
-	static Result WriteTypeWithSerializer(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, opendnp3::DNP3Serializer<typename Spec::meas_t> serializer, typename Spec::event_variation_t variation)
+	static bool FitsOneBytePrefix(openpal::ListNode<SOERecord>* pLocation, typename Spec::event_variation_t variation)
 	{
 		auto iter = openpal::LinkedListIterator<SOERecord>::From(pLocation);
 
-		auto header = writer.IterateOverCountWithPrefix<openpal::UInt16, typename Spec::meas_t>(QualifierCode::UINT16_CNT_UINT16_INDEX, serializer);
+		uint32_t count = 0;
+		openpal::ListNode<SOERecord>* pCurrent = nullptr;
+
+		while ((count < openpal::UInt8::Max) && (pCurrent = iter.Next()))
+		{
+			auto& record = pCurrent->value;
+
+			if (IsWritable(record))
+			{
+				if ((record.type == Spec::EventTypeEnum) && (record.GetValue<Spec>().selectedVariation == variation))
+				{
+					if (record.GetIndex() > openpal::UInt8::Max)
+					{
+						return false;
+					}
+
+					++count;
+				}
+				else
+				{
+					// the header ends here
+					break;
+				}
+			}
+		}
+
+		return true;
+	}
 
+	template <class Spec>
+	static Result WriteTypeWithSerializer(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, opendnp3::DNP3Serializer<typename Spec::meas_t> serializer, typename Spec::event_variation_t variation, bool optimizeQualifiers)
+	{
+		if (optimizeQualifiers && FitsOneBytePrefix<Spec>(pLocation, variation))
+		{
+			return WriteTypeWithPrefix<Spec, openpal::UInt8>(writer, recorder, pLocation, serializer, variation, QualifierCode::UINT8_CNT_UINT8_INDEX);
+		}
+		else
+		{
+			return WriteTypeWithPrefix<Spec, openpal::UInt16>(writer, recorder, pLocation, serializer, variation, QualifierCode::UINT16_CNT_UINT16_INDEX);
+		}
+	}
+
+	template <class Spec, class PrefixType>
+	static Result WriteTypeWithPrefix(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, opendnp3::DNP3Serializer<typename Spec::meas_t> serializer, typename Spec::event_variation_t variation, QualifierCode qc)
+	{
+		auto iter = openpal::LinkedListIterator<SOERecord>::From(pLocation);
+
+		auto header = writer.IterateOverCountWithPrefix<PrefixType, typename Spec::meas_t>(qc, serializer);
+
+		uint32_t count = 0;
 		openpal::ListNode<SOERecord>* pCurrent = nullptr;
 
 		while (recorder.HasMoreUnwrittenEvents() && (pCurrent = iter.Next()))
@@ -88,11 +140,18 @@ private:
 			{
 				if ((record.type == Spec::EventTypeEnum) && (record.GetValue<Spec>().selectedVariation == variation))
 				{
+					if (count == PrefixType::Max)
+					{
+						// the count is full, the next header starts from the current location
+						break;
+					}
+
 					auto evt = record.ReadEvent<Spec>();
-					if (header.Write(evt.value, evt.index))
+					if (header.Write(evt.value, static_cast<typename PrefixType::Type>(evt.index)))
 					{
+						++count;
 						record.written = true;
-						recorder.RecordWritten(record.clazz, record.type);
+						recorder.RecordWritten(record);
 					}
 					else
 					{
@@ -114,15 +173,29 @@ private:
 	}
 
 	template <class Spec, class CTOType>
-	static Result WriteCTOTypeWithSerializer(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, opendnp3::DNP3Serializer<typename Spec::meas_t> serializer, typename Spec::event_variation_t variation)
+	static Result WriteCTOTypeWithSerializer(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, opendnp3::DNP3Serializer<typename Spec::meas_t> serializer, typename Spec::event_variation_t variation, bool optimizeQualifiers)
+	{
+		if (optimizeQualifiers && FitsOneBytePrefix<Spec>(pLocation, variation))
+		{
+			return WriteCTOTypeWithPrefix<Spec, CTOType, openpal::UInt8>(writer, recorder, pLocation, serializer, variation, QualifierCode::UINT8_CNT_UINT8_INDEX);
+		}
+		else
+		{
+			return WriteCTOTypeWithPrefix<Spec, CTOType, openpal::UInt16>(writer, recorder, pLocation, serializer, variation, QualifierCode::UINT16_CNT_UINT16_INDEX);
+		}
+	}
+
+	template <class Spec, class CTOType, class PrefixType>
+	static Result WriteCTOTypeWithPrefix(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, opendnp3::DNP3Serializer<typename Spec::meas_t> serializer, typename Spec::event_variation_t variation, QualifierCode qc)
 	{
 		auto iter = openpal::LinkedListIterator<SOERecord>::From(pLocation);
 
 		CTOType cto;
 		cto.time = pLocation->value.GetTime();
 
-		auto header = writer.IterateOverCountWithPrefixAndCTO<openpal::UInt16, typename Spec::meas_t, CTOType>(QualifierCode::UINT16_CNT_UINT16_INDEX, serializer, cto);
+		auto header = writer.IterateOverCountWithPrefixAndCTO<PrefixType, typename Spec::meas_t, CTOType>(qc, serializer, cto);
 
+		uint32_t count = 0;
 		openpal::ListNode<SOERecord>* pCurrent = nullptr;
 
 		while (recorder.HasMoreUnwrittenEvents() && (pCurrent = iter.Next()))
@@ -146,14 +219,20 @@ private:
 							// drop out and return from current location
 							break;
 						}
+						else if (count == PrefixType::Max)
+						{
+							// the count is full, the next header starts from the current location
+							break;
+						}
 						else
 						{
 							auto evt = record.ReadEvent<Spec>();
 							evt.value.time = DNPTime(diff);
-							if (header.Write(evt.value, evt.index))
+							if (header.Write(evt.value, static_cast<typename PrefixType::Type>(evt.index)))
 							{
+								++count;
 								record.written = true;
-								recorder.RecordWritten(record.clazz, record.type);
+								recorder.RecordWritten(record);
 							}
 							else
 							{
@@ -21,7 +21,7 @@
 #ifndef OPENDNP3_IEVENTRECORDER_H
 #define OPENDNP3_IEVENTRECORDER_H
 
-#include "opendnp3/app/EventType.h"
+#include "opendnp3/outstation/SOERecord.h"
 
 namespace opendnp3
 {
@@ -32,7 +32,7 @@ public:
 
 	virtual bool HasMoreUnwrittenEvents() const = 0;
 
-	virtual void RecordWritten(EventClass ec, EventType et) = 0;
+	virtual void RecordWritten(const SOERecord& record) = 0;
 };
 
 }
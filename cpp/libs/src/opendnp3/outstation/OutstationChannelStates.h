@@ -33,13 +33,19 @@ class OutstationSolState : private openpal::Uncopyable
 {
 public:
 
-	OutstationSolState(uint32_t maxTxSize) : tx(maxTxSize)
+	OutstationSolState(uint32_t maxTxSize, bool preEncode) : tx(maxTxSize, preEncode)
 	{}
 
-	void Reset() {}
+	void Reset()
+	{
+		next = APDUResponse();
+	}
 
 	OutstationSeqNum seq;
 	TxBuffer tx;
+
+	// next fragment of a multi-fragment response, encoded in the spare buffer while waiting for a confirm
+	APDUResponse next;
 };
 
 class OutstationUnsolState : private openpal::Uncopyable
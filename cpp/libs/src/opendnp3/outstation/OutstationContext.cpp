@@ -33,6 +33,7 @@
 #include "opendnp3/outstation/WriteHandler.h"
 #include "opendnp3/outstation/IINHelpers.h"
 #include "opendnp3/outstation/CommandActionAdapter.h"
+#include "opendnp3/outstation/AsyncCommandActionAdapter.h"
 #include "opendnp3/outstation/CommandResponseHandler.h"
 #include "opendnp3/outstation/ConstantCommandAction.h"
 #include "opendnp3/outstation/EventWriter.h"
@@ -54,15 +55,45 @@ OContext::OContext(
     const std::shared_ptr<openpal::IExecutor>& executor,
     const std::shared_ptr<ILowerLayer>& lower,
     const std::shared_ptr<ICommandHandler>& commandHandler,
+    const std::shared_ptr<IOutstationApplication>& application) :
+
+	OContext(config, dbSizes, logger, executor, lower, commandHandler, nullptr, application)
+{
+
+}
+
+OContext::OContext(
+    const OutstationConfig& config,
+    const DatabaseSizes& dbSizes,
+    const openpal::Logger& logger,
+    const std::shared_ptr<openpal::IExecutor>& executor,
+    const std::shared_ptr<ILowerLayer>& lower,
+    const std::shared_ptr<IAsyncCommandHandler>& asyncCommandHandler,
+    const std::shared_ptr<IOutstationApplication>& application) :
+
+	OContext(config, dbSizes, logger, executor, lower, nullptr, asyncCommandHandler, application)
+{
+
+}
+
+OContext::OContext(
+    const OutstationConfig& config,
+    const DatabaseSizes& dbSizes,
+    const openpal::Logger& logger,
+    const std::shared_ptr<openpal::IExecutor>& executor,
+    const std::shared_ptr<ILowerLayer>& lower,
+    const std::shared_ptr<ICommandHandler>& commandHandler,
+    const std::shared_ptr<IAsyncCommandHandler>& asyncCommandHandler,
     const std::shared_ptr<IOutstationApplication>& application) :
 
 	logger(logger),
 	executor(executor),
 	lower(lower),
 	commandHandler(commandHandler),
+	asyncCommandHandler(asyncCommandHandler),
 	application(application),
-	eventBuffer(config.eventBufferConfig),
-	database(dbSizes, eventBuffer, config.params.indexMode, config.params.typesAllowedInClass0),
+	eventBuffer(config.eventBufferConfig, config.params.optimizeQualifiers, config.params.latencyHistograms ? executor.get() : nullptr),
+	database(dbSizes, eventBuffer, config.params.indexMode, config.params.typesAllowedInClass0, config.params.compactStaticTypes, config.params.optimizeQualifiers),
 	rspContext(database.GetResponseLoader(), eventBuffer),
 	params(config.params),
 	isOnline(false),
@@ -70,12 +101,20 @@ OContext::OContext(
 	staticIIN(IINBit::DEVICE_RESTART),
 	confirmTimer(*executor),
 	deferred(config.params.maxRxFragSize),
-	sol(config.params.maxTxFragSize),
-	unsol(config.params.maxTxFragSize)
+	asyncCommandTimer(*executor),
+	sol(config.params.maxTxFragSize, config.params.preEncodeResponses),
+	unsol(config.params.maxTxFragSize),
+	unsolBatcher(config.params),
+	unsolHoldTimer(*executor)
 {
 
 }
 
+OContext::~OContext()
+{
+	this->CancelAsyncCommands();
+}
+
 bool OContext::OnLowerLayerUp()
 {
 	if (isOnline)
@@ -109,6 +148,9 @@ bool OContext::OnLowerLayerDown()
 	eventBuffer.Unselect();
 	rspContext.Reset();
 	confirmTimer.Cancel();
+	unsolBatcher.Reset();
+	unsolHoldTimer.Cancel();
+	this->CancelAsyncCommands();
 
 	return true;
 }
@@ -133,7 +175,25 @@ bool OContext::OnReceive(const openpal::RSlice& fragment)
 		return false;
 	}
 
-	this->ParseHeader(fragment);
+	if (this->params.latencyHistograms)
+	{
+		this->rxMicros = this->executor->GetMicroseconds();
+	}
+
+	this->ParseHeader(fragment, false);
+	this->CheckForTaskStart();
+	return true;
+}
+
+bool OContext::OnReceiveBroadcast(const openpal::RSlice& fragment)
+{
+	if (!this->isOnline)
+	{
+		SIMPLE_LOG_BLOCK(this->logger, flags::ERR, "ignoring received data while offline");
+		return false;
+	}
+
+	this->ParseHeader(fragment, true);
 	this->CheckForTaskStart();
 	return true;
 }
@@ -151,6 +211,11 @@ OutstationState& OContext::OnReceiveSolRequest(const APDUHeader& header, const o
 				{
 					return this->state->OnRepeatReadRequest(*this, header, objects);
 				}
+				else if (this->asyncCommands)
+				{
+					SIMPLE_LOG_BLOCK(this->logger, flags::WARN, "Ignoring repeat request while waiting for commands to complete");
+					return *this->state;
+				}
 				else
 				{
 					return this->state->OnRepeatNonReadRequest(*this, header, objects);
@@ -176,6 +241,12 @@ OutstationState& OContext::ProcessNewRequest(const APDUHeader& header, const ope
 {
 	this->sol.seq.num = header.control.SEQ;
 
+	if (this->asyncCommands)
+	{
+		SIMPLE_LOG_BLOCK(this->logger, flags::WARN, "New request abandons response to outstanding commands");
+		this->CancelAsyncCommands();
+	}
+
 	if (header.function == FunctionCode::READ)
 	{
 		return this->state->OnNewReadRequest(*this, header, objects);
@@ -199,6 +270,7 @@ void OContext::ProcessAPDU(const openpal::RSlice& apdu, const APDUHeader& header
 		if (this->isTransmitting)
 		{
 			this->deferred.Set(header, objects);
+			this->deferredMicros = this->rxMicros;
 		}
 		else
 		{
@@ -208,6 +280,7 @@ void OContext::ProcessAPDU(const openpal::RSlice& apdu, const APDUHeader& header
 			}
 			else
 			{
+				this->requestMicros = this->rxMicros;
 				this->ProcessRequest(header, objects);
 			}
 		}
@@ -234,6 +307,14 @@ void OContext::ProcessConfirm(const APDUHeader& header)
 
 void OContext::BeginResponseTx(const AppControlField& control, const RSlice& response)
 {
+	if (this->requestMicros >= 0)
+	{
+		// only the first fragment of a response answers the request
+		const auto now = this->executor->GetMicroseconds();
+		this->requestProcessing.Record((now > this->requestMicros) ? static_cast<uint64_t>(now - this->requestMicros) : 0);
+		this->requestMicros = -1;
+	}
+
 	this->sol.tx.Record(control, response);
 	this->BeginTx(response);
 }
@@ -278,6 +359,7 @@ bool OContext::ProcessDeferredRequest(APDUHeader header, openpal::RSlice objects
 		{
 			if (this->state->IsIdle())
 			{
+				this->requestMicros = this->deferredMicros;
 				this->ProcessRequest(header, objects);
 				return true;
 			}
@@ -288,6 +370,7 @@ bool OContext::ProcessDeferredRequest(APDUHeader header, openpal::RSlice objects
 		}
 		else
 		{
+			this->requestMicros = this->deferredMicros;
 			this->ProcessRequest(header, objects);
 			return true;
 		}
@@ -300,9 +383,10 @@ void OContext::CheckForUnsolicited()
 	{
 		if (this->unsol.completedNull)
 		{
-			// are there events to be reported?
-			if (this->params.unsolClassMask.Intersects(this->eventBuffer.UnwrittenClassField()))
+			// are there events to be reported, and have they been held long enough?
+			if (this->unsolBatcher.IsReady(this->params.unsolClassMask, this->eventBuffer, this->executor->GetTime()))
 			{
+				this->unsolHoldTimer.Cancel();
 
 				auto response = this->unsol.tx.Start();
 				auto writer = response.GetWriter();
@@ -310,12 +394,20 @@ void OContext::CheckForUnsolicited()
 				this->eventBuffer.Unselect();
 				this->eventBuffer.SelectAllByClass(this->params.unsolClassMask);
 				this->eventBuffer.Load(writer);
+				this->unsolBatcher.OnLoaded(this->eventBuffer);
+
+				++this->statistics.numUnsolicitedFragments;
+				this->statistics.numUnsolicitedEvents += this->eventBuffer.NumWritten();
 
 				build::NullUnsolicited(response, this->unsol.seq.num, this->GetResponseIIN());
 				this->RestartConfirmTimer();
 				this->state = &StateUnsolicitedConfirmWait::Inst();
 				this->BeginUnsolTx(response.GetControl(), response.ToRSlice());
 			}
+			else
+			{
+				this->StartUnsolHoldTimer();
+			}
 		}
 		else
 		{
@@ -329,6 +421,25 @@ void OContext::CheckForUnsolicited()
 	}
 }
 
+void OContext::StartUnsolHoldTimer()
+{
+	auto expiration = this->unsolBatcher.NextExpiration();
+
+	if (expiration.IsMax())
+	{
+		this->unsolHoldTimer.Cancel();
+	}
+	else if (!(this->unsolHoldTimer.IsActive() && this->unsolHoldTimer.ExpiresAt() == expiration))
+	{
+		auto timeout = [this]()
+		{
+			this->CheckForTaskStart();
+		};
+
+		this->unsolHoldTimer.Restart(expiration, timeout);
+	}
+}
+
 void OContext::RestartConfirmTimer()
 {
 	auto timeout = [&]()
@@ -344,6 +455,12 @@ void OContext::RespondToNonReadRequest(const APDUHeader& header, const openpal::
 {
 	this->history.RecordLastProcessedRequest(header, objects);
 
+	if (this->BeginAsyncCommands(header, objects))
+	{
+		// the response is sent once the application has completed every command
+		return;
+	}
+
 	auto response = this->sol.tx.Start();
 	auto writer = response.GetWriter();
 	response.SetFunction(FunctionCode::RESPONSE);
@@ -353,6 +470,125 @@ void OContext::RespondToNonReadRequest(const APDUHeader& header, const openpal::
 	this->BeginResponseTx(response.GetControl(), response.ToRSlice());
 }
 
+bool OContext::BeginAsyncCommands(const APDUHeader& header, const openpal::RSlice& objects)
+{
+	if (!this->asyncCommandHandler)
+	{
+		return false;
+	}
+
+	bool isSelect = false;
+	OperateType opType = OperateType::DirectOperate;
+
+	switch (header.function)
+	{
+	case(FunctionCode::SELECT) :
+		isSelect = true;
+		break;
+	case(FunctionCode::OPERATE) :
+		opType = OperateType::SelectBeforeOperate;
+		break;
+	case(FunctionCode::DIRECT_OPERATE) :
+		break;
+	default:
+		return false;
+	}
+
+	// oversized payloads and invalid selections are rejected immediately without invoking the handler
+	if (objects.Size() > (this->params.maxTxFragSize - APDU_RESPONSE_HEADER_SIZE))
+	{
+		return false;
+	}
+
+	if (header.function == FunctionCode::OPERATE)
+	{
+		auto result = this->control.ValidateSelection(this->sol.seq.num, this->executor->GetTime(), this->params.selectTimeout, objects);
+		if (result != CommandStatus::SUCCESS)
+		{
+			return false;
+		}
+	}
+
+	this->asyncCommands = this->DispatchAsyncCommands(objects, isSelect, opType, objects.Size());
+	this->asyncCommands->request.Set(header, objects);
+	this->asyncCommands->Attach(*this);
+
+	auto timeout = [this]()
+	{
+		if (this->asyncCommands)
+		{
+			SIMPLE_LOG_BLOCK(this->logger, flags::WARN, "Timeout waiting for commands to complete");
+			this->asyncCommands->Timeout();
+			this->CheckForTaskStart();
+		}
+	};
+
+	this->asyncCommandTimer.Restart(this->params.asyncCommandTimeout, timeout);
+
+	// handles requests that didn't contain any commands
+	this->CheckForAsyncCommandResponse();
+
+	return true;
+}
+
+std::shared_ptr<AsyncCommandBatch> OContext::DispatchAsyncCommands(const openpal::RSlice& objects, bool isSelect, OperateType opType, uint32_t maxRequestSize)
+{
+	auto batch = std::make_shared<AsyncCommandBatch>(this->executor, this->params.maxControlsPerRequest, maxRequestSize);
+	AsyncCommandActionAdapter adapter(this->asyncCommandHandler.get(), batch, isSelect, opType);
+	CommandResponseHandler handler(this->params.maxControlsPerRequest, &adapter, nullptr);
+	APDUParser::Parse(objects, handler, &this->logger);
+	return batch;
+}
+
+void OContext::CheckForAsyncCommandResponse()
+{
+	if (this->CanTransmit() && this->asyncCommands && this->asyncCommands->IsComplete())
+	{
+		auto batch = this->asyncCommands;
+		this->CancelAsyncCommands();
+
+		auto respond = [this, &batch](const APDUHeader & header, const RSlice & objects)
+		{
+			return this->RespondToAsyncCommands(*batch, header, objects);
+		};
+
+		batch->request.Process(respond);
+	}
+}
+
+bool OContext::RespondToAsyncCommands(AsyncCommandBatch& batch, const APDUHeader& header, const openpal::RSlice& objects)
+{
+	auto response = this->sol.tx.Start();
+	auto writer = response.GetWriter();
+	response.SetFunction(FunctionCode::RESPONSE);
+	response.SetControl(AppControlField(true, true, false, false, header.control.SEQ));
+
+	// parse the request a second time, the batch replays the recorded statuses into the echo
+	CommandResponseHandler handler(this->params.maxControlsPerRequest, &batch, &writer);
+	auto result = APDUParser::Parse(objects, handler, &this->logger);
+
+	if ((result == ParseResult::OK) && (header.function == FunctionCode::SELECT) && handler.AllCommandsSuccessful())
+	{
+		this->control.Select(header.control.SEQ, this->executor->GetTime(), objects);
+	}
+
+	auto iin = (result == ParseResult::OK) ? handler.Errors() : IINFromParseResult(result);
+	response.SetIIN(iin | this->GetResponseIIN());
+	this->BeginResponseTx(response.GetControl(), response.ToRSlice());
+	return true;
+}
+
+void OContext::CancelAsyncCommands()
+{
+	if (this->asyncCommands)
+	{
+		this->asyncCommands->Detach();
+		this->asyncCommands.reset();
+	}
+
+	this->asyncCommandTimer.Cancel();
+}
+
 OutstationState& OContext::RespondToReadRequest(const APDUHeader& header, const openpal::RSlice& objects)
 {
 	this->history.RecordLastProcessedRequest(header, objects);
@@ -370,6 +606,7 @@ OutstationState& OContext::RespondToReadRequest(const APDUHeader& header, const
 	if (result.second.CON)
 	{
 		this->RestartConfirmTimer();
+		this->PreEncodeNextFragment();
 		return StateSolicitedConfirmWait::Inst();
 	}
 	else
@@ -380,10 +617,23 @@ OutstationState& OContext::RespondToReadRequest(const APDUHeader& header, const
 
 OutstationState& OContext::ContinueMultiFragResponse(const AppSeqNum& seq)
 {
-	auto response = this->sol.tx.Start();
-	auto writer = response.GetWriter();
-	response.SetFunction(FunctionCode::RESPONSE);
-	auto control = this->rspContext.LoadResponse(writer);
+	auto response = this->sol.next;
+
+	if (response.IsValid())
+	{
+		// the fragment was already encoded into the spare buffer while waiting for the confirm
+		this->sol.next = APDUResponse();
+		this->sol.tx.Swap();
+	}
+	else
+	{
+		response = this->sol.tx.Start();
+		auto writer = response.GetWriter();
+		response.SetFunction(FunctionCode::RESPONSE);
+		response.SetControl(this->rspContext.LoadResponse(writer));
+	}
+
+	auto control = response.GetControl();
 	control.SEQ = seq;
 	this->sol.seq.confirmNum = seq;
 	response.SetControl(control);
@@ -393,6 +643,7 @@ OutstationState& OContext::ContinueMultiFragResponse(const AppSeqNum& seq)
 	if (control.CON)
 	{
 		this->RestartConfirmTimer();
+		this->PreEncodeNextFragment();
 		return StateSolicitedConfirmWait::Inst();
 	}
 	else
@@ -401,6 +652,25 @@ OutstationState& OContext::ContinueMultiFragResponse(const AppSeqNum& seq)
 	}
 }
 
+void OContext::PreEncodeNextFragment()
+{
+	// events are only cleared when the fragment that carries them is confirmed, so only
+	// static data can be encoded ahead of the confirm for the previous fragment
+	if (this->params.preEncodeResponses && this->rspContext.HasOnlyStaticSelection())
+	{
+		auto response = this->sol.tx.StartSpare();
+		auto writer = response.GetWriter();
+		response.SetFunction(FunctionCode::RESPONSE);
+		response.SetControl(this->rspContext.LoadResponse(writer));
+		this->sol.next = response;
+	}
+}
+
+bool OContext::HasMoreResponseFragments() const
+{
+	return this->sol.next.IsValid() || this->rspContext.HasSelection();
+}
+
 bool OContext::CanTransmit() const
 {
 	return isOnline && !isTransmitting;
@@ -408,7 +678,12 @@ bool OContext::CanTransmit() const
 
 IINField OContext::GetResponseIIN()
 {
-	return this->staticIIN | this->GetDynamicIIN() | this->application->GetApplicationIIN().ToIIN();
+	const auto iin = this->staticIIN | this->GetDynamicIIN() | this->application->GetApplicationIIN().ToIIN();
+
+	// IIN1.0 is only reported in the first response after a broadcast
+	this->staticIIN.ClearBit(IINBit::ALL_STATIONS);
+
+	return iin;
 }
 
 IINField OContext::GetDynamicIIN()
@@ -424,7 +699,7 @@ IINField OContext::GetDynamicIIN()
 	return ret;
 }
 
-void OContext::ParseHeader(const openpal::RSlice& apdu)
+void OContext::ParseHeader(const openpal::RSlice& apdu, bool isBroadcast)
 {
 	FORMAT_HEX_BLOCK(this->logger, flags::APP_HEX_RX, apdu, 18, 18);
 
@@ -452,12 +727,20 @@ void OContext::ParseHeader(const openpal::RSlice& apdu)
 
 	auto objects = apdu.Skip(APDU_REQUEST_HEADER_SIZE);
 
-	this->ProcessAPDU(apdu, header, objects);
+	if (isBroadcast)
+	{
+		this->ProcessBroadcastRequest(header, objects);
+	}
+	else
+	{
+		this->ProcessAPDU(apdu, header, objects);
+	}
 }
 
 void OContext::CheckForTaskStart()
 {
 	// do these checks in order of priority
+	this->CheckForAsyncCommandResponse();
 	this->CheckForDeferredRequest();
 	this->CheckForUnsolicited();
 }
@@ -467,6 +750,24 @@ void OContext::SetRestartIIN()
 	this->staticIIN.SetBit(IINBit::DEVICE_RESTART);
 }
 
+StackStatistics::Outstation OContext::GetStatistics() const
+{
+	auto statistics = this->statistics;
+	statistics.numCompactedStaticValues = this->database.NumCompactedStaticValues();
+	statistics.numStaticBytesSaved = this->database.NumStaticBytesSaved();
+	statistics.requestProcessing = this->requestProcessing.Summarize();
+	statistics.eventAge = this->eventBuffer.EventAge().Summarize();
+	return statistics;
+}
+
+OutstationLatencies OContext::GetLatencies() const
+{
+	OutstationLatencies latencies;
+	latencies.requestProcessing = this->requestProcessing;
+	latencies.eventAge = this->eventBuffer.EventAge();
+	return latencies;
+}
+
 IUpdateHandler& OContext::GetUpdateHanlder()
 {
 	return this->database;
@@ -484,7 +785,7 @@ void OContext::ProcessRequestNoAck(const APDUHeader& header, const openpal::RSli
 	switch (header.function)
 	{
 	case(FunctionCode::DIRECT_OPERATE_NR) :
-		this->HandleDirectOperate(objects, OperateType::DirectOperateNoAck, nullptr); // no object writer, this is a no ack code
+		this->DirectOperateNoAck(objects);
 		break;
 	default:
 		FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Ignoring NR function code: %s", FunctionCodeToString(header.function));
@@ -492,6 +793,43 @@ void OContext::ProcessRequestNoAck(const APDUHeader& header, const openpal::RSli
 	}
 }
 
+void OContext::ProcessBroadcastRequest(const APDUHeader& header, const openpal::RSlice& objects)
+{
+	++this->statistics.numBroadcastRequests;
+	this->staticIIN.SetBit(IINBit::ALL_STATIONS);
+
+	switch (header.function)
+	{
+	case(FunctionCode::WRITE) :
+		this->HandleWrite(objects);
+		break;
+	case(FunctionCode::DIRECT_OPERATE) :
+	case(FunctionCode::DIRECT_OPERATE_NR) :
+		// nobody is listening for the echo, so these are equivalent
+		this->DirectOperateNoAck(objects);
+		break;
+	case(FunctionCode::ASSIGN_CLASS) :
+		this->HandleAssignClass(objects);
+		break;
+	default:
+		FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Ignoring broadcast function code: %s", FunctionCodeToString(header.function));
+		break;
+	}
+}
+
+void OContext::DirectOperateNoAck(const openpal::RSlice& objects)
+{
+	if (this->asyncCommandHandler)
+	{
+		// there's no response, so the completions are simply ignored
+		this->DispatchAsyncCommands(objects, false, OperateType::DirectOperateNoAck, 0);
+	}
+	else
+	{
+		this->HandleDirectOperate(objects, OperateType::DirectOperateNoAck, nullptr); // no object writer, this is a no ack code
+	}
+}
+
 IINField OContext::HandleNonReadResponse(const APDUHeader& header, const openpal::RSlice& objects, HeaderWriter& writer)
 {
 	switch (header.function)
@@ -523,6 +861,7 @@ IINField OContext::HandleNonReadResponse(const APDUHeader& header, const openpal
 
 Pair<IINField, AppControlField> OContext::HandleRead(const openpal::RSlice& objects, HeaderWriter& writer)
 {
+	this->sol.next = APDUResponse(); // discard any fragment encoded ahead for a previous response
 	this->rspContext.Reset();
 	this->eventBuffer.Unselect(); // always un-select any previously selected points when we start a new read request
 	this->database.GetStaticSelector().Unselect();
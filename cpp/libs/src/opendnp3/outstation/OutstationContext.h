@@ -22,6 +22,7 @@
 #define OPENDNP3_OUTSTATIONCONTEXT_H
 
 #include "opendnp3/LayerInterfaces.h"
+#include "opendnp3/StackStatistics.h"
 
 #include "opendnp3/gen/SecurityStatIndex.h"
 
@@ -35,8 +36,12 @@
 #include "opendnp3/outstation/EventBuffer.h"
 #include "opendnp3/outstation/ResponseContext.h"
 #include "opendnp3/outstation/ICommandHandler.h"
+#include "opendnp3/outstation/IAsyncCommandHandler.h"
+#include "opendnp3/outstation/AsyncCommandBatch.h"
 #include "opendnp3/outstation/IOutstationApplication.h"
 #include "opendnp3/outstation/OutstationStates.h"
+#include "opendnp3/outstation/UnsolicitedBatcher.h"
+#include "opendnp3/outstation/OutstationLatencies.h"
 
 #include <openpal/executor/TimerRef.h>
 #include <openpal/logging/Logger.h>
@@ -64,6 +69,16 @@ public:
 	            const std::shared_ptr<ICommandHandler>& commandHandler,
 	            const std::shared_ptr<IOutstationApplication>& application);
 
+	OContext(	const OutstationConfig& config,
+	            const DatabaseSizes& dbSizes,
+	            const openpal::Logger& logger,
+	            const std::shared_ptr<openpal::IExecutor>& executor,
+	            const std::shared_ptr<ILowerLayer>& lower,
+	            const std::shared_ptr<IAsyncCommandHandler>& asyncCommandHandler,
+	            const std::shared_ptr<IOutstationApplication>& application);
+
+	~OContext();
+
 	/// ----- Implement IUpperLayer ------
 
 	virtual bool OnLowerLayerUp() override;
@@ -74,6 +89,8 @@ public:
 
 	virtual bool OnReceive(const openpal::RSlice& fragment) override final;
 
+	virtual bool OnReceiveBroadcast(const openpal::RSlice& fragment) override final;
+
 	/// --- Other public members ----
 
 	void CheckForTaskStart();
@@ -84,12 +101,29 @@ public:
 
 	void SetRestartIIN();
 
+	StackStatistics::Outstation GetStatistics() const;
+
+	OutstationLatencies GetLatencies() const;
+
 private:
 
+	OContext(	const OutstationConfig& config,
+	            const DatabaseSizes& dbSizes,
+	            const openpal::Logger& logger,
+	            const std::shared_ptr<openpal::IExecutor>& executor,
+	            const std::shared_ptr<ILowerLayer>& lower,
+	            const std::shared_ptr<ICommandHandler>& commandHandler,
+	            const std::shared_ptr<IAsyncCommandHandler>& asyncCommandHandler,
+	            const std::shared_ptr<IOutstationApplication>& application);
+
 	/// ---- Helper functions that operate on the current state, and may return a new state ----
 
 	OutstationState& ContinueMultiFragResponse(const AppSeqNum& seq);
 
+	void PreEncodeNextFragment();
+
+	bool HasMoreResponseFragments() const;
+
 	OutstationState& RespondToReadRequest(const APDUHeader& header, const openpal::RSlice& objects);
 
 	OutstationState& ProcessNewRequest(const APDUHeader& header, const openpal::RSlice& objects);
@@ -98,6 +132,20 @@ private:
 
 	void RespondToNonReadRequest(const APDUHeader& header, const openpal::RSlice& objects);
 
+	/// ---- asynchronous command handling ----
+
+	/// Dispatches a SELECT / OPERATE / DIRECT_OPERATE to the async handler, deferring the response
+	/// @return false if the request should be answered immediately
+	bool BeginAsyncCommands(const APDUHeader& header, const openpal::RSlice& objects);
+
+	std::shared_ptr<AsyncCommandBatch> DispatchAsyncCommands(const openpal::RSlice& objects, bool isSelect, OperateType opType, uint32_t maxRequestSize);
+
+	void CheckForAsyncCommandResponse();
+
+	bool RespondToAsyncCommands(AsyncCommandBatch& batch, const APDUHeader& header, const openpal::RSlice& objects);
+
+	void CancelAsyncCommands();
+
 	/// ---- Processing functions --------
 
 	void ProcessAPDU(const openpal::RSlice& apdu, const APDUHeader& header, const openpal::RSlice& objects);
@@ -108,7 +156,7 @@ private:
 
 	/// ---- common helper methods ----
 
-	void ParseHeader(const openpal::RSlice& apdu);
+	void ParseHeader(const openpal::RSlice& apdu, bool isBroadcast);
 
 	void BeginResponseTx(const AppControlField& control, const openpal::RSlice& response);
 
@@ -124,6 +172,8 @@ private:
 
 	void CheckForUnsolicited();
 
+	void StartUnsolHoldTimer();
+
 	bool CanTransmit() const;
 
 	IINField GetResponseIIN();
@@ -143,6 +193,11 @@ private:
 	/// Handles no-response function codes.
 	void ProcessRequestNoAck(const APDUHeader& header, const openpal::RSlice& objects);
 
+	/// Handles requests sent to a broadcast address. Nothing is ever sent in reply, IIN1.0 is set in the next response instead.
+	void ProcessBroadcastRequest(const APDUHeader& header, const openpal::RSlice& objects);
+
+	void DirectOperateNoAck(const openpal::RSlice& objects);
+
 	// ------ Function Handlers ------
 
 	IINField HandleWrite(const openpal::RSlice& objects);
@@ -161,6 +216,7 @@ private:
 	const std::shared_ptr<openpal::IExecutor> executor;
 	const std::shared_ptr<ILowerLayer> lower;
 	const std::shared_ptr<ICommandHandler> commandHandler;
+	const std::shared_ptr<IAsyncCommandHandler> asyncCommandHandler;
 	const std::shared_ptr<IOutstationApplication> application;
 
 	// ------ Database, event buffer, and response tracking
@@ -181,11 +237,24 @@ private:
 
 	// ------ Dynamic state related to controls ------
 	ControlState control;
+	std::shared_ptr<AsyncCommandBatch> asyncCommands;
+	openpal::TimerRef asyncCommandTimer;
 
 	// ------ Dynamic state related to solicited and unsolicited modes ------
 	OutstationSolState  sol;
 	OutstationUnsolState unsol;
+	UnsolicitedBatcher unsolBatcher;
+	openpal::TimerRef unsolHoldTimer;
 	OutstationState* state = &StateIdle::Inst();
+
+	// ------ Statistics ------
+	StackStatistics::Outstation statistics;
+
+	// ------ Latency measurement, times are monotonic microseconds and negative when not measured ------
+	int64_t rxMicros = -1;
+	int64_t deferredMicros = -1;
+	int64_t requestMicros = -1;
+	openpal::Histogram requestProcessing;
 };
 
 
@@ -93,7 +93,7 @@ OutstationState& StateSolicitedConfirmWait::OnConfirm(OContext& ctx, const APDUH
 	ctx.confirmTimer.Cancel();
 	ctx.eventBuffer.ClearWritten();
 
-	if (ctx.rspContext.HasSelection())
+	if (ctx.HasMoreResponseFragments())
 	{
 		return ctx.ContinueMultiFragResponse(AppSeqNum(header.control.SEQ).Next());
 	}
@@ -106,6 +106,7 @@ OutstationState& StateSolicitedConfirmWait::OnConfirm(OContext& ctx, const APDUH
 OutstationState& StateSolicitedConfirmWait::OnConfirmTimeout(OContext& ctx)
 {
 	SIMPLE_LOG_BLOCK(ctx.logger, flags::WARN, "solicited confirm timeout");
+	ctx.sol.next = APDUResponse();
 	return StateIdle::Inst();
 }
 
@@ -191,7 +192,7 @@ OutstationState& StateUnsolicitedConfirmWait::OnNewReadRequest(OContext& ctx, co
 OutstationState& StateUnsolicitedConfirmWait::OnNewNonReadRequest(OContext& ctx, const APDUHeader& header, const openpal::RSlice& objects)
 {
 	ctx.deferred.Reset();
-	ctx.confirmTimer.Cancel();
+	// keep the confirm timer running, the unsolicited response may have been lost
 	ctx.RespondToNonReadRequest(header, objects);
 	return *this;
 }
@@ -36,6 +36,11 @@ bool ResponseContext::HasSelection() const
 	return pStaticLoader->HasAnySelection() || pEventLoader->HasAnySelection();
 }
 
+bool ResponseContext::HasOnlyStaticSelection() const
+{
+	return pStaticLoader->HasAnySelection() && !pEventLoader->HasAnySelection();
+}
+
 void ResponseContext::Reset()
 {
 	fragmentCount = 0;
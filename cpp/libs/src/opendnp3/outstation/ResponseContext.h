@@ -47,6 +47,9 @@ public:
 
 	bool HasSelection() const;
 
+	/// true if there is more data to send and all of it is static
+	bool HasOnlyStaticSelection() const;
+
 	void Reset();
 
 	AppControlField LoadResponse(HeaderWriter& writer);
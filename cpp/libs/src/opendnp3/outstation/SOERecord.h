@@ -105,6 +105,10 @@ public:
 	EventClass clazz;
 	bool selected;
 	bool written;
+
+	/// monotonic time in microseconds when the event was recorded, 0 if not measured
+	int64_t recordedMicros = 0;
+
 	void Reset();
 
 	DNPTime GetTime() const
@@ -112,6 +116,11 @@ public:
 		return time;
 	}
 
+	uint16_t GetIndex() const
+	{
+		return index;
+	}
+
 private:
 
 	SOERecord(EventType type, EventClass clazz, uint16_t index, DNPTime time, uint8_t flags);
@@ -23,6 +23,7 @@
 
 #include "opendnp3/app/Range.h"
 #include "opendnp3/app/HeaderWriter.h"
+#include "opendnp3/app/HeaderCost.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 #include "opendnp3/app/SecurityStat.h"
 #include "opendnp3/outstation/Cell.h"
@@ -40,10 +41,23 @@
 namespace opendnp3
 {
 
+/// Number of bitfield values gathered from the database before being packed into a response
+const uint32_t BITFIELD_BATCH_SIZE = 64;
+
 template <class Spec>
 struct StaticWriter
 {
-	typedef bool (*Function)(openpal::ArrayView<Cell<Spec>, uint16_t>& view, HeaderWriter& writer, Range& range);
+	typedef bool (*Function)(openpal::ArrayView<Cell<Spec>, uint16_t>& view, HeaderWriter& writer, Range& range, bool optimizeQualifiers);
+};
+
+/// The extent of a header that will be written with index prefixes
+struct PrefixedHeaderPlan
+{
+	/// position in the view of the last point in the header
+	uint16_t stop = 0;
+
+	/// size of the count and index prefixes
+	uint32_t prefixSize = 0;
 };
 
 StaticWriter<BinarySpec>::Function GetStaticWriter(StaticBinaryVariation variation);
@@ -64,30 +78,144 @@ StaticWriter<TimeAndIntervalSpec>::Function GetStaticWriter(StaticTimeAndInterva
 
 StaticWriter<SecurityStatSpec>::Function GetStaticWriter(StaticSecurityStatVariation variation);
 
-template <class Spec, class IndexType >
-bool LoadWithRangeIterator(openpal::ArrayView<Cell<Spec>, uint16_t>& view, RangeWriteIterator<IndexType, typename Spec::meas_t>& iterator, Range& range)
+template <class Spec, class IndexType, class Codec>
+bool LoadWithRangeIterator(openpal::ArrayView<Cell<Spec>, uint16_t>& view, RangeWriteIterator<IndexType, typename Spec::meas_t, Codec>& iterator, Range& range)
 {
-	const Cell<Spec>& start = view[range.start];
-	uint16_t nextIndex = start.config.vIndex;
+	const auto variation = view[range.start].selection.variation;
+	const uint16_t firstIndex = view[range.start].config.vIndex;
+
+	// find the run of selected values that map to contiguous indices with the same variation
+	uint32_t num = 0;
+	uint32_t pos = range.start;
 
 	while (
-	    range.IsValid() &&
-	    view[range.start].selection.selected &&
-	    (view[range.start].selection.variation == start.selection.variation) &&
-	    (view[range.start].config.vIndex == nextIndex)
+	    (pos <= range.stop) &&
+	    view[pos].selection.selected &&
+	    (view[pos].selection.variation == variation) &&
+	    (view[pos].config.vIndex == static_cast<uint16_t>(firstIndex + num))
 	)
 	{
-		if (iterator.Write(view[range.start].selection.value))
+		++num;
+		++pos;
+	}
+
+	const uint16_t first = range.start;
+	auto getValue = [&view, first](uint32_t i) -> const typename Spec::meas_t&
+	{
+		return view[static_cast<uint16_t>(first + i)].selection.value;
+	};
+
+	// encode the whole run in one pass
+	const auto written = iterator.Write(num, getValue);
+
+	// deselect the written values and advance the range
+	for (uint32_t i = 0; i < written; ++i)
+	{
+		view[range.start].selection.selected = false;
+		range.Advance();
+	}
+
+	return written == num;
+}
+
+/**
+* Starting at range.start, gather the runs of selected points with the same variation as long as each run
+* costs fewer bytes inside an index-prefixed header than in a start-stop header of its own. The first run
+* that does not stops the scan and begins the next header.
+*
+* @return true if a single index-prefixed header is smaller than a start-stop header per gathered run
+*/
+template <class Spec>
+bool PlanPrefixedHeader(const openpal::ArrayView<Cell<Spec>, uint16_t>& view, const Range& range, uint32_t objectSize, PrefixedHeaderPlan& plan)
+{
+	const auto variation = view[range.start].selection.variation;
+
+	uint32_t count = 0;
+	uint32_t numRuns = 0;
+	uint16_t maxIndex = 0;
+	uint32_t prefixSize = 1;
+	uint32_t rangeCost = 0;
+	uint32_t pos = range.start;
+
+	while (pos <= range.stop)
+	{
+		if (!view[pos].selection.selected)
 		{
-			// deselect the value and advance the range
-			view[range.start].selection.selected = false;
-			range.Advance();
-			++nextIndex;
+			// gaps in the selection cost nothing in a prefixed header
+			++pos;
+			continue;
 		}
-		else
+
+		if (view[pos].selection.variation != variation)
 		{
-			return false;
+			break;
+		}
+
+		// measure the run of selected values that map to contiguous indices
+		const uint16_t first = view[pos].config.vIndex;
+		uint32_t num = 0;
+
+		while (
+		    ((pos + num) <= range.stop) &&
+		    view[pos + num].selection.selected &&
+		    (view[pos + num].selection.variation == variation) &&
+		    (view[pos + num].config.vIndex == static_cast<uint16_t>(first + num))
+		)
+		{
+			++num;
 		}
+
+		const uint16_t last = static_cast<uint16_t>(first + num - 1);
+		const uint16_t newMaxIndex = openpal::Max<uint16_t>(maxIndex, last);
+
+		if ((count + num) > openpal::UInt16::Max)
+		{
+			break;
+		}
+
+		const auto newPrefixSize = HeaderCost::PrefixSize(count + num, newMaxIndex);
+
+		// bytes added to the prefixed header by this run, including widening the existing count and prefixes
+		const auto marginal = num * (newPrefixSize + objectSize) + (newPrefixSize - prefixSize) * (count + 1);
+		const auto standalone = HeaderCost::StartStop(HeaderCost::StartStopIndexSize(first, last), num, objectSize);
+
+		if (marginal >= standalone)
+		{
+			break;
+		}
+
+		count += num;
+		++numRuns;
+		maxIndex = newMaxIndex;
+		prefixSize = newPrefixSize;
+		rangeCost += standalone;
+		pos += num;
+		plan.stop = static_cast<uint16_t>(pos - 1);
+	}
+
+	plan.prefixSize = prefixSize;
+
+	return (numRuns > 1) && (HeaderCost::CountWithPrefix(prefixSize, count, objectSize) < rangeCost);
+}
+
+template <class Spec, class IndexType, class Codec>
+bool LoadWithPrefixedIterator(openpal::ArrayView<Cell<Spec>, uint16_t>& view, PrefixedWriteIterator<IndexType, typename Spec::meas_t, Codec>& iterator, Range& range, uint16_t stop)
+{
+	while (range.IsValid() && (range.start <= stop))
+	{
+		auto& cell = view[range.start];
+
+		if (cell.selection.selected)
+		{
+			if (!iterator.Write(cell.selection.value, static_cast<typename IndexType::Type>(cell.config.vIndex)))
+			{
+				return false;
+			}
+
+			cell.selection.selected = false;
+		}
+
+		range.Advance();
 	}
 
 	return true;
@@ -96,25 +224,47 @@ bool LoadWithRangeIterator(openpal::ArrayView<Cell<Spec>, uint16_t>& view, Range
 template <class Spec, class IndexType>
 bool LoadWithBitfieldIterator(openpal::ArrayView<Cell<Spec>, uint16_t>& view, BitfieldRangeWriteIterator<IndexType>& iterator, Range& range)
 {
-	const Cell<Spec>& start = view[range.start];
+	const auto variation = view[range.start].selection.variation;
+	uint16_t nextIndex = view[range.start].config.vIndex;
 
-	uint16_t nextIndex = start.config.vIndex;
+	// values are gathered in batches so that the iterator can pack whole bytes
+	uint8_t values[BITFIELD_BATCH_SIZE];
 
-	while (
-	    range.IsValid() &&
-	    view[range.start].selection.selected &&
-	    (view[range.start].selection.variation == start.selection.variation) &&
-	    (view[range.start].config.vIndex == nextIndex)
-	)
+	while (range.IsValid())
 	{
-		if (iterator.Write(view[range.start].selection.value.value))
+		uint32_t num = 0;
+		uint32_t pos = range.start;
+
+		while (
+		    (num < BITFIELD_BATCH_SIZE) &&
+		    (pos <= range.stop) &&
+		    view[pos].selection.selected &&
+		    (view[pos].selection.variation == variation) &&
+		    (view[pos].config.vIndex == static_cast<uint16_t>(nextIndex + num))
+		)
+		{
+			values[num] = view[pos].selection.value.value ? 1 : 0;
+			++num;
+			++pos;
+		}
+
+		if (num == 0)
+		{
+			return true;
+		}
+
+		const auto written = iterator.Write(values, num);
+
+		// deselect the written values and advance the range
+		for (uint32_t i = 0; i < written; ++i)
 		{
-			// deselect the value and advance the range
 			view[range.start].selection.selected = false;
 			range.Advance();
-			++nextIndex;
 		}
-		else
+
+		nextIndex = static_cast<uint16_t>(nextIndex + written);
+
+		if (written < num)
 		{
 			return false;
 		}
@@ -124,7 +274,7 @@ bool LoadWithBitfieldIterator(openpal::ArrayView<Cell<Spec>, uint16_t>& view, Bi
 }
 
 template <class Spec, class GV>
-bool WriteSingleBitfield(openpal::ArrayView<Cell<Spec>, uint16_t>& view, HeaderWriter& writer, Range& range)
+bool WriteSingleBitfield(openpal::ArrayView<Cell<Spec>, uint16_t>& view, HeaderWriter& writer, Range& range, bool /*optimizeQualifiers*/)
 {
 	auto start = view[range.start].config.vIndex;
 	auto stop = view[range.stop].config.vIndex;
@@ -144,21 +294,36 @@ bool WriteSingleBitfield(openpal::ArrayView<Cell<Spec>, uint16_t>& view, HeaderW
 
 
 template <class Spec, class Serializer>
-bool WriteWithSerializer(openpal::ArrayView<Cell<Spec>, uint16_t>& view, HeaderWriter& writer, Range& range)
+bool WriteWithSerializer(openpal::ArrayView<Cell<Spec>, uint16_t>& view, HeaderWriter& writer, Range& range, bool optimizeQualifiers)
 {
+	PrefixedHeaderPlan plan;
+	if (optimizeQualifiers && PlanPrefixedHeader<Spec>(view, range, Serializer::Size(), plan))
+	{
+		if (plan.prefixSize == 1)
+		{
+			auto iter = writer.IterateOverFixedSizeCountWithPrefix<openpal::UInt8, Serializer>(QualifierCode::UINT8_CNT_UINT8_INDEX);
+			return LoadWithPrefixedIterator<Spec, openpal::UInt8>(view, iter, range, plan.stop);
+		}
+		else
+		{
+			auto iter = writer.IterateOverFixedSizeCountWithPrefix<openpal::UInt16, Serializer>(QualifierCode::UINT16_CNT_UINT16_INDEX);
+			return LoadWithPrefixedIterator<Spec, openpal::UInt16>(view, iter, range, plan.stop);
+		}
+	}
+
 	auto start = view[range.start].config.vIndex;
 	auto stop = view[range.stop].config.vIndex;
 	auto mapped = Range::From(start, stop);
 
 	if (mapped.IsOneByte())
 	{
-		auto iter = writer.IterateOverRange<openpal::UInt8, typename Serializer::Target>(QualifierCode::UINT8_START_STOP, Serializer::Inst(), static_cast<uint8_t>(mapped.start));
-		return LoadWithRangeIterator<Spec, openpal::UInt8>(view, iter, range);
+		auto iter = writer.IterateOverFixedSizeRange<openpal::UInt8, Serializer>(QualifierCode::UINT8_START_STOP, static_cast<uint8_t>(mapped.start));
+		return LoadWithRangeIterator<Spec, openpal::UInt8, FixedSizeCodec<Serializer>>(view, iter, range);
 	}
 	else
 	{
-		auto iter = writer.IterateOverRange<openpal::UInt16, typename Serializer::Target>(QualifierCode::UINT16_START_STOP, Serializer::Inst(), mapped.start);
-		return LoadWithRangeIterator<Spec, openpal::UInt16>(view, iter, range);
+		auto iter = writer.IterateOverFixedSizeRange<openpal::UInt16, Serializer>(QualifierCode::UINT16_START_STOP, mapped.start);
+		return LoadWithRangeIterator<Spec, openpal::UInt16, FixedSizeCodec<Serializer>>(view, iter, range);
 	}
 }
 
@@ -0,0 +1,110 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "UnsolicitedBatcher.h"
+
+using namespace openpal;
+
+namespace opendnp3
+{
+
+UnsolicitedBatcher::UnsolicitedBatcher(const OutstationParams& params) :
+	classes
+	{
+		ClassHold(params.unsolClass1HoldTime, params.unsolClass1MaxEvents),
+		ClassHold(params.unsolClass2HoldTime, params.unsolClass2MaxEvents),
+		ClassHold(params.unsolClass3HoldTime, params.unsolClass3MaxEvents)
+	}
+{}
+
+bool UnsolicitedBatcher::IsReady(const ClassField& mask, const EventBuffer& buffer, const MonotonicTimestamp& now)
+{
+	bool ready = false;
+
+	for (uint8_t i = 0; i < NUM_CLASSES; ++i)
+	{
+		auto& hold = classes[i];
+		const auto ec = static_cast<EventClass>(i);
+		const auto count = buffer.NumUnwritten(ec);
+
+		if (!mask.HasEventType(ec) || count == 0)
+		{
+			hold.start = MonotonicTimestamp::Max();
+			continue;
+		}
+
+		if (!hold.IsHolding())
+		{
+			hold.start = now;
+		}
+
+		const bool countReached = (hold.maxEvents > 0) && (count >= hold.maxEvents);
+		const bool timeElapsed = !(now < hold.start.Add(hold.holdTime));
+
+		if (countReached || timeElapsed)
+		{
+			ready = true;
+		}
+	}
+
+	return ready;
+}
+
+MonotonicTimestamp UnsolicitedBatcher::NextExpiration() const
+{
+	auto next = MonotonicTimestamp::Max();
+
+	for (auto& hold : classes)
+	{
+		if (hold.IsHolding())
+		{
+			auto expiration = hold.start.Add(hold.holdTime);
+			if (expiration < next)
+			{
+				next = expiration;
+			}
+		}
+	}
+
+	return next;
+}
+
+void UnsolicitedBatcher::OnLoaded(const EventBuffer& buffer)
+{
+	for (uint8_t i = 0; i < NUM_CLASSES; ++i)
+	{
+		// events that did not fit in the fragment are already overdue, so keep their start time
+		if (buffer.NumUnwritten(static_cast<EventClass>(i)) == 0)
+		{
+			classes[i].start = MonotonicTimestamp::Max();
+		}
+	}
+}
+
+void UnsolicitedBatcher::Reset()
+{
+	for (auto& hold : classes)
+	{
+		hold.start = MonotonicTimestamp::Max();
+	}
+}
+
+}
+
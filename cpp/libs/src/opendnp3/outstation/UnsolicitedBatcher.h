@@ -0,0 +1,88 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_UNSOLICITEDBATCHER_H
+#define OPENDNP3_UNSOLICITEDBATCHER_H
+
+#include <openpal/executor/MonotonicTimestamp.h>
+#include <openpal/util/Uncopyable.h>
+
+#include "opendnp3/outstation/OutstationParams.h"
+#include "opendnp3/outstation/EventBuffer.h"
+
+namespace opendnp3
+{
+
+/**
+* Decides when buffered events should be reported in an unsolicited response.
+*
+* Each event class has a hold time, measured from when unreported events of that class were first observed,
+* and an optional event count that releases the class early. When any class in the unsolicited mask becomes
+* ready, all classes in the mask are reported together so that held events ride along in the same fragment.
+*/
+class UnsolicitedBatcher : private openpal::Uncopyable
+{
+
+public:
+
+	explicit UnsolicitedBatcher(const OutstationParams& params);
+
+	/// Update the hold state from the event buffer and return true if an unsolicited response should be sent now
+	bool IsReady(const ClassField& mask, const EventBuffer& buffer, const openpal::MonotonicTimestamp& now);
+
+	/// The earliest time at which a held class will become ready, MonotonicTimestamp::Max() if nothing is held
+	openpal::MonotonicTimestamp NextExpiration() const;
+
+	/// Restart the hold of every class whose events were all loaded into an unsolicited response
+	void OnLoaded(const EventBuffer& buffer);
+
+	void Reset();
+
+private:
+
+	struct ClassHold
+	{
+		ClassHold(const openpal::TimeDuration& holdTime, uint32_t maxEvents) :
+			holdTime(holdTime),
+			maxEvents(maxEvents),
+			start(openpal::MonotonicTimestamp::Max())
+		{}
+
+		bool IsHolding() const
+		{
+			return !start.IsMax();
+		}
+
+		const openpal::TimeDuration holdTime;
+		const uint32_t maxEvents;
+
+		// time at which unreported events of this class were first observed
+		openpal::MonotonicTimestamp start;
+	};
+
+	static const uint8_t NUM_CLASSES = 3;
+
+	ClassHold classes[NUM_CLASSES];
+};
+
+}
+
+#endif
+
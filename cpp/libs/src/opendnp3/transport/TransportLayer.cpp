@@ -35,9 +35,9 @@ namespace opendnp3
 {
 
 
-TransportLayer::TransportLayer(const openpal::Logger& logger, uint32_t maxRxFragSize) :
+TransportLayer::TransportLayer(const openpal::Logger& logger, uint32_t maxRxFragSize, const std::shared_ptr<BufferPool>& pool) :
 	logger(logger),
-	receiver(logger, maxRxFragSize),
+	receiver(logger, maxRxFragSize, pool),
 	transmitter(logger)
 {
 
@@ -85,14 +85,40 @@ bool TransportLayer::BeginTransmit(const RSlice& apdu)
 ///////////////////////////////////////
 
 bool TransportLayer::OnReceive(const RSlice& tpdu)
+{
+	return this->Receive(tpdu, false);
+}
+
+bool TransportLayer::OnReceiveBroadcast(const RSlice& tpdu)
+{
+	return this->Receive(tpdu, true);
+}
+
+bool TransportLayer::Receive(const RSlice& tpdu, bool isBroadcast)
 {
 	if (isOnline)
 	{
+		if (isBroadcast != isRxBroadcast)
+		{
+			// unicast and broadcast segments can't belong to the same APDU
+			receiver.DiscardPartialFragment();
+			isRxBroadcast = isBroadcast;
+		}
+
 		auto apdu = receiver.ProcessReceive(tpdu);
 		if (apdu.IsNotEmpty() && upper)
 		{
-			upper->OnReceive(apdu);
+			if (isBroadcast)
+			{
+				upper->OnReceiveBroadcast(apdu);
+			}
+			else
+			{
+				upper->OnReceive(apdu);
+			}
 		}
+		// the fragment has been processed synchronously, so the buffer can go back to the pool
+		receiver.ReleaseIfIdle();
 		return true;
 	}
 	else
@@ -170,6 +196,7 @@ bool TransportLayer::OnLowerLayerDown()
 	isOnline = false;
 	isSending = false;
 	receiver.Reset();
+	receiver.ReleaseIfIdle();
 
 	if (upper)
 	{
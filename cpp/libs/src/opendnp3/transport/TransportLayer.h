@@ -42,7 +42,7 @@ class TransportLayer : public IUpperLayer, public ILowerLayer
 
 public:
 
-	TransportLayer(const openpal::Logger& logger, uint32_t maxRxFragSize);
+	TransportLayer(const openpal::Logger& logger, uint32_t maxRxFragSize, const std::shared_ptr<BufferPool>& pool = nullptr);
 
 	/// ILowerLayer
 
@@ -51,6 +51,7 @@ public:
 	/// IUpperLayer
 
 	virtual bool OnReceive(const openpal::RSlice&) override final;
+	virtual bool OnReceiveBroadcast(const openpal::RSlice&) override final;
 	virtual bool OnLowerLayerUp() override final;
 	virtual bool OnLowerLayerDown() override final;
 	virtual bool OnSendResult(bool isSuccess) override final;
@@ -61,8 +62,16 @@ public:
 
 	StackStatistics::Transport GetStatistics() const;
 
+	/// Number of pooled or heap buffer bytes currently held by the layer
+	uint32_t AttachedBytes() const
+	{
+		return receiver.AttachedBytes();
+	}
+
 private:
 
+	bool Receive(const openpal::RSlice& tpdu, bool isBroadcast);
+
 	openpal::Logger logger;
 
 	IUpperLayer* upper = nullptr;
@@ -71,6 +80,7 @@ private:
 	// ---- state ----
 	bool isOnline = false;
 	bool isSending = false;
+	bool isRxBroadcast = false;
 
 	// ----- Transmitter and Receiver Classes ------
 	TransportRx receiver;
@@ -33,9 +33,9 @@ using namespace openpal;
 namespace opendnp3
 {
 
-TransportRx::TransportRx(const Logger& logger, uint32_t maxRxFragSize) :
+TransportRx::TransportRx(const Logger& logger, uint32_t maxRxFragSize, const std::shared_ptr<BufferPool>& pool) :
 	logger(logger),
-	rxBuffer(maxRxFragSize),
+	rxBuffer(maxRxFragSize, pool),
 	numBytesRead(0)
 {
 
@@ -47,6 +47,24 @@ void TransportRx::Reset()
 	this->ClearRxBuffer();
 }
 
+void TransportRx::DiscardPartialFragment()
+{
+	if (numBytesRead > 0)
+	{
+		++statistics.numTransportDiscard;
+		SIMPLE_LOG_BLOCK(logger, flags::WARN, "Discarding partially received fragment");
+		this->ClearRxBuffer();
+	}
+}
+
+void TransportRx::ReleaseIfIdle()
+{
+	if (numBytesRead == 0)
+	{
+		rxBuffer.Release();
+	}
+}
+
 void TransportRx::ClearRxBuffer()
 {
 	numBytesRead = 0;
@@ -24,9 +24,9 @@
 #include "opendnp3/StackStatistics.h"
 #include "opendnp3/transport/TransportConstants.h"
 #include "opendnp3/transport/TransportSeqNum.h"
+#include "opendnp3/PooledBuffer.h"
 
 #include <openpal/container/RSlice.h>
-#include <openpal/container/Buffer.h>
 #include <openpal/logging/Logger.h>
 
 namespace opendnp3
@@ -39,12 +39,23 @@ class TransportRx
 {
 
 public:
-	TransportRx(const openpal::Logger&, uint32_t maxRxFragSize);
+	TransportRx(const openpal::Logger&, uint32_t maxRxFragSize, const std::shared_ptr<BufferPool>& pool);
 
 	openpal::RSlice ProcessReceive(const openpal::RSlice& input);
 
 	void Reset();
 
+	/// Drop the bytes of a partially received fragment, if any
+	void DiscardPartialFragment();
+
+	/// Return the rx buffer to the pool if no fragment is being assembled. Invalidates the last returned fragment.
+	void ReleaseIfIdle();
+
+	uint32_t AttachedBytes() const
+	{
+		return rxBuffer.AttachedBytes();
+	}
+
 	const StackStatistics::Transport::Rx& Statistics() const
 	{
 		return statistics;
@@ -61,7 +72,7 @@ private:
 	openpal::Logger logger;
 	StackStatistics::Transport::Rx statistics;
 
-	openpal::Buffer rxBuffer;
+	PooledBuffer rxBuffer;
 	uint32_t numBytesRead;
 
 	TransportSeqNum sequence;
@@ -25,8 +25,8 @@ using namespace openpal;
 namespace opendnp3
 {
 
-TransportStack::TransportStack(const openpal::Logger& logger, const std::shared_ptr<openpal::IExecutor>& executor, const std::shared_ptr<opendnp3::ILinkListener>& listener, uint32_t maxRxFragSize, const LinkConfig& config) :
-	transport(std::make_shared<TransportLayer>(logger, maxRxFragSize)),
+TransportStack::TransportStack(const openpal::Logger& logger, const std::shared_ptr<openpal::IExecutor>& executor, const std::shared_ptr<opendnp3::ILinkListener>& listener, uint32_t maxRxFragSize, const LinkConfig& config, const std::shared_ptr<BufferPool>& pool) :
+	transport(std::make_shared<TransportLayer>(logger, maxRxFragSize, pool)),
 	link(std::make_shared<LinkLayer>(logger, executor, transport, listener, config))
 {
 	transport->SetLinkLayer(*link);
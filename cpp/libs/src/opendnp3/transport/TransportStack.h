@@ -33,7 +33,7 @@ class TransportStack
 
 public:
 
-	TransportStack(const openpal::Logger& logger, const std::shared_ptr<openpal::IExecutor>& executor, const std::shared_ptr<opendnp3::ILinkListener>& listener, uint32_t maxRxFragSize, const LinkConfig& config);
+	TransportStack(const openpal::Logger& logger, const std::shared_ptr<openpal::IExecutor>& executor, const std::shared_ptr<opendnp3::ILinkListener>& listener, uint32_t maxRxFragSize, const LinkConfig& config, const std::shared_ptr<BufferPool>& pool = nullptr);
 
 	std::shared_ptr<TransportLayer> transport;
 	std::shared_ptr<LinkLayer> link;
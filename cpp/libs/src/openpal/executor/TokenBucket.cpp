@@ -0,0 +1,72 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "openpal/executor/TokenBucket.h"
+
+namespace openpal
+{
+
+TokenBucket::TokenBucket(uint32_t rate, uint32_t burst) :
+	rate(rate),
+	capacity(static_cast<uint64_t>(burst == 0 ? 1 : burst) * 1000),
+	tokens(capacity)
+{}
+
+bool TokenBucket::TryConsume(const MonotonicTimestamp& now)
+{
+	if (rate == 0)
+	{
+		return true;
+	}
+
+	this->Refill(now);
+
+	if (tokens < 1000)
+	{
+		return false;
+	}
+
+	tokens -= 1000;
+	return true;
+}
+
+void TokenBucket::Refill(const MonotonicTimestamp& now)
+{
+	if (!started)
+	{
+		started = true;
+		last = now;
+		return;
+	}
+
+	if (now.milliseconds <= last.milliseconds)
+	{
+		return;
+	}
+
+	const auto elapsed = static_cast<uint64_t>(now.milliseconds - last.milliseconds);
+	last = now;
+
+	// one token per second is 1 thousandth of a token per millisecond
+	const auto added = elapsed * rate;
+	tokens = (added >= (capacity - tokens)) ? capacity : tokens + added;
+}
+
+}
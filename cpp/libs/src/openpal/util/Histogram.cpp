@@ -0,0 +1,170 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "openpal/util/Histogram.h"
+
+#include <cstring>
+
+namespace openpal
+{
+
+namespace
+{
+/// position of the most significant bit of a non-zero value
+uint32_t Magnitude(uint64_t value)
+{
+	uint32_t magnitude = 0;
+	for (uint32_t shift = 32; shift > 0; shift >>= 1)
+	{
+		if (value >= (uint64_t(1) << shift))
+		{
+			value >>= shift;
+			magnitude += shift;
+		}
+	}
+	return magnitude;
+}
+}
+
+Histogram::Histogram()
+{
+	this->Reset();
+}
+
+void Histogram::Record(uint64_t value)
+{
+	++buckets[BucketIndex(value)];
+	++count;
+	sum += value;
+	if (value < min)
+	{
+		min = value;
+	}
+	if (value > max)
+	{
+		max = value;
+	}
+}
+
+void Histogram::Merge(const Histogram& other)
+{
+	for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+	{
+		buckets[i] += other.buckets[i];
+	}
+	count += other.count;
+	sum += other.sum;
+	if (other.count > 0)
+	{
+		if (other.min < min)
+		{
+			min = other.min;
+		}
+		if (other.max > max)
+		{
+			max = other.max;
+		}
+	}
+}
+
+void Histogram::Reset()
+{
+	std::memset(buckets, 0, sizeof(buckets));
+	count = 0;
+	sum = 0;
+	min = ~uint64_t(0);
+	max = 0;
+}
+
+uint64_t Histogram::ValueAtPercentile(double percentile) const
+{
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	// nearest rank
+	auto rank = static_cast<uint64_t>((percentile / 100.0) * count + 0.999999);
+	if (rank < 1)
+	{
+		rank = 1;
+	}
+
+	uint64_t seen = 0;
+	for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+	{
+		seen += buckets[i];
+		if (seen >= rank)
+		{
+			const auto bound = BucketUpperBound(i);
+			return (bound < max) ? bound : max;
+		}
+	}
+
+	return max;
+}
+
+HistogramSummary Histogram::Summarize() const
+{
+	HistogramSummary summary;
+	summary.count = count;
+	summary.min = this->Min();
+	summary.mean = this->Mean();
+	summary.p50 = this->ValueAtPercentile(50);
+	summary.p90 = this->ValueAtPercentile(90);
+	summary.p99 = this->ValueAtPercentile(99);
+	summary.p999 = this->ValueAtPercentile(99.9);
+	summary.max = max;
+	return summary;
+}
+
+uint32_t Histogram::BucketIndex(uint64_t value)
+{
+	if (value < 2 * SUB_BUCKETS)
+	{
+		return static_cast<uint32_t>(value);
+	}
+
+	const auto magnitude = Magnitude(value);
+	if (magnitude >= MAX_MAGNITUDE)
+	{
+		return NUM_BUCKETS - 1;
+	}
+
+	const auto shift = magnitude - SUB_BUCKET_BITS;
+	const auto sub = static_cast<uint32_t>(value >> shift) - SUB_BUCKETS;
+	return 2 * SUB_BUCKETS + (magnitude - SUB_BUCKET_BITS - 1) * SUB_BUCKETS + sub;
+}
+
+uint64_t Histogram::BucketUpperBound(uint32_t index)
+{
+	if (index < 2 * SUB_BUCKETS)
+	{
+		return index;
+	}
+
+	const auto offset = index - 2 * SUB_BUCKETS;
+	const auto shift = offset / SUB_BUCKETS + 1;
+	const auto sub = offset % SUB_BUCKETS;
+	const auto lower = static_cast<uint64_t>(SUB_BUCKETS + sub) << shift;
+	return lower + (uint64_t(1) << shift) - 1;
+}
+
+}
@@ -35,6 +35,7 @@
 
 #include <thread>
 #include <iostream>
+#include <atomic>
 
 using namespace opendnp3;
 using namespace asiodnp3;
@@ -132,7 +133,44 @@ TEST_CASE(SUITE("ManualChannelShutdown"))
 	}
 }
 
+namespace
+{
+class TimeRecordingApplication final : public IOutstationApplication
+{
+public:
 
+	virtual bool SupportsWriteAbsoluteTime() override
+	{
+		return true;
+	}
 
+	virtual bool WriteAbsoluteTime(const UTCTimestamp& timestamp) override
+	{
+		this->lastTime = timestamp.msSinceEpoch;
+		return true;
+	}
 
+	std::atomic<uint64_t> lastTime{ 0 };
+};
+}
 
+TEST_CASE(SUITE("BroadcastTimeSyncReachesOutstation"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+	Channels channels(manager);
+
+	auto application = std::make_shared<TimeRecordingApplication>();
+	auto outstation = channels.server->AddOutstation("outstation", SuccessCommandHandler::Create(), application, OutstationStackConfig(DatabaseSizes::Empty()));
+	auto master = channels.client->AddMaster("master", NullSOEHandler::Create(), asiodnp3::DefaultMasterApplication::Create(), MasterStackConfig());
+	outstation->Enable();
+	master->Enable();
+
+	// broadcasts fail until the client channel connects
+	for (int i = 0; (i < 500) && (application->lastTime == 0); ++i)
+	{
+		channels.client->BroadcastTimeSync(1, UTCTimestamp(1234), [](bool) {});
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	REQUIRE(application->lastTime == 1234);
+}
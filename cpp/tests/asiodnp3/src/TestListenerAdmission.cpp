@@ -0,0 +1,234 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "catch.hpp"
+
+#include "asiodnp3/DNP3Manager.h"
+#include "asiodnp3/IListenCallbacks.h"
+#include "asiodnp3/ListenConfig.h"
+
+#include "opendnp3/LogLevels.h"
+
+#include <asio.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+using namespace asiodnp3;
+using namespace asiopal;
+using namespace openpal;
+
+#define SUITE(name) "ListenerAdmissionTestSuite - " name
+
+namespace
+{
+// accepts every connection that reaches it and never sees a first frame
+class CountingListenCallbacks final : public IListenCallbacks
+{
+public:
+
+	virtual bool AcceptConnection(uint64_t sessionid, const std::string& ipaddress) override
+	{
+		++numAccepted;
+		return true;
+	}
+
+	virtual bool AcceptCertificate(uint64_t sessionid, const X509Info& info) override
+	{
+		return true;
+	}
+
+	virtual TimeDuration GetFirstFrameTimeout() override
+	{
+		return TimeDuration::Seconds(30);
+	}
+
+	virtual void OnFirstFrame(uint64_t sessionid, const LinkHeaderFields& header, ISessionAcceptor& acceptor) override {}
+
+	virtual void OnConnectionClose(uint64_t sessionid, const std::shared_ptr<IMasterSession>& session) override {}
+
+	virtual void OnCertificateError(uint64_t sessionid, const X509Info& info, int error) override {}
+
+	std::atomic<uint32_t> numAccepted = { 0 };
+};
+
+/**
+* Opens raw TCP connections that never send anything and counts how many the listener closes
+*/
+class Clients
+{
+public:
+
+	Clients(uint16_t port, uint32_t count)
+	{
+		const asio::ip::tcp::endpoint endpoint(asio::ip::address_v4::loopback(), port);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			auto socket = std::make_shared<asio::ip::tcp::socket>(io);
+			socket->connect(endpoint);
+			sockets.push_back(socket);
+
+			// only completes when the listener closes the connection
+			auto buffer = std::make_shared<std::array<uint8_t, 16>>();
+			socket->async_read_some(asio::buffer(*buffer), [this, buffer](const auto & ec, std::size_t num)
+			{
+				if (ec)
+				{
+					++this->numClosed;
+				}
+			});
+		}
+	}
+
+	~Clients()
+	{
+		for (auto& socket : sockets)
+		{
+			socket->close();
+		}
+		io.run();
+	}
+
+	/// process closed connections until the condition is met or 5 seconds elapse
+	template <class Condition>
+	bool WaitFor(const Condition& condition)
+	{
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (!condition())
+		{
+			if (std::chrono::steady_clock::now() > deadline)
+			{
+				return false;
+			}
+
+			io.poll();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return true;
+	}
+
+	/// process closed connections for a while longer so that late admissions or closes would be noticed
+	void Settle()
+	{
+		const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+		while (std::chrono::steady_clock::now() < end)
+		{
+			io.poll();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	uint32_t numClosed = 0;
+
+private:
+
+	asio::io_service io;
+	std::vector<std::shared_ptr<asio::ip::tcp::socket>> sockets;
+};
+}
+
+TEST_CASE(SUITE("ConnectionsOverThePendingFirstFrameLimitAreShed"))
+{
+	const uint32_t NUM_CONNECTIONS = 10;
+
+	DNP3Manager manager(1);
+	auto callbacks = std::make_shared<CountingListenCallbacks>();
+
+	ListenConfig config;
+	config.maxPendingFirstFrame = 3;
+
+	std::error_code ec;
+	auto listener = manager.CreateListener("listener", levels::NORMAL, IPEndpoint::Localhost(20010), config, callbacks, ec);
+	REQUIRE_FALSE(ec);
+
+	Clients clients(20010, NUM_CONNECTIONS);
+
+	REQUIRE(clients.WaitFor([&]()
+	{
+		return (callbacks->numAccepted + clients.numClosed) == NUM_CONNECTIONS;
+	}));
+	clients.Settle();
+
+	// none of the admitted sessions produces a first frame, so the rest are closed without reaching the callbacks
+	REQUIRE(callbacks->numAccepted == 3);
+	REQUIRE(clients.numClosed == (NUM_CONNECTIONS - 3));
+}
+
+TEST_CASE(SUITE("ConnectionsOverTheAdmissionRateAreShed"))
+{
+	const uint32_t NUM_CONNECTIONS = 10;
+
+	DNP3Manager manager(1);
+	auto callbacks = std::make_shared<CountingListenCallbacks>();
+
+	// the bucket starts with one second's worth of admissions and the storm takes far less than the 200ms to refill one
+	ListenConfig config;
+	config.maxAcceptRate = 5;
+
+	std::error_code ec;
+	auto listener = manager.CreateListener("listener", levels::NORMAL, IPEndpoint::Localhost(20011), config, callbacks, ec);
+	REQUIRE_FALSE(ec);
+
+	Clients clients(20011, NUM_CONNECTIONS);
+
+	REQUIRE(clients.WaitFor([&]()
+	{
+		return (callbacks->numAccepted + clients.numClosed) == NUM_CONNECTIONS;
+	}));
+	clients.Settle();
+
+	REQUIRE(callbacks->numAccepted == 5);
+	REQUIRE(clients.numClosed == (NUM_CONNECTIONS - 5));
+}
+
+TEST_CASE(SUITE("EveryAcceptorAppliesItsOwnPendingFirstFrameLimit"))
+{
+	const uint32_t NUM_CONNECTIONS = 10;
+
+	DNP3Manager manager(2);
+	auto callbacks = std::make_shared<CountingListenCallbacks>();
+
+	ListenConfig config;
+	config.numAcceptors = 2;
+	config.maxPendingFirstFrame = 1;
+
+	std::error_code ec;
+	auto listener = manager.CreateListener("listener", levels::NORMAL, IPEndpoint::Localhost(20012), config, callbacks, ec);
+	REQUIRE_FALSE(ec);
+
+	Clients clients(20012, NUM_CONNECTIONS);
+
+	REQUIRE(clients.WaitFor([&]()
+	{
+		return (callbacks->numAccepted + clients.numClosed) == NUM_CONNECTIONS;
+	}));
+	clients.Settle();
+
+	// the kernel decides how the connections are spread, each acceptor admits at most one of its share
+	REQUIRE(callbacks->numAccepted >= 1);
+	REQUIRE(callbacks->numAccepted <= 2);
+	REQUIRE(clients.numClosed == (NUM_CONNECTIONS - callbacks->numAccepted));
+}
@@ -0,0 +1,143 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#include <catch.hpp>
+
+#include <dnp3loadgen/LoadGenerator.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace openpal;
+using namespace opendnp3;
+using namespace dnp3loadgen;
+
+#define SUITE(name) "LoadGeneratorTestSuite - " name
+
+namespace
+{
+class RecordingSink
+{
+public:
+
+	void Update(const Binary& meas, uint16_t index)
+	{
+		binaries.push_back(index);
+	}
+	void Update(const Analog& meas, uint16_t index)
+	{
+		analogs.push_back(meas.value);
+	}
+	void Update(const Counter& meas, uint16_t index)
+	{
+		counters.push_back(meas.value);
+	}
+
+	std::vector<uint16_t> binaries;
+	std::vector<double> analogs;
+	std::vector<uint32_t> counters;
+};
+}
+
+TEST_CASE(SUITE("Change processes are deterministic for a seed and follow their rates"))
+{
+	LoadConfig config;
+	config.binaries.togglesPerSecond = 100;
+	config.counters.incrementsPerSecond = 50;
+	config.analogs.stepsPerSecond = 100;
+
+	ChangeProcess first(config, 7);
+	ChangeProcess second(config, 7);
+	RecordingSink firstSink;
+	RecordingSink secondSink;
+
+	for (int i = 0; i < 100; ++i)
+	{
+		first.Tick(0.1, 0, firstSink);
+		second.Tick(0.1, 0, secondSink);
+	}
+
+	REQUIRE(firstSink.binaries == secondSink.binaries);
+	REQUIRE(firstSink.analogs == secondSink.analogs);
+	REQUIRE(firstSink.counters == secondSink.counters);
+
+	// 10 simulated seconds
+	REQUIRE(first.Counts().numBinary > 800);
+	REQUIRE(first.Counts().numBinary < 1200);
+	REQUIRE(first.Counts().numCounter > 400);
+	REQUIRE(first.Counts().numCounter < 600);
+	REQUIRE(first.Counts().numBinary == firstSink.binaries.size());
+
+	// the deadband suppresses most random walk steps
+	REQUIRE(first.Counts().numAnalog > 0);
+	REQUIRE(first.Counts().numAnalog < 1000);
+}
+
+TEST_CASE(SUITE("Latency histogram percentiles"))
+{
+	LatencyHistogram histogram;
+	for (int64_t ms = 1; ms <= 100; ++ms)
+	{
+		histogram.Record(ms);
+	}
+
+	REQUIRE(histogram.Count() == 100);
+	REQUIRE(histogram.Percentile(0.5) == 50);
+	REQUIRE(histogram.Percentile(0.99) == 99);
+	REQUIRE(histogram.Percentile(1.0) == 100);
+
+	// out of range latencies are clamped
+	histogram.Record(-5);
+	histogram.Record(LatencyHistogram::MAX_MS + 1000);
+	REQUIRE(histogram.Percentile(0.0) == 0);
+	REQUIRE(histogram.Max() == LatencyHistogram::MAX_MS);
+}
+
+TEST_CASE(SUITE("Verifying masters receive every generated event"))
+{
+	LoadConfig config;
+	config.numOutstations = 5;
+	config.basePort = 20100;
+	config.verify = true;
+	config.pollPeriod = TimeDuration::Milliseconds(100);
+	config.tickPeriod = TimeDuration::Milliseconds(20);
+	config.binaries.togglesPerSecond = 50;
+
+	LoadGenerator generator(config, nullptr);
+	generator.Start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(500));
+	generator.Stop();
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	auto stats = generator.GetStatistics();
+	while (stats.delivery.delivered.Total() < stats.generated.Total() && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		stats = generator.GetStatistics();
+	}
+
+	REQUIRE(stats.generated.Total() > 0);
+	REQUIRE(stats.delivery.delivered.numBinary == stats.generated.numBinary);
+	REQUIRE(stats.delivery.delivered.numAnalog == stats.generated.numAnalog);
+	REQUIRE(stats.delivery.delivered.numCounter == stats.generated.numCounter);
+	REQUIRE(stats.delivery.numLatencySamples == stats.generated.Total());
+}
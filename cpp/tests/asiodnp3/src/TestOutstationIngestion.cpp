@@ -0,0 +1,77 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <asiodnp3/DNP3Manager.h>
+
+#include <opendnp3/LogLevels.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+#include <opendnp3/outstation/IOutstationApplication.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace opendnp3;
+using namespace asiodnp3;
+using namespace asiopal;
+using namespace openpal;
+
+#define SUITE(name) "OutstationIngestionTestSuite - " name
+
+TEST_CASE(SUITE("EnqueueDrainsAndRejectsWhenFull"))
+{
+	DNP3Manager manager(1);
+
+	auto channel = manager.AddTCPServer("server", levels::NOTHING, ChannelRetry::Default(), "127.0.0.1", 20000, nullptr);
+
+	OutstationStackConfig config(DatabaseSizes::AnalogOnly(10));
+	config.ingestion.capacity = 4;
+	// hold the drain back so the ring fills up before the outstation empties it
+	config.ingestion.coalesceDelay = TimeDuration::Milliseconds(200);
+
+	auto outstation = channel->AddOutstation("outstation", SuccessCommandHandler::Create(), DefaultOutstationApplication::Create(), config);
+
+	for (uint16_t i = 0; i < 4; ++i)
+	{
+		REQUIRE(outstation->Enqueue(Analog(i), i, EventMode::Force));
+	}
+
+	REQUIRE_FALSE(outstation->Enqueue(Analog(4), 4, EventMode::Force));
+
+	auto drained = [&]()
+	{
+		return outstation->GetStackStatistics().outstation.numIngestedUpdates == 4;
+	};
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (!drained() && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	auto stats = outstation->GetStackStatistics().outstation;
+	REQUIRE(stats.numIngestedUpdates == 4);
+	REQUIRE(stats.numIngestionDrains == 1);
+	REQUIRE(stats.numIngestionOverflows == 1);
+
+	// the ring has room again
+	REQUIRE(outstation->Enqueue(Analog(5), 5, EventMode::Force));
+}
@@ -35,7 +35,7 @@ using namespace asiodnp3;
 
 #define SUITE(name) "PerformanceTestSuite - " name
 
-TEST_CASE(SUITE("PointsPerSecond"))
+void MeasurePointsPerSecond(PerformanceStackPair::Transport transport)
 {
 	const uint16_t START_PORT = 20000;
 	const uint16_t NUM_STACK_PAIRS = 10;
@@ -60,7 +60,7 @@ TEST_CASE(SUITE("PointsPerSecond"))
 
 	for (uint16_t i = 0; i < NUM_STACK_PAIRS; ++i)
 	{
-		auto pair = std::make_unique<PerformanceStackPair>(LEVELS, STACK_TIMEOUT, manager, START_PORT + i, NUM_POINTS_PER_TYPE, EVENTS_PER_ITERATION);
+		auto pair = std::make_unique<PerformanceStackPair>(LEVELS, STACK_TIMEOUT, manager, START_PORT + i, NUM_POINTS_PER_TYPE, EVENTS_PER_ITERATION, transport);
 		pairs.push_back(std::move(pair));
 	}
 
@@ -96,3 +96,13 @@ TEST_CASE(SUITE("PointsPerSecond"))
 	std::cout << total_events_transferred << " in " << milliseconds.count() << " ms == " << rate << " events per/sec" << std::endl;
 }
 
+TEST_CASE(SUITE("PointsPerSecond"))
+{
+	MeasurePointsPerSecond(PerformanceStackPair::Transport::TCP);
+}
+
+TEST_CASE(SUITE("PointsPerSecondUDP"))
+{
+	MeasurePointsPerSecond(PerformanceStackPair::Transport::UDP);
+}
+
@@ -33,15 +33,15 @@ using namespace opendnp3;
 namespace asiodnp3
 {
 
-PerformanceStackPair::PerformanceStackPair(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager& manager, uint16_t port, uint16_t numPointsPerType, uint32_t eventsPerIteration) :
+PerformanceStackPair::PerformanceStackPair(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager& manager, uint16_t port, uint16_t numPointsPerType, uint32_t eventsPerIteration, Transport transport) :
 	PORT(port),
 	NUM_POINTS_PER_TYPE(numPointsPerType),
 	EVENTS_PER_ITERATION(eventsPerIteration),
 	soeHandler(std::make_shared<CountingSOEHandler>()),
 	clientListener(std::make_shared<QueuedChannelListener>()),
 	serverListener(std::make_shared<QueuedChannelListener>()),
-	master(CreateMaster(levels, timeout, manager, port, this->soeHandler, this->clientListener)),
-	outstation(CreateOutstation(levels, timeout, manager, port, numPointsPerType, 3 * eventsPerIteration, this->serverListener))
+	master(CreateMaster(transport, levels, timeout, manager, port, this->soeHandler, this->clientListener)),
+	outstation(CreateOutstation(transport, levels, timeout, manager, port, numPointsPerType, 3 * eventsPerIteration, this->serverListener))
 {
 	this->outstation->Enable();
 	this->master->Enable();
@@ -129,9 +129,18 @@ MasterStackConfig PerformanceStackPair::GetMasterStackConfig(openpal::TimeDurati
 	return config;
 }
 
-std::shared_ptr<IMaster> PerformanceStackPair::CreateMaster(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager& manager, uint16_t port, std::shared_ptr<ISOEHandler> soehandler, std::shared_ptr<IChannelListener> listener)
+std::shared_ptr<IMaster> PerformanceStackPair::CreateMaster(Transport transport, uint32_t levels, openpal::TimeDuration timeout, DNP3Manager& manager, uint16_t port, std::shared_ptr<ISOEHandler> soehandler, std::shared_ptr<IChannelListener> listener)
 {
-	auto channel = manager.AddTCPClient(
+	auto channel = (transport == Transport::UDP) ?
+	               manager.AddUDPChannel(
+	                   GetId("client", port).c_str(),
+	                   levels,
+	                   asiopal::ChannelRetry::Default(),
+	                   asiopal::IPEndpoint::Localhost(port + UDP_MASTER_PORT_OFFSET),
+	                   asiopal::IPEndpoint::Localhost(port),
+	                   listener
+	               ) :
+	               manager.AddTCPClient(
 	                   GetId("client", port).c_str(),
 	                   levels,
 	                   asiopal::ChannelRetry::Default(),
@@ -149,9 +158,18 @@ std::shared_ptr<IMaster> PerformanceStackPair::CreateMaster(uint32_t levels, ope
 	       );
 }
 
-std::shared_ptr<IOutstation> PerformanceStackPair::CreateOutstation(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager& manager, uint16_t port, uint16_t numPointsPerType, uint16_t eventBufferSize, std::shared_ptr<IChannelListener> listener)
+std::shared_ptr<IOutstation> PerformanceStackPair::CreateOutstation(Transport transport, uint32_t levels, openpal::TimeDuration timeout, DNP3Manager& manager, uint16_t port, uint16_t numPointsPerType, uint16_t eventBufferSize, std::shared_ptr<IChannelListener> listener)
 {
-	auto channel = manager.AddTCPServer(
+	auto channel = (transport == Transport::UDP) ?
+	               manager.AddUDPChannel(
+	                   GetId("server", port).c_str(),
+	                   levels,
+	                   asiopal::ChannelRetry::Default(),
+	                   asiopal::IPEndpoint::Localhost(port),
+	                   asiopal::IPEndpoint::Localhost(port + UDP_MASTER_PORT_OFFSET),
+	                   listener
+	               ) :
+	               manager.AddTCPServer(
 	                   GetId("server", port).c_str(),
 	                   levels,
 	                   asiopal::ChannelRetry::Default(),
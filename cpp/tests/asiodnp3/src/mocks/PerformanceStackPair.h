@@ -39,6 +39,16 @@ namespace asiodnp3
 
 class PerformanceStackPair final : openpal::Uncopyable
 {
+public:
+
+	enum class Transport
+	{
+		TCP,
+		UDP
+	};
+
+private:
+
 	const uint16_t PORT;
 	const uint16_t NUM_POINTS_PER_TYPE;
 	const uint32_t EVENTS_PER_ITERATION;
@@ -54,15 +64,18 @@ class PerformanceStackPair final : openpal::Uncopyable
 	static OutstationStackConfig GetOutstationStackConfig(uint16_t numPointsPerType, uint16_t eventBufferSize, openpal::TimeDuration timeout);
 	static MasterStackConfig GetMasterStackConfig(openpal::TimeDuration timeout);
 
-	static std::shared_ptr<IMaster> CreateMaster(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager&, uint16_t port, std::shared_ptr<opendnp3::ISOEHandler>, std::shared_ptr<IChannelListener> listener);
-	static std::shared_ptr<IOutstation> CreateOutstation(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager&, uint16_t port, uint16_t numPointsPerType, uint16_t eventBufferSize, std::shared_ptr<IChannelListener> listener);
+	static std::shared_ptr<IMaster> CreateMaster(Transport transport, uint32_t levels, openpal::TimeDuration timeout, DNP3Manager&, uint16_t port, std::shared_ptr<opendnp3::ISOEHandler>, std::shared_ptr<IChannelListener> listener);
+	static std::shared_ptr<IOutstation> CreateOutstation(Transport transport, uint32_t levels, openpal::TimeDuration timeout, DNP3Manager&, uint16_t port, uint16_t numPointsPerType, uint16_t eventBufferSize, std::shared_ptr<IChannelListener> listener);
+
+	// with UDP the outstation is bound to the port and the master to the port + UDP_MASTER_PORT_OFFSET
+	static const uint16_t UDP_MASTER_PORT_OFFSET = 1000;
 
 	static std::string GetId(const char* name, uint16_t port);
 	void AddValue(uint32_t i, UpdateBuilder& builder);
 
 public:
 
-	PerformanceStackPair(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager&, uint16_t port, uint16_t numPointsPerType, uint32_t eventsPerIteration);
+	PerformanceStackPair(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager&, uint16_t port, uint16_t numPointsPerType, uint32_t eventsPerIteration, Transport transport = Transport::TCP);
 
 	void WaitForChannelsOnline(std::chrono::steady_clock::duration timeout);
 
@@ -0,0 +1,106 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <asiopal/ThreadPool.h>
+#include <asiopal/Executor.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace std;
+using namespace std::chrono;
+using namespace openpal;
+using namespace asiopal;
+
+#define SUITE(name) "ExecutorMetricsTestSuite - " name
+
+TEST_CASE(SUITE("Thread pool reports statistics for every thread"))
+{
+	auto io = std::make_shared<IO>();
+	ThreadPool pool(Logger::Empty(), io, 3);
+
+	auto statistics = pool.GetThreadStatistics();
+	REQUIRE(statistics.size() == 3);
+	for (auto& thread : statistics)
+	{
+		REQUIRE(thread.BusyRatio() <= 1.0);
+	}
+}
+
+#ifdef OPENDNP3_EXECUTOR_METRICS
+
+TEST_CASE(SUITE("Executor counts and times posted handlers"))
+{
+	auto io = std::make_shared<IO>();
+	ThreadPool pool(Logger::Empty(), io, 2);
+	auto exe = pool.CreateExecutor("test");
+
+	for (int i = 0; i < 10; ++i)
+	{
+		exe->Post([]() {});
+	}
+	exe->BlockUntil([]() {});
+
+	auto statistics = exe->GetStatistics();
+
+	// the ten posts, BlockUntil and the GetStatistics post itself
+	REQUIRE(statistics.numHandlers >= 11);
+	REQUIRE(statistics.handlerDuration.count == statistics.numHandlers);
+	REQUIRE(statistics.queueDelay.count >= 11);
+	REQUIRE(statistics.numOverBudget == 0);
+}
+
+TEST_CASE(SUITE("Watchdog reports handlers over budget with the executor id"))
+{
+	auto io = std::make_shared<IO>();
+	ThreadPool pool(Logger::Empty(), io, 2);
+	auto exe = pool.CreateExecutor("slow-channel");
+
+	std::atomic<int> numStalls(0);
+	std::string executorId;
+
+	io->watchdog.Configure(milliseconds(5), [&](const HandlerStall & stall)
+	{
+		executorId = stall.executorId;
+		REQUIRE(stall.duration >= milliseconds(5));
+		++numStalls;
+	});
+
+	exe->BlockUntil([]()
+	{
+		std::this_thread::sleep_for(milliseconds(20));
+	});
+	exe->BlockUntil([]() {});
+
+	REQUIRE(numStalls == 1);
+	REQUIRE(executorId == "slow-channel");
+	REQUIRE(exe->GetStatistics().numOverBudget == 1);
+
+	uint64_t busy = 0;
+	for (auto& thread : pool.GetThreadStatistics())
+	{
+		busy += thread.busyMicros;
+	}
+	REQUIRE(busy >= 20000);
+}
+
+#endif
@@ -0,0 +1,134 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <asiopal/MPSCRing.h>
+
+#include <thread>
+#include <vector>
+
+using namespace asiopal;
+
+#define SUITE(name) "MPSCRingTestSuite - " name
+
+TEST_CASE(SUITE("CapacityIsRoundedUpToPowerOfTwo"))
+{
+	MPSCRing<int> ring(5);
+	REQUIRE(ring.Capacity() == 8);
+}
+
+TEST_CASE(SUITE("CapacityIsLimited"))
+{
+	REQUIRE(MPSCRing<int>::GetCapacity(MPSCRing<int>::MAX_CAPACITY - 1) == MPSCRing<int>::MAX_CAPACITY);
+	REQUIRE(MPSCRing<int>::GetCapacity(MPSCRing<int>::MAX_CAPACITY + 1) == MPSCRing<int>::MAX_CAPACITY);
+	REQUIRE(MPSCRing<int>::GetCapacity(UINT32_MAX) == MPSCRing<int>::MAX_CAPACITY);
+}
+
+TEST_CASE(SUITE("PushesUntilFullAndPopsInOrder"))
+{
+	MPSCRing<int> ring(4);
+
+	for (int i = 0; i < 4; ++i)
+	{
+		REQUIRE(ring.TryPush(i));
+	}
+
+	REQUIRE_FALSE(ring.TryPush(4));
+
+	int value = -1;
+	REQUIRE(ring.TryPop(value));
+	REQUIRE(value == 0);
+
+	// popping frees a cell that can be reused after wrapping around
+	REQUIRE(ring.TryPush(4));
+
+	std::vector<int> values;
+	REQUIRE(ring.Drain([&](int v)
+	{
+		values.push_back(v);
+	}) == 4);
+	REQUIRE((values == std::vector<int> { 1, 2, 3, 4 }));
+	REQUIRE_FALSE(ring.TryPop(value));
+}
+
+TEST_CASE(SUITE("DrainIsBounded"))
+{
+	MPSCRing<int> ring(8);
+	for (int i = 0; i < 8; ++i)
+	{
+		REQUIRE(ring.TryPush(i));
+	}
+
+	REQUIRE(ring.Drain([](int) {}, 3) == 3);
+	REQUIRE(ring.Drain([](int) {}) == 5);
+}
+
+TEST_CASE(SUITE("ConcurrentProducersPreserveOrderPerProducer"))
+{
+	const int NUM_PRODUCERS = 4;
+	const int NUM_VALUES = 100000;
+
+	struct Record
+	{
+		int producer;
+		int value;
+	};
+
+	MPSCRing<Record> ring(256);
+
+	std::vector<std::thread> producers;
+	for (int p = 0; p < NUM_PRODUCERS; ++p)
+	{
+		producers.push_back(std::thread([&ring, p]()
+		{
+			for (int i = 0; i < NUM_VALUES; ++i)
+			{
+				while (!ring.TryPush(Record { p, i }))
+				{
+					std::this_thread::yield();
+				}
+			}
+		}));
+	}
+
+	std::vector<int> next(NUM_PRODUCERS, 0);
+	int total = 0;
+	bool inOrder = true;
+
+	while (total < NUM_PRODUCERS * NUM_VALUES)
+	{
+		Record record;
+		if (ring.TryPop(record))
+		{
+			inOrder &= (record.value == next[record.producer]);
+			++next[record.producer];
+			++total;
+		}
+	}
+
+	for (auto& producer : producers)
+	{
+		producer.join();
+	}
+
+	REQUIRE(inOrder);
+	REQUIRE_FALSE(ring.Drain([](const Record&) {}) > 0);
+}
@@ -22,8 +22,12 @@
 
 #include "mocks/MockTLSPair.h"
 
+#include "asiopal/tls/SSLSessionCache.h"
+
 #include <iostream>
 #include <fstream>
+#include <chrono>
+#include <cstdio>
 
 using namespace asiopal;
 
@@ -88,12 +92,183 @@ TEST_CASE(SUITE("client and server can connect"))
 	}
 }
 
+TEST_CASE(SUITE("reconnect storm handshakes per second"))
+{
+	const auto key1 = get_path("entity1_key.pem");
+	const auto key2 = get_path("entity2_key.pem");
+	const auto cert1 = get_path("entity1_cert.pem");
+	const auto cert2 = get_path("entity2_cert.pem");
+
+	if (!(exists(key1) && exists(key2) && exists(cert1) && exists(cert2)))
+	{
+		std::cout << "Could not locate one or more of the test TLS certificates. Expected to be run from the project root directory." << std::endl;
+		std::cout << "This test will be skipped." << std::endl;
+		return;
+	}
+
+	const size_t NUM_HANDSHAKES = 200;
 
+	// returns the number of resumed sessions
+	auto storm = [ = ](const char* name, uint32_t sessionLifetimeSeconds, bool useKernelTLS) -> size_t
+	{
+		SSLSessionCache::Instance().Clear();
 
+		size_t resumed = 0;
 
+		auto test = [&](const std::shared_ptr<MockIO>& io)
+		{
+			TLSConfig cfg1(cert2, cert1, key1, 0, false, false, true, "", sessionLifetimeSeconds, useKernelTLS);
+			TLSConfig cfg2(cert1, cert2, key2, 0, false, false, true, "", sessionLifetimeSeconds, useKernelTLS);
 
+			MockTLSPair pair(io, 20001, cfg1, cfg2);
 
+			const auto start = std::chrono::steady_clock::now();
 
+			for (size_t i = 1; i <= NUM_HANDSHAKES; ++i)
+			{
+				pair.ConnectAndRead(i, std::chrono::seconds(5));
+			}
 
+			const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			std::cout << name << ": " << NUM_HANDSHAKES << " handshakes in " << elapsed.count() / 1000 << " ms == "
+			          << (NUM_HANDSHAKES * 1000000) / std::max<int64_t>(elapsed.count(), 1) << " handshakes per/sec" << std::endl;
+
+			resumed = pair.NumResumedSessions();
+		};
+
+		WithIO(test);
 
+		return resumed;
+	};
+
+	REQUIRE(storm("full handshakes", 0, false) == 0);
+
+	// every connection after the first resumes the session
+	REQUIRE(storm("resumed sessions", 300, false) == (NUM_HANDSHAKES - 1));
+	REQUIRE(storm("resumed sessions w/ kernel TLS", 300, true) == (NUM_HANDSHAKES - 1));
+
+	SSLSessionCache::Instance().Clear();
+}
+
+TEST_CASE(SUITE("sessions are not resumed under a different trust configuration"))
+{
+	const auto key1 = get_path("entity1_key.pem");
+	const auto key2 = get_path("entity2_key.pem");
+	const auto cert1 = get_path("entity1_cert.pem");
+	const auto cert2 = get_path("entity2_cert.pem");
+
+	if (!(exists(key1) && exists(key2) && exists(cert1) && exists(cert2)))
+	{
+		std::cout << "Could not locate one or more of the test TLS certificates. Expected to be run from the project root directory." << std::endl;
+		std::cout << "This test will be skipped." << std::endl;
+		return;
+	}
+
+	// a CA file that trusts both entities, still verifies the peer but is a different trust configuration
+	const std::string bundle = "tls-test-ca-bundle.pem";
+	{
+		std::ofstream out(bundle);
+		out << std::ifstream(cert1).rdbuf() << std::ifstream(cert2).rdbuf();
+	}
 
+	// returns the number of resumed sessions
+	auto connect = [](const TLSConfig & client, const TLSConfig & server) -> size_t
+	{
+		size_t resumed = 0;
+
+		WithIO([&](const std::shared_ptr<MockIO>& io)
+		{
+			MockTLSPair pair(io, 20001, client, server);
+			pair.ConnectAndRead(1, std::chrono::seconds(5));
+			resumed = pair.NumResumedSessions();
+		});
+
+		return resumed;
+	};
+
+	SSLSessionCache::Instance().Clear();
+
+	const TLSConfig client(cert2, cert1, key1, 0, false, false, true, "", 300);
+	const TLSConfig server(cert1, cert2, key2, 0, false, false, true, "", 300);
+	const TLSConfig clientOtherCA(bundle, cert1, key1, 0, false, false, true, "", 300);
+	const TLSConfig serverOtherCA(bundle, cert2, key2, 0, false, false, true, "", 300);
+
+	REQUIRE(connect(client, server) == 0);
+	REQUIRE(connect(client, server) == 1);
+
+	// the client has no session for its own trust configuration
+	REQUIRE(connect(clientOtherCA, server) == 0);
+
+	// the client offers its session, but the server cannot accept it under a different trust configuration
+	REQUIRE(connect(client, serverOtherCA) == 0);
+
+	SSLSessionCache::Instance().Clear();
+	std::remove(bundle.c_str());
+}
+
+TEST_CASE(SUITE("sessions are not resumed after a certificate file is replaced in place"))
+{
+	const auto key1 = get_path("entity1_key.pem");
+	const auto key2 = get_path("entity2_key.pem");
+	const auto cert1 = get_path("entity1_cert.pem");
+	const auto cert2 = get_path("entity2_cert.pem");
+
+	if (!(exists(key1) && exists(key2) && exists(cert1) && exists(cert2)))
+	{
+		std::cout << "Could not locate one or more of the test TLS certificates. Expected to be run from the project root directory." << std::endl;
+		std::cout << "This test will be skipped." << std::endl;
+		return;
+	}
+
+	// CA files that start out trusting only the peer and are later rewritten under the same name
+	const std::string clientCA = "tls-test-client-ca.pem";
+	const std::string serverCA = "tls-test-server-ca.pem";
+	auto write = [](const std::string & path, const std::string & first, const std::string & second)
+	{
+		std::ofstream out(path);
+		out << std::ifstream(first).rdbuf();
+		if (!second.empty())
+		{
+			out << std::ifstream(second).rdbuf();
+		}
+	};
+
+	// returns the number of resumed sessions
+	auto connect = [](const TLSConfig & client, const TLSConfig & server) -> size_t
+	{
+		size_t resumed = 0;
+
+		WithIO([&](const std::shared_ptr<MockIO>& io)
+		{
+			MockTLSPair pair(io, 20001, client, server);
+			pair.ConnectAndRead(1, std::chrono::seconds(5));
+			resumed = pair.NumResumedSessions();
+		});
+
+		return resumed;
+	};
+
+	SSLSessionCache::Instance().Clear();
+	write(clientCA, cert2, "");
+	write(serverCA, cert1, "");
+
+	const TLSConfig client(clientCA, cert1, key1, 0, false, false, true, "", 300);
+	const TLSConfig server(serverCA, cert2, key2, 0, false, false, true, "", 300);
+
+	REQUIRE(connect(client, server) == 0);
+	REQUIRE(connect(client, server) == 1);
+
+	// the client has no session for the rotated CA file
+	write(clientCA, cert2, cert1);
+	REQUIRE(connect(client, server) == 0);
+	REQUIRE(connect(client, server) == 1);
+
+	// the client offers its session, but the server's CA file has been rotated since it was negotiated
+	write(serverCA, cert1, cert2);
+	REQUIRE(connect(client, server) == 0);
+
+	SSLSessionCache::Instance().Clear();
+	std::remove(clientCA.c_str());
+	std::remove(serverCA.c_str());
+}
@@ -34,6 +34,31 @@ namespace asiopal
 
 class MockTLSClientHandler final
 {
+	// keeps a read outstanding on a channel and discards the data
+	class Reader final : public IChannelCallbacks
+	{
+
+	public:
+
+		explicit Reader(IAsyncChannel& channel) : channel(channel) {}
+
+		void Start()
+		{
+			channel.BeginRead(openpal::WSlice(buffer, sizeof(buffer)));
+		}
+
+		virtual void OnReadComplete(const std::error_code& ec, size_t num) override
+		{
+			if (!ec) this->Start();
+		}
+
+		virtual void OnWriteComplete(const std::error_code& ec, size_t num) override {}
+
+	private:
+
+		IAsyncChannel& channel;
+		uint8_t buffer[256];
+	};
 
 public:
 
@@ -46,7 +71,21 @@ public:
 		}
 		else
 		{
-			channels.push_back(TLSStreamChannel::Create(executor, stream));
+			if (SSL_session_reused(stream->native_handle()))
+			{
+				++num_resumed;
+			}
+
+			auto channel = TLSStreamChannel::Create(executor, stream);
+
+			if (keep_reading)
+			{
+				auto reader = std::make_shared<Reader>(*channel);
+				channel->SetCallbacks(reader);
+				reader->Start();
+			}
+
+			channels.push_back(channel);
 		}
 	}
 
@@ -60,6 +99,11 @@ public:
 
 	size_t num_error = 0;
 
+	size_t num_resumed = 0;
+
+	// read from new channels so that post-handshake messages (i.e. TLS 1.3 session tickets) are processed
+	bool keep_reading = false;
+
 	std::deque<std::shared_ptr<IAsyncChannel>> channels;
 
 };
@@ -67,6 +67,36 @@ void MockTLSPair::Connect(size_t num)
 	io->CompleteInXIterations(10, connected);
 }
 
+void MockTLSPair::ConnectAndRead(size_t num, std::chrono::steady_clock::duration timeout)
+{
+	this->chandler->keep_reading = true;
+
+	auto callback = [handler = this->chandler](
+	                    const std::shared_ptr<Executor>& executor,
+	                    const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
+	                    const std::error_code & ec)
+	{
+		handler->OnConnect(executor, stream, ec);
+	};
+
+	if (!this->client->BeginConnect(callback))
+	{
+		throw std::logic_error("BeginConnect returned false");
+	}
+
+	auto connected = [this, num]() -> bool
+	{
+		return this->NumConnectionsEqual(num);
+	};
+
+	io->RunUntilTimeout(connected, timeout);
+}
+
+size_t MockTLSPair::NumResumedSessions() const
+{
+	return this->chandler->num_resumed;
+}
+
 bool MockTLSPair::NumConnectionsEqual(size_t num) const
 {
 	return (this->server->channels.size() == num) && (this->chandler->channels.size() == num);
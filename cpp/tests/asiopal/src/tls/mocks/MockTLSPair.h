@@ -44,6 +44,11 @@ public:
 
 	void Connect(size_t num = 1);
 
+	/// connect without requiring an exact number of iterations, reading from each client channel
+	void ConnectAndRead(size_t num, std::chrono::steady_clock::duration timeout);
+
+	size_t NumResumedSessions() const;
+
 	bool NumConnectionsEqual(size_t num) const;
 
 	testlib::MockLogHandler log;
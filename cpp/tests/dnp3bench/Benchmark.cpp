@@ -0,0 +1,121 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+
+namespace dnp3bench
+{
+
+namespace
+{
+volatile uint64_t sink = 0;
+}
+
+void Consume(uint64_t value)
+{
+	sink = sink + value;
+}
+
+double Result::Mean() const
+{
+	return samples.empty() ? 0 : std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+}
+
+double Result::Min() const
+{
+	return samples.empty() ? 0 : *std::min_element(samples.begin(), samples.end());
+}
+
+double Result::Percentile(double p) const
+{
+	if (samples.empty())
+	{
+		return 0;
+	}
+
+	auto sorted = samples;
+	std::sort(sorted.begin(), sorted.end());
+
+	const auto rank = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+	return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+bool Runner::IsSelected(const std::string& name) const
+{
+	return options.filter.empty() || (name.find(options.filter) != std::string::npos);
+}
+
+void Runner::Measure(const std::string& name, uint64_t operations, const std::function<void ()>& body, const std::function<void ()>& setup)
+{
+	this->Record(name, "ns/op", [&]() -> double
+	{
+		if (setup)
+		{
+			setup();
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		body();
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+
+		const auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+		return static_cast<double>(nanos) / (operations > 0 ? operations : 1);
+	});
+}
+
+void Runner::Record(const std::string& name, const std::string& unit, const std::function<double ()>& repetition)
+{
+	if (!this->IsSelected(name))
+	{
+		return;
+	}
+
+	for (uint32_t i = 0; i < options.warmup; ++i)
+	{
+		repetition();
+	}
+
+	Result result { name, unit, {} };
+	for (uint32_t i = 0; i < options.repetitions; ++i)
+	{
+		result.samples.push_back(repetition());
+	}
+
+	this->Print(result);
+	results.push_back(result);
+}
+
+void Runner::Print(const Result& result) const
+{
+	std::cout << std::left << std::setw(40) << result.name << std::right << std::fixed << std::setprecision(2)
+	          << " p50 " << std::setw(12) << result.Percentile(0.5)
+	          << " p90 " << std::setw(12) << result.Percentile(0.9)
+	          << " p99 " << std::setw(12) << result.Percentile(0.99)
+	          << " min " << std::setw(12) << result.Min()
+	          << " " << result.unit << std::endl;
+}
+
+}
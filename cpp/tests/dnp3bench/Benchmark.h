@@ -0,0 +1,98 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef DNP3BENCH_BENCHMARK_H
+#define DNP3BENCH_BENCHMARK_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace dnp3bench
+{
+
+/**
+* The measurements of one benchmark, one sample per repetition
+*/
+struct Result
+{
+	std::string name;
+	std::string unit;
+	std::vector<double> samples;
+
+	double Mean() const;
+	double Min() const;
+
+	/// nearest-rank percentile, p in [0, 1]
+	double Percentile(double p) const;
+};
+
+struct Options
+{
+	/// repetitions run and discarded before measuring
+	uint32_t warmup = 2;
+
+	/// repetitions that are measured
+	uint32_t repetitions = 10;
+
+	/// only benchmarks whose name contains this string are run
+	std::string filter;
+};
+
+/**
+* Runs benchmarks with warmup and repetitions, keeping setup out of the measurement
+*/
+class Runner
+{
+public:
+
+	explicit Runner(const Options& options) : options(options)
+	{}
+
+	/// Measure 'body', which performs 'operations' operations per call, in nanoseconds per operation.
+	/// 'setup' runs before every repetition and is not measured.
+	void Measure(const std::string& name, uint64_t operations, const std::function<void ()>& body, const std::function<void ()>& setup = nullptr);
+
+	/// Record a benchmark that measures itself, e.g. CPU time per operation reported by a simulation.
+	/// Every call of 'repetition' produces one sample.
+	void Record(const std::string& name, const std::string& unit, const std::function<double ()>& repetition);
+
+	bool IsSelected(const std::string& name) const;
+
+	const std::vector<Result>& Results() const
+	{
+		return results;
+	}
+
+private:
+
+	void Print(const Result& result) const;
+
+	Options options;
+	std::vector<Result> results;
+};
+
+/// keeps the compiler from discarding a computed value
+void Consume(uint64_t value);
+
+}
+
+#endif
@@ -0,0 +1,53 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef DNP3BENCH_BENCHMARKS_H
+#define DNP3BENCH_BENCHMARKS_H
+
+#include "Benchmark.h"
+
+namespace dnp3bench
+{
+
+/// parameters of the macro scenarios
+struct MacroOptions
+{
+	/// number of simulated master / outstation pairs
+	uint32_t numPairs = 100;
+
+	/// points of each type in every outstation database, i.e. the size of an integrity poll
+	uint16_t numPoints = 100;
+
+	/// analog changes per second on every outstation
+	double eventsPerSecond = 10;
+
+	/// virtual seconds each repetition simulates
+	uint32_t seconds = 10;
+};
+
+/// benchmarks of individual layers and components, in ns per operation
+void RunMicroBenchmarks(Runner& runner);
+
+/// whole stacks running in virtual time, in CPU us per operation
+void RunMacroBenchmarks(Runner& runner, const MacroOptions& options);
+
+}
+
+#endif
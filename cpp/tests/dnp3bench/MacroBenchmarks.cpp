@@ -0,0 +1,80 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Benchmarks.h"
+
+#include <dnp3sim/Simulation.h>
+
+#include <algorithm>
+
+using namespace openpal;
+using namespace opendnp3;
+using namespace dnp3sim;
+
+namespace dnp3bench
+{
+
+namespace
+{
+
+/// runs one workload on a freshly started simulation and reports the CPU time per operation
+double RunScenario(const MacroOptions& options, const std::function<WorkloadResult (Simulation&, const TimeDuration&)>& workload)
+{
+	SimulationConfig config;
+	config.numPairs = options.numPairs;
+	config.database = DatabaseSizes::AllTypes(options.numPoints);
+	config.outstation.eventBufferConfig = EventBufferConfig::AllTypes(static_cast<uint16_t>(std::min(65535.0, std::max(100.0, 4 * options.eventsPerSecond))));
+
+	Simulation sim(config);
+	sim.Start();
+
+	return workload(sim, TimeDuration::Seconds(options.seconds)).CpuMicrosPerOperation();
+}
+
+}
+
+void RunMacroBenchmarks(Runner& runner, const MacroOptions& options)
+{
+	runner.Record("macro/integrity-poll", "us/poll", [&]()
+	{
+		return RunScenario(options, [](Simulation & sim, const TimeDuration & duration)
+		{
+			return sim.RunPolls(TimeDuration::Seconds(1), duration);
+		});
+	});
+
+	runner.Record("macro/events", "us/event", [&]()
+	{
+		return RunScenario(options, [&](Simulation & sim, const TimeDuration & duration)
+		{
+			return sim.RunEvents(options.eventsPerSecond, TimeDuration::Seconds(1), duration);
+		});
+	});
+
+	runner.Record("macro/commands", "us/command", [&]()
+	{
+		return RunScenario(options, [](Simulation & sim, const TimeDuration & duration)
+		{
+			return sim.RunCommands(TimeDuration::Seconds(1), duration);
+		});
+	});
+}
+
+}
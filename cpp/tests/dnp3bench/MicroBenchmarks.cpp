@@ -0,0 +1,464 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Benchmarks.h"
+
+#include <opendnp3/app/APDUResponse.h>
+#include <opendnp3/app/BitPacking.h>
+#include <opendnp3/app/BitfieldRangeWriteIterator.h>
+#include <opendnp3/app/FixedSizeCodec.h>
+#include <opendnp3/app/RangeWriteIterator.h>
+#include <opendnp3/app/parsing/BitReader.h>
+#include <opendnp3/link/CRC.h>
+#include <opendnp3/link/IFrameSink.h>
+#include <opendnp3/link/LinkFrame.h>
+#include <opendnp3/link/LinkLayerConstants.h>
+#include <opendnp3/link/LinkLayerParser.h>
+#include <opendnp3/master/MasterScheduler.h>
+#include <opendnp3/master/MeasurementHandler.h>
+#include <opendnp3/master/UserPollTask.h>
+#include <opendnp3/outstation/DatabaseBuffers.h>
+#include <opendnp3/outstation/EventBuffer.h>
+#include <opendnp3/transport/TransportConstants.h>
+#include <opendnp3/transport/TransportRx.h>
+
+#include <dnp3mocks/MockMasterApplication.h>
+#include <dnp3mocks/NullSOEHandler.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace openpal;
+using namespace opendnp3;
+
+namespace dnp3bench
+{
+
+namespace
+{
+
+const uint32_t FRAGMENT_SIZE = 2048;
+
+class CountingFrameSink final : public IFrameSink
+{
+public:
+
+	virtual bool OnFrame(const LinkHeaderFields& header, const RSlice& userdata) override
+	{
+		++numFrames;
+		numBytes += userdata.Size();
+		return true;
+	}
+
+	uint64_t numFrames = 0;
+	uint64_t numBytes = 0;
+};
+
+class AlwaysRunFilter final : public ITaskFilter
+{
+public:
+
+	virtual bool CanRun(const IMasterTask& task) override
+	{
+		return true;
+	}
+
+	virtual void SetTaskStartTimeout(const MonotonicTimestamp& time) override {}
+};
+
+/// a class 0 response for a database of 'numPoints' of every type, without the response header
+std::vector<uint8_t> IntegrityObjects(uint16_t numPoints)
+{
+	DatabaseBuffers db(DatabaseSizes::AllTypes(numPoints), StaticTypeBitField::AllTypes(), IndexMode::Contiguous);
+	db.SelectAll(GroupVariation::Group60Var1);
+
+	std::vector<uint8_t> buffer(FRAGMENT_SIZE);
+	APDUResponse response(WSlice(buffer.data(), static_cast<uint32_t>(buffer.size())));
+	auto writer = response.GetWriter();
+	db.Load(writer);
+
+	const auto objects = response.ToRSlice().Skip(APDU_RESPONSE_HEADER_SIZE);
+	const uint8_t* start = objects;
+	return std::vector<uint8_t>(start, start + objects.Size());
+}
+
+void CRCBenchmarks(Runner& runner)
+{
+	std::vector<uint8_t> block(16);
+	for (size_t i = 0; i < block.size(); ++i)
+	{
+		block[i] = static_cast<uint8_t>(i * 31);
+	}
+
+	const uint32_t ITERATIONS = 100000;
+	runner.Measure("crc/16-byte-block", ITERATIONS, [&]()
+	{
+		uint64_t sum = 0;
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			block[0] = static_cast<uint8_t>(i);
+			sum += CRC::CalcCrc(block.data(), static_cast<uint32_t>(block.size()));
+		}
+		Consume(sum);
+	});
+}
+
+void LinkParserBenchmarks(Runner& runner)
+{
+	// a stream of maximum size unconfirmed user data frames
+	const uint32_t NUM_FRAMES = 1000;
+	std::vector<uint8_t> userdata(LPDU_MAX_USER_DATA_SIZE, 0xAA);
+	std::vector<uint8_t> stream(NUM_FRAMES * LPDU_MAX_FRAME_SIZE);
+	uint32_t streamSize = 0;
+	for (uint32_t i = 0; i < NUM_FRAMES; ++i)
+	{
+		WSlice dest(stream.data() + streamSize, LPDU_MAX_FRAME_SIZE);
+		auto frame = LinkFrame::FormatUnconfirmedUserData(dest, true, 1, 1024, userdata.data(), LPDU_MAX_USER_DATA_SIZE, nullptr);
+		streamSize += frame.Size();
+	}
+
+	auto parse = [&](uint32_t chunkSize)
+	{
+		LinkLayerParser parser(Logger::Empty());
+		CountingFrameSink sink;
+		uint32_t pos = 0;
+		while (pos < streamSize)
+		{
+			auto buffer = parser.WriteBuff();
+			const auto count = std::min(std::min(chunkSize, streamSize - pos), buffer.Size());
+			std::memcpy(buffer, stream.data() + pos, count);
+			parser.OnRead(count, sink);
+			pos += count;
+		}
+		Consume(sink.numFrames);
+	};
+
+	runner.Measure("link-parser/frame-4096-byte-reads", NUM_FRAMES, [&]()
+	{
+		parse(4096);
+	});
+
+	runner.Measure("link-parser/frame-16-byte-reads", NUM_FRAMES, [&]()
+	{
+		parse(16);
+	});
+}
+
+void TransportRxBenchmarks(Runner& runner)
+{
+	// the segments of one maximum size fragment
+	std::vector<std::vector<uint8_t>> segments;
+	for (uint32_t offset = 0; offset < FRAGMENT_SIZE; offset += MAX_TPDU_PAYLOAD)
+	{
+		const auto payload = std::min<uint32_t>(MAX_TPDU_PAYLOAD, FRAGMENT_SIZE - offset);
+		const auto seq = static_cast<uint8_t>(segments.size() & TL_HDR_SEQ);
+		const bool fir = (offset == 0);
+		const bool fin = (offset + payload) == FRAGMENT_SIZE;
+
+		std::vector<uint8_t> segment(payload + 1, 0x55);
+		segment[0] = static_cast<uint8_t>((fir ? TL_HDR_FIR : 0) | (fin ? TL_HDR_FIN : 0) | seq);
+		segments.push_back(segment);
+	}
+
+	const uint32_t NUM_FRAGMENTS = 1000;
+	TransportRx rx(Logger::Empty(), FRAGMENT_SIZE, nullptr);
+	runner.Measure("transport-rx/2048-byte-fragment", NUM_FRAGMENTS, [&]()
+	{
+		uint64_t total = 0;
+		for (uint32_t i = 0; i < NUM_FRAGMENTS; ++i)
+		{
+			for (auto& segment : segments)
+			{
+				total += rx.ProcessReceive(RSlice(segment.data(), static_cast<uint32_t>(segment.size()))).Size();
+			}
+		}
+		Consume(total);
+	});
+}
+
+template <class T>
+T MakeMeasurement(uint32_t i)
+{
+	typedef decltype(T().value) ValueType;
+	return T(static_cast<ValueType>(i * 37), Flags(0x01), DNPTime(1514764800000ULL + i));
+}
+
+/// writes a range of static values through the serializer function pointer and through FixedSizeCodec
+template <class GV>
+void CodecBenchmark(Runner& runner, const std::string& name)
+{
+	typedef typename GV::Target Target;
+
+	const uint32_t NUM_VALUES = 256;
+	const uint32_t ITERATIONS = 100;
+	std::vector<Target> values;
+	for (uint32_t i = 0; i < NUM_VALUES; ++i)
+	{
+		values.push_back(MakeMeasurement<Target>(i));
+	}
+	std::vector<uint8_t> buffer(NUM_VALUES * GV::Size() + 4);
+
+	runner.Measure("codec/" + name + "-serializer", NUM_VALUES * ITERATIONS, [&]()
+	{
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			WSlice dest(buffer.data(), static_cast<uint32_t>(buffer.size()));
+			RangeWriteIterator<UInt16, Target> iter(0, GV::Inst(), dest);
+			for (auto& value : values)
+			{
+				iter.Write(value);
+			}
+		}
+		Consume(buffer[4]);
+	});
+
+	runner.Measure("codec/" + name + "-fixed-size", NUM_VALUES * ITERATIONS, [&]()
+	{
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			WSlice dest(buffer.data(), static_cast<uint32_t>(buffer.size()));
+			RangeWriteIterator<UInt16, Target, FixedSizeCodec<GV>> iter(0, FixedSizeCodec<GV>(), dest);
+			iter.Write(NUM_VALUES, [&values](uint32_t j) -> const Target&
+			{
+				return values[j];
+			});
+		}
+		Consume(buffer[4]);
+	});
+}
+
+void CodecBenchmarks(Runner& runner)
+{
+	CodecBenchmark<Group1Var2>(runner, "g1v2");
+	CodecBenchmark<Group20Var1>(runner, "g20v1");
+	CodecBenchmark<Group22Var5>(runner, "g22v5");
+	CodecBenchmark<Group30Var1>(runner, "g30v1");
+	CodecBenchmark<Group30Var5>(runner, "g30v5");
+	CodecBenchmark<Group32Var3>(runner, "g32v3");
+	CodecBenchmark<Group40Var1>(runner, "g40v1");
+}
+
+void BitfieldBenchmarks(Runner& runner)
+{
+	const uint32_t NUM_VALUES = 65535;
+	std::vector<uint8_t> values(NUM_VALUES);
+	for (uint32_t i = 0; i < NUM_VALUES; ++i)
+	{
+		values[i] = static_cast<uint8_t>(((i * 2654435761u) >> 16) & 0x01);
+	}
+	std::vector<uint8_t> buffer(NumBytesInBits(NUM_VALUES) + 4);
+
+	runner.Measure("bitfield/pack-per-bit", NUM_VALUES, [&]()
+	{
+		WSlice dest(buffer.data(), static_cast<uint32_t>(buffer.size()));
+		BitfieldRangeWriteIterator<UInt16> iter(0, dest);
+		for (auto value : values)
+		{
+			iter.Write(value != 0);
+		}
+		Consume(buffer[4]);
+	});
+
+	runner.Measure("bitfield/pack-block", NUM_VALUES, [&]()
+	{
+		WSlice dest(buffer.data(), static_cast<uint32_t>(buffer.size()));
+		BitfieldRangeWriteIterator<UInt16> iter(0, dest);
+		Consume(iter.Write(values.data(), NUM_VALUES));
+	});
+
+	const RSlice packed = RSlice(buffer.data(), static_cast<uint32_t>(buffer.size())).Skip(4);
+
+	runner.Measure("bitfield/unpack-per-bit", NUM_VALUES, [&]()
+	{
+		uint64_t numSet = 0;
+		for (uint32_t pos = 0; pos < NUM_VALUES; ++pos)
+		{
+			numSet += GetBit(packed, pos) ? 1 : 0;
+		}
+		Consume(numSet);
+	});
+
+	runner.Measure("bitfield/unpack-block", NUM_VALUES, [&]()
+	{
+		uint8_t batch[64];
+		uint64_t numSet = 0;
+		for (uint32_t pos = 0; pos < NUM_VALUES; pos += 64)
+		{
+			const uint32_t num = std::min<uint32_t>(NUM_VALUES - pos, 64);
+			UnpackBits(packed, pos, num, batch);
+			for (uint32_t j = 0; j < num; ++j)
+			{
+				numSet += batch[j];
+			}
+		}
+		Consume(numSet);
+	});
+}
+
+void ParserBenchmarks(Runner& runner)
+{
+	const auto objects = IntegrityObjects(20);
+	const RSlice slice(objects.data(), static_cast<uint32_t>(objects.size()));
+
+	NullSOEHandler handler;
+	auto logger = Logger::Empty();
+
+	const uint32_t ITERATIONS = 1000;
+	runner.Measure("apdu-parser/class0-response", ITERATIONS, [&]()
+	{
+		uint64_t success = 0;
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			success += (MeasurementHandler::ProcessMeasurements(slice, logger, &handler) == ParseResult::OK) ? 1 : 0;
+		}
+		Consume(success);
+	});
+}
+
+void EventBufferBenchmarks(Runner& runner)
+{
+	const uint16_t NUM_EVENTS = 1000;
+	std::vector<uint8_t> buffer(FRAGMENT_SIZE);
+
+	auto fill = [](EventBuffer& events)
+	{
+		for (uint16_t i = 0; i < NUM_EVENTS; ++i)
+		{
+			events.Update(Event<AnalogSpec>(Analog(i), i % 100, EventClass::EC1, EventAnalogVariation::Group32Var1));
+		}
+	};
+
+	std::unique_ptr<EventBuffer> events;
+	auto reset = [&]()
+	{
+		events.reset(new EventBuffer(EventBufferConfig::AllTypes(NUM_EVENTS)));
+	};
+
+	runner.Measure("event-buffer/insert", NUM_EVENTS, [&]()
+	{
+		fill(*events);
+	}, reset);
+
+	runner.Measure("event-buffer/select", NUM_EVENTS, [&]()
+	{
+		events->SelectAllByClass(ClassField::AllEventClasses());
+	}, [&]()
+	{
+		reset();
+		fill(*events);
+	});
+
+	runner.Measure("event-buffer/write-and-clear", NUM_EVENTS, [&]()
+	{
+		while (events->HasAnySelection())
+		{
+			APDUResponse response(WSlice(buffer.data(), static_cast<uint32_t>(buffer.size())));
+			auto writer = response.GetWriter();
+			events->Load(writer);
+			events->ClearWritten();
+		}
+	}, [&]()
+	{
+		reset();
+		fill(*events);
+		events->SelectAllByClass(ClassField::AllEventClasses());
+	});
+}
+
+void IntegrityLoadBenchmarks(Runner& runner)
+{
+	const uint16_t NUM_POINTS = 1000;
+	DatabaseBuffers db(DatabaseSizes::AllTypes(NUM_POINTS), StaticTypeBitField::AllTypes(), IndexMode::Contiguous);
+	std::vector<uint8_t> buffer(FRAGMENT_SIZE);
+
+	const uint32_t ITERATIONS = 10;
+	runner.Measure("database/integrity-load-1000-points", ITERATIONS, [&]()
+	{
+		uint64_t fragments = 0;
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			db.SelectAll(GroupVariation::Group60Var1);
+			while (db.HasAnySelection())
+			{
+				APDUResponse response(WSlice(buffer.data(), static_cast<uint32_t>(buffer.size())));
+				auto writer = response.GetWriter();
+				db.Load(writer);
+				++fragments;
+			}
+		}
+		Consume(fragments);
+	});
+}
+
+void SchedulerBenchmarks(Runner& runner)
+{
+	const uint32_t NUM_TASKS = 100;
+	AlwaysRunFilter filter;
+	MockMasterApplication application;
+	NullSOEHandler handler;
+	MasterScheduler scheduler(filter);
+
+	auto builder = [](HeaderWriter& writer)
+	{
+		return writer.WriteHeader(GroupVariationID(60, 1), QualifierCode::ALL_OBJECTS);
+	};
+
+	for (uint32_t i = 0; i < NUM_TASKS; ++i)
+	{
+		scheduler.Schedule(std::make_shared<UserPollTask>(builder, true, TimeDuration::Seconds(1), TimeDuration::Seconds(5), application, handler, Logger::Empty(), TaskConfig::Default(), false));
+	}
+
+	const uint32_t ITERATIONS = 10000;
+	const MonotonicTimestamp now(0);
+	runner.Measure("scheduler/get-next-of-100", ITERATIONS, [&]()
+	{
+		uint64_t found = 0;
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			MonotonicTimestamp next;
+			auto task = scheduler.GetNext(now, next);
+			if (task)
+			{
+				++found;
+				scheduler.Schedule(task);
+			}
+		}
+		Consume(found);
+	});
+}
+
+}
+
+void RunMicroBenchmarks(Runner& runner)
+{
+	CRCBenchmarks(runner);
+	LinkParserBenchmarks(runner);
+	TransportRxBenchmarks(runner);
+	CodecBenchmarks(runner);
+	BitfieldBenchmarks(runner);
+	ParserBenchmarks(runner);
+	EventBufferBenchmarks(runner);
+	IntegrityLoadBenchmarks(runner);
+	SchedulerBenchmarks(runner);
+}
+
+}
@@ -0,0 +1,231 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Report.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <iomanip>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+
+namespace dnp3bench
+{
+
+namespace
+{
+
+std::string Escape(const std::string& value)
+{
+	std::string escaped;
+	for (auto c : value)
+	{
+		if (c == '"' || c == '\\')
+		{
+			escaped.push_back('\\');
+		}
+		escaped.push_back(c);
+	}
+	return escaped;
+}
+
+/**
+* Just enough of a JSON reader for the files WriteJson produces: walks the text and hands
+* every string-keyed scalar to the visitor, in document order
+*/
+class Scanner
+{
+public:
+
+	explicit Scanner(const std::string& text) : text(text)
+	{}
+
+	template <class Visitor>
+	bool Scan(const Visitor& visit)
+	{
+		while (Skip())
+		{
+			const auto c = text[pos];
+			if (c == '{' || c == '}' || c == '[' || c == ']' || c == ',' || c == ':')
+			{
+				++pos;
+				continue;
+			}
+
+			std::string key;
+			if (c != '"' || !ReadString(key))
+			{
+				return false;
+			}
+
+			if (!Skip() || text[pos] != ':')
+			{
+				// a string value inside an array, nothing to report
+				continue;
+			}
+			++pos;
+
+			if (!Skip())
+			{
+				return false;
+			}
+
+			if (text[pos] == '"')
+			{
+				std::string value;
+				if (!ReadString(value))
+				{
+					return false;
+				}
+				visit(key, value);
+			}
+			else if (text[pos] == '{' || text[pos] == '[')
+			{
+				continue;
+			}
+			else
+			{
+				const auto start = pos;
+				while (pos < text.size() && text[pos] != ',' && text[pos] != '}' && text[pos] != ']' && !std::isspace(static_cast<unsigned char>(text[pos])))
+				{
+					++pos;
+				}
+				visit(key, text.substr(start, pos - start));
+			}
+		}
+
+		return true;
+	}
+
+private:
+
+	bool Skip()
+	{
+		while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+		{
+			++pos;
+		}
+		return pos < text.size();
+	}
+
+	bool ReadString(std::string& value)
+	{
+		++pos; // opening quote
+		while (pos < text.size())
+		{
+			const auto c = text[pos++];
+			if (c == '"')
+			{
+				return true;
+			}
+			if (c == '\\' && pos < text.size())
+			{
+				value.push_back(text[pos++]);
+			}
+			else
+			{
+				value.push_back(c);
+			}
+		}
+		return false;
+	}
+
+	const std::string& text;
+	size_t pos = 0;
+};
+
+}
+
+void Report::WriteJson(std::ostream& output, const std::vector<Result>& results)
+{
+	std::ostringstream oss;
+	oss << std::setprecision(6) << std::fixed;
+
+	oss << "{" << std::endl << "  \"benchmarks\": [" << std::endl;
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const auto& r = results[i];
+		oss << "    {"
+		    << "\"name\": \"" << Escape(r.name) << "\", "
+		    << "\"unit\": \"" << Escape(r.unit) << "\", "
+		    << "\"repetitions\": " << r.samples.size() << ", "
+		    << "\"mean\": " << r.Mean() << ", "
+		    << "\"min\": " << r.Min() << ", "
+		    << "\"p50\": " << r.Percentile(0.5) << ", "
+		    << "\"p90\": " << r.Percentile(0.9) << ", "
+		    << "\"p99\": " << r.Percentile(0.99)
+		    << "}" << ((i + 1 < results.size()) ? "," : "") << std::endl;
+	}
+	oss << "  ]" << std::endl << "}" << std::endl;
+
+	output << oss.str();
+}
+
+bool Report::ReadBaseline(std::istream& input, std::map<std::string, double>& p50ByName)
+{
+	const std::string text((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+	std::string name;
+	Scanner scanner(text);
+	return scanner.Scan([&](const std::string& key, const std::string& value)
+	{
+		if (key == "name")
+		{
+			name = value;
+		}
+		else if (key == "p50" && !name.empty())
+		{
+			p50ByName[name] = std::strtod(value.c_str(), nullptr);
+		}
+	});
+}
+
+uint32_t Report::Compare(std::ostream& output, const std::map<std::string, double>& baseline, const std::vector<Result>& current, double thresholdPercent)
+{
+	uint32_t regressions = 0;
+
+	for (const auto& result : current)
+	{
+		const auto iter = baseline.find(result.name);
+		if (iter == baseline.end() || iter->second <= 0)
+		{
+			output << std::left << std::setw(40) << result.name << " (no baseline)" << std::endl;
+			continue;
+		}
+
+		const auto changePercent = 100.0 * (result.Percentile(0.5) - iter->second) / iter->second;
+		const bool regressed = changePercent > thresholdPercent;
+		if (regressed)
+		{
+			++regressions;
+		}
+
+		output << std::left << std::setw(40) << result.name << std::right << std::fixed << std::setprecision(2)
+		       << " baseline " << std::setw(12) << iter->second
+		       << " current " << std::setw(12) << result.Percentile(0.5)
+		       << " " << std::showpos << std::setw(8) << changePercent << std::noshowpos << "%"
+		       << (regressed ? "  REGRESSION" : "") << std::endl;
+	}
+
+	return regressions;
+}
+
+}
@@ -0,0 +1,54 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef DNP3BENCH_REPORT_H
+#define DNP3BENCH_REPORT_H
+
+#include "Benchmark.h"
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace dnp3bench
+{
+
+/**
+* Machine-readable results: write them as JSON, read back a saved baseline, and compare the two
+*/
+class Report
+{
+public:
+
+	/// Writes {"benchmarks":[{"name","unit","repetitions","mean","min","p50","p90","p99"}, ...]}
+	static void WriteJson(std::ostream& output, const std::vector<Result>& results);
+
+	/// Reads the p50 of each benchmark from a file written by WriteJson, keyed by name. Returns false if the file cannot be parsed.
+	static bool ReadBaseline(std::istream& input, std::map<std::string, double>& p50ByName);
+
+	/// Prints the change in p50 of every benchmark present in both sets and returns the number of
+	/// benchmarks that got slower by more than thresholdPercent
+	static uint32_t Compare(std::ostream& output, const std::map<std::string, double>& baseline, const std::vector<Result>& current, double thresholdPercent);
+};
+
+}
+
+#endif
@@ -0,0 +1,135 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Benchmarks.h"
+#include "Report.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+using namespace std;
+using namespace dnp3bench;
+
+/*
+* Runs the micro benchmarks and the macro scenarios, optionally writes the results as JSON, and optionally
+* compares them against a saved baseline. Exits with a non-zero code if any benchmark regressed.
+*
+* usage: dnp3-bench [--filter <substring>] [--warmup <n>] [--reps <n>] [--json <file>]
+*                   [--compare <baseline file>] [--threshold <percent>] [--no-macro]
+*                   [--pairs <n>] [--points <n>] [--rate <events/s>] [--seconds <n>]
+*/
+
+namespace
+{
+void Usage()
+{
+	cerr << "usage: dnp3-bench [--filter <substring>] [--warmup <n>] [--reps <n>] [--json <file>]" << endl
+	     << "                  [--compare <baseline file>] [--threshold <percent>] [--no-macro]" << endl
+	     << "                  [--pairs <n>] [--points <n>] [--rate <events/s>] [--seconds <n>]" << endl;
+}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	MacroOptions macro;
+	bool runMacro = true;
+	string jsonPath;
+	string baselinePath;
+	double thresholdPercent = 10.0;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const string arg = argv[i];
+
+		if (arg == "--no-macro")
+		{
+			runMacro = false;
+			continue;
+		}
+
+		if (i + 1 >= argc)
+		{
+			Usage();
+			return -1;
+		}
+
+		const char* value = argv[++i];
+
+		if (arg == "--filter") options.filter = value;
+		else if (arg == "--warmup") options.warmup = static_cast<uint32_t>(atoi(value));
+		else if (arg == "--reps") options.repetitions = static_cast<uint32_t>(atoi(value));
+		else if (arg == "--json") jsonPath = value;
+		else if (arg == "--compare") baselinePath = value;
+		else if (arg == "--threshold") thresholdPercent = atof(value);
+		else if (arg == "--pairs") macro.numPairs = static_cast<uint32_t>(atoi(value));
+		else if (arg == "--points") macro.numPoints = static_cast<uint16_t>(atoi(value));
+		else if (arg == "--rate") macro.eventsPerSecond = atof(value);
+		else if (arg == "--seconds") macro.seconds = static_cast<uint32_t>(atoi(value));
+		else
+		{
+			Usage();
+			return -1;
+		}
+	}
+
+	Runner runner(options);
+
+	RunMicroBenchmarks(runner);
+	if (runMacro)
+	{
+		RunMacroBenchmarks(runner, macro);
+	}
+
+	if (!jsonPath.empty())
+	{
+		ofstream output(jsonPath);
+		if (!output)
+		{
+			cerr << "unable to write " << jsonPath << endl;
+			return -1;
+		}
+		Report::WriteJson(output, runner.Results());
+	}
+
+	if (!baselinePath.empty())
+	{
+		ifstream input(baselinePath);
+		map<string, double> baseline;
+		if (!input || !Report::ReadBaseline(input, baseline))
+		{
+			cerr << "unable to read baseline " << baselinePath << endl;
+			return -1;
+		}
+
+		cout << endl << "comparison against " << baselinePath << " (p50, threshold " << thresholdPercent << "%)" << endl;
+		const auto regressions = Report::Compare(cout, baseline, runner.Results(), thresholdPercent);
+		if (regressions > 0)
+		{
+			cout << regressions << " benchmark(s) regressed" << endl;
+			return 1;
+		}
+	}
+
+	return 0;
+}
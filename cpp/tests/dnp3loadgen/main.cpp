@@ -0,0 +1,176 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <dnp3loadgen/LoadGenerator.h>
+
+#include <asiodnp3/ConsoleLogger.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace std;
+using namespace openpal;
+using namespace dnp3loadgen;
+
+/*
+* Runs thousands of synthetic outstations for master capacity testing. Every outstation changes analogs
+* as a random walk with a deadband, toggles binaries and increments counters at the configured rates.
+*
+* With --verify, an in-process master is connected to every outstation and the tool checks that every
+* generated event is delivered, reporting the end-to-end event latency. It exits with a non-zero code
+* if events are missing after the drain period.
+*/
+
+namespace
+{
+
+void Usage()
+{
+	cerr << "usage: dnp3-loadgen [--outstations <n>] [--shared] [--endpoint <ip>] [--port <base port>] [--address <base address>]" << endl
+	     << "                    [--points <n per type>] [--analog-rate <steps/s>] [--deadband <value>] [--binary-rate <toggles/s>]" << endl
+	     << "                    [--counter-rate <increments/s>] [--tick <ms>] [--buffer <events per type>] [--unsol] [--ring <capacity>]" << endl
+	     << "                    [--threads <n>] [--verify] [--poll <ms>] [--seconds <n>] [--drain <seconds>] [--seed <n>]" << endl;
+}
+
+void Print(const char* label, const LoadStatistics& stats, bool verify)
+{
+	cout << std::left << std::setw(8) << label << std::right
+	     << " generated " << std::setw(10) << stats.generated.Total()
+	     << " (b " << stats.generated.numBinary << " a " << stats.generated.numAnalog << " c " << stats.generated.numCounter << ")";
+
+	if (stats.numRejected > 0)
+	{
+		cout << " rejected " << stats.numRejected;
+	}
+
+	if (verify)
+	{
+		const auto& d = stats.delivery;
+		cout << " delivered " << std::setw(10) << d.delivered.Total()
+		     << " latency ms p50 " << d.latencyP50Ms << " p90 " << d.latencyP90Ms << " p99 " << d.latencyP99Ms << " max " << d.latencyMaxMs;
+	}
+
+	cout << endl;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+	LoadConfig config;
+	uint32_t seconds = 10;
+	uint32_t drainSeconds = 5;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const string arg = argv[i];
+
+		if (arg == "--shared") config.topology = Topology::SharedListener;
+		else if (arg == "--unsol") config.unsolicited = true;
+		else if (arg == "--verify") config.verify = true;
+		else if (i + 1 < argc)
+		{
+			const char* value = argv[++i];
+
+			if (arg == "--outstations") config.numOutstations = static_cast<uint32_t>(atoi(value));
+			else if (arg == "--endpoint") config.endpoint = value;
+			else if (arg == "--port") config.basePort = static_cast<uint16_t>(atoi(value));
+			else if (arg == "--address") config.baseAddress = static_cast<uint16_t>(atoi(value));
+			else if (arg == "--points")
+			{
+				const auto points = static_cast<uint16_t>(atoi(value));
+				config.analogs.numPoints = config.binaries.numPoints = config.counters.numPoints = points;
+			}
+			else if (arg == "--analog-rate") config.analogs.stepsPerSecond = atof(value);
+			else if (arg == "--deadband") config.analogs.deadband = atof(value);
+			else if (arg == "--binary-rate") config.binaries.togglesPerSecond = atof(value);
+			else if (arg == "--counter-rate") config.counters.incrementsPerSecond = atof(value);
+			else if (arg == "--tick") config.tickPeriod = TimeDuration::Milliseconds(atoi(value));
+			else if (arg == "--buffer") config.eventBufferSize = static_cast<uint16_t>(atoi(value));
+			else if (arg == "--ring") config.ingestionCapacity = static_cast<uint32_t>(atoi(value));
+			else if (arg == "--threads") config.numThreads = static_cast<uint32_t>(atoi(value));
+			else if (arg == "--poll") config.pollPeriod = TimeDuration::Milliseconds(atoi(value));
+			else if (arg == "--seconds") seconds = static_cast<uint32_t>(atoi(value));
+			else if (arg == "--drain") drainSeconds = static_cast<uint32_t>(atoi(value));
+			else if (arg == "--seed") config.seed = static_cast<uint32_t>(atoi(value));
+			else
+			{
+				Usage();
+				return -1;
+			}
+		}
+		else
+		{
+			Usage();
+			return -1;
+		}
+	}
+
+	cout << config.numOutstations << " outstation(s) on " << config.endpoint << ":" << config.basePort
+	     << ((config.topology == Topology::SharedListener) ? " (shared listener)" : " and up")
+	     << (config.unsolicited ? ", unsolicited" : "")
+	     << ((config.ingestionCapacity > 0) ? ", ingestion ring" : ", bulk apply") << endl;
+
+	LoadGenerator generator(config, asiodnp3::ConsoleLogger::Create());
+	generator.Start();
+
+	for (uint32_t s = 1; s <= seconds; ++s)
+	{
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+		Print((to_string(s) + "s").c_str(), generator.GetStatistics(), config.verify);
+	}
+
+	generator.Stop();
+
+	if (!config.verify)
+	{
+		Print("total", generator.GetStatistics(), false);
+		return 0;
+	}
+
+	// give the masters time to collect what is still buffered
+	for (uint32_t s = 0; s < drainSeconds; ++s)
+	{
+		const auto stats = generator.GetStatistics();
+		if (stats.delivery.delivered.Total() >= stats.generated.Total())
+		{
+			break;
+		}
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+	}
+
+	const auto stats = generator.GetStatistics();
+	Print("total", stats, true);
+
+	// updates refused by the ring were never applied and cannot be delivered
+	const auto expected = stats.generated.Total() - stats.numRejected;
+	if (stats.delivery.delivered.Total() != expected)
+	{
+		cout << "MISMATCH: expected " << expected << " event(s), delivered " << stats.delivery.delivered.Total() << endl;
+		return 1;
+	}
+
+	cout << "all generated events delivered" << endl;
+	return 0;
+}
@@ -0,0 +1,114 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <dnp3sim/Simulation.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+using namespace std;
+using namespace openpal;
+using namespace dnp3sim;
+
+/*
+* Runs master / outstation pairs over simulated links in virtual time and reports the CPU time per
+* poll, per event and per command, and the heap memory used by each pair.
+*
+* usage: dnp3-sim [pairs] [seconds] [latency ms] [kbps, 0 = unlimited] [loss %] [seed]
+*/
+
+namespace
+{
+// heap bytes currently allocated, tracked with a size prefix on every allocation
+std::atomic<int64_t> liveBytes(0);
+
+const size_t PREFIX_SIZE = alignof(std::max_align_t);
+
+void Report(const char* name, const char* unit, const WorkloadResult& result, uint32_t seconds)
+{
+	cout << std::left << std::setw(9) << name << std::right << std::fixed << std::setprecision(2)
+	     << std::setw(10) << result.numOperations << " " << std::left << std::setw(9) << unit << std::right
+	     << std::setw(7) << result.numFailures << " failed "
+	     << std::setw(9) << result.CpuMicrosPerOperation() << " us cpu/op "
+	     << std::setw(10) << result.numHandlers << " handlers "
+	     << std::setw(9) << (result.numWireBytes * 8 / 1000 / (seconds > 0 ? seconds : 1)) << " kbps on the wire" << endl;
+}
+}
+
+void* operator new(size_t size)
+{
+	auto block = static_cast<uint8_t*>(std::malloc(size + PREFIX_SIZE));
+	if (!block)
+	{
+		throw std::bad_alloc();
+	}
+	*reinterpret_cast<size_t*>(block) = size;
+	liveBytes += static_cast<int64_t>(size);
+	return block + PREFIX_SIZE;
+}
+
+void operator delete(void* ptr) noexcept
+{
+	if (ptr)
+	{
+		auto block = static_cast<uint8_t*>(ptr) - PREFIX_SIZE;
+		liveBytes -= static_cast<int64_t>(*reinterpret_cast<size_t*>(block));
+		std::free(block);
+	}
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	operator delete(ptr);
+}
+
+int main(int argc, char* argv[])
+{
+	SimulationConfig config;
+	config.numPairs = (argc > 1) ? static_cast<uint32_t>(std::atoi(argv[1])) : 1000;
+	const uint32_t seconds = (argc > 2) ? static_cast<uint32_t>(std::atoi(argv[2])) : 60;
+	config.link.latency = TimeDuration::Milliseconds((argc > 3) ? std::atoi(argv[3]) : 20);
+	config.link.bitsPerSecond = static_cast<uint32_t>(((argc > 4) ? std::atoi(argv[4]) : 64) * 1000);
+	config.link.lossProbability = ((argc > 5) ? std::atof(argv[5]) : 0.0) / 100.0;
+	config.seed = (argc > 6) ? static_cast<uint32_t>(std::atoi(argv[6])) : 1;
+
+	cout << config.numPairs << " pairs, " << seconds << " simulated second(s) per workload, "
+	     << config.link.latency.GetMilliseconds() << " ms latency, " << (config.link.bitsPerSecond / 1000) << " kbps, "
+	     << (config.link.lossProbability * 100.0) << "% loss, seed " << config.seed << endl;
+
+	const auto before = liveBytes.load();
+
+	Simulation sim(config);
+	sim.Start();
+
+	const auto perPair = (liveBytes.load() - before) / static_cast<int64_t>(config.numPairs > 0 ? config.numPairs : 1);
+	cout << "memory   " << perPair << " bytes per pair" << endl;
+
+	const auto duration = TimeDuration::Seconds(seconds);
+
+	Report("polls", "polls", sim.RunPolls(TimeDuration::Seconds(10), duration), seconds);
+	Report("events", "events", sim.RunEvents(1.0, TimeDuration::Seconds(2), duration), seconds);
+	Report("commands", "commands", sim.RunCommands(TimeDuration::Seconds(5), duration), seconds);
+
+	return 0;
+}
@@ -0,0 +1,55 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "ChangeProcess.h"
+
+namespace dnp3loadgen
+{
+
+ChangeProcess::ChangeProcess(const LoadConfig& config, uint32_t seed) :
+	analogConfig(config.analogs),
+	binaryConfig(config.binaries),
+	counterConfig(config.counters),
+	random(seed),
+	analogs(config.analogs.numPoints),
+	binaries(config.binaries.numPoints, false),
+	counters(config.counters.numPoints, 0)
+{
+
+}
+
+uint32_t ChangeProcess::Arrivals(uint16_t numPoints, double ratePerSecond, double seconds)
+{
+	const auto mean = ratePerSecond * seconds;
+	if (numPoints == 0 || mean <= 0)
+	{
+		return 0;
+	}
+
+	std::poisson_distribution<uint32_t> arrivals(mean);
+	return arrivals(random);
+}
+
+uint16_t ChangeProcess::Pick(uint16_t numPoints)
+{
+	return static_cast<uint16_t>(std::uniform_int_distribution<uint32_t>(0, numPoints - 1)(random));
+}
+
+}
@@ -0,0 +1,141 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef DNP3LOADGEN_CHANGEPROCESS_H
+#define DNP3LOADGEN_CHANGEPROCESS_H
+
+#include "LoadConfig.h"
+
+#include <opendnp3/app/MeasurementTypes.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace dnp3loadgen
+{
+
+/**
+* Number of updates generated per type
+*/
+struct ChangeCounts
+{
+	uint64_t numBinary = 0;
+	uint64_t numAnalog = 0;
+	uint64_t numCounter = 0;
+
+	uint64_t Total() const
+	{
+		return numBinary + numAnalog + numCounter;
+	}
+
+	ChangeCounts& operator+=(const ChangeCounts& other)
+	{
+		numBinary += other.numBinary;
+		numAnalog += other.numAnalog;
+		numCounter += other.numCounter;
+		return *this;
+	}
+};
+
+/**
+* The change processes of a single outstation. Every update is timestamped with the time it was
+* generated so that the latency of its event can be measured wherever it is received.
+*/
+class ChangeProcess
+{
+public:
+
+	ChangeProcess(const LoadConfig& config, uint32_t seed);
+
+	/**
+	* Advance every process by 'seconds' and pass the resulting updates to the sink, which must provide
+	* Update(const Binary&, uint16_t), Update(const Analog&, uint16_t) and Update(const Counter&, uint16_t)
+	*/
+	template <class Sink>
+	void Tick(double seconds, int64_t timeMs, Sink& sink);
+
+	const ChangeCounts& Counts() const
+	{
+		return counts;
+	}
+
+private:
+
+	/// number of arrivals of a Poisson process during 'seconds', always 0 for a type without points
+	uint32_t Arrivals(uint16_t numPoints, double ratePerSecond, double seconds);
+
+	uint16_t Pick(uint16_t numPoints);
+
+	struct AnalogState
+	{
+		double value = 0;
+		double reported = 0;
+	};
+
+	const AnalogProcess analogConfig;
+	const BinaryProcess binaryConfig;
+	const CounterProcess counterConfig;
+
+	std::mt19937 random;
+	std::vector<AnalogState> analogs;
+	std::vector<bool> binaries;
+	std::vector<uint32_t> counters;
+	ChangeCounts counts;
+};
+
+template <class Sink>
+void ChangeProcess::Tick(double seconds, int64_t timeMs, Sink& sink)
+{
+	const opendnp3::DNPTime time(timeMs);
+
+	for (auto n = Arrivals(binaryConfig.numPoints, binaryConfig.togglesPerSecond, seconds); n > 0; --n)
+	{
+		const auto index = Pick(binaryConfig.numPoints);
+		binaries[index] = !binaries[index];
+		sink.Update(opendnp3::Binary(binaries[index], 0x01, time), index);
+		++counts.numBinary;
+	}
+
+	std::uniform_real_distribution<double> step(-analogConfig.stepSize, analogConfig.stepSize);
+	for (auto n = Arrivals(analogConfig.numPoints, analogConfig.stepsPerSecond, seconds); n > 0; --n)
+	{
+		const auto index = Pick(analogConfig.numPoints);
+		auto& state = analogs[index];
+		state.value += step(random);
+		if (std::abs(state.value - state.reported) > analogConfig.deadband)
+		{
+			state.reported = state.value;
+			sink.Update(opendnp3::Analog(state.value, 0x01, time), index);
+			++counts.numAnalog;
+		}
+	}
+
+	for (auto n = Arrivals(counterConfig.numPoints, counterConfig.incrementsPerSecond, seconds); n > 0; --n)
+	{
+		const auto index = Pick(counterConfig.numPoints);
+		sink.Update(opendnp3::Counter(++counters[index], 0x01, time), index);
+		++counts.numCounter;
+	}
+}
+
+}
+
+#endif
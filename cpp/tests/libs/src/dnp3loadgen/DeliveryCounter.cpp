@@ -0,0 +1,108 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "DeliveryCounter.h"
+
+#include <asiopal/UTCTimeSource.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace opendnp3;
+
+namespace dnp3loadgen
+{
+
+void LatencyHistogram::Record(int64_t ms)
+{
+	const auto bounded = static_cast<uint32_t>(std::min<int64_t>(std::max<int64_t>(ms, 0), MAX_MS));
+	++buckets[bounded];
+	++count;
+	max = std::max(max, bounded);
+}
+
+uint32_t LatencyHistogram::Percentile(double p) const
+{
+	// nearest rank
+	const auto rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(p * count)), 1);
+	uint64_t seen = 0;
+	for (uint32_t ms = 0; ms <= MAX_MS; ++ms)
+	{
+		seen += buckets[ms];
+		if (seen >= rank)
+		{
+			return ms;
+		}
+	}
+	return max;
+}
+
+DeliveryCounter::Snapshot DeliveryCounter::GetSnapshot() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	Snapshot snapshot;
+	snapshot.delivered = delivered;
+	snapshot.numLatencySamples = latency.Count();
+	snapshot.latencyP50Ms = latency.Percentile(0.5);
+	snapshot.latencyP90Ms = latency.Percentile(0.9);
+	snapshot.latencyP99Ms = latency.Percentile(0.99);
+	snapshot.latencyMaxMs = latency.Max();
+	return snapshot;
+}
+
+void DeliveryCounter::Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values)
+{
+	this->Count(info, values, &ChangeCounts::numBinary);
+}
+
+void DeliveryCounter::Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values)
+{
+	this->Count(info, values, &ChangeCounts::numAnalog);
+}
+
+void DeliveryCounter::Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values)
+{
+	this->Count(info, values, &ChangeCounts::numCounter);
+}
+
+template <class T>
+void DeliveryCounter::Count(const HeaderInfo& info, const ICollection<Indexed<T>>& values, uint64_t ChangeCounts::* field)
+{
+	// static values from integrity polls are not generated events
+	if (!info.isEventVariation)
+	{
+		return;
+	}
+
+	const auto now = static_cast<int64_t>(asiopal::UTCTimeSource::Instance().Now().msSinceEpoch);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	values.ForeachItem([&](const Indexed<T>& item)
+	{
+		++(delivered.*field);
+		if (item.value.time.value != 0)
+		{
+			latency.Record(now - item.value.time.value);
+		}
+	});
+}
+
+}
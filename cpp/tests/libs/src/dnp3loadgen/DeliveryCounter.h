@@ -0,0 +1,121 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef DNP3LOADGEN_DELIVERYCOUNTER_H
+#define DNP3LOADGEN_DELIVERYCOUNTER_H
+
+#include "ChangeProcess.h"
+
+#include <opendnp3/master/ISOEHandler.h>
+
+#include <mutex>
+#include <vector>
+
+namespace dnp3loadgen
+{
+
+/**
+* Distribution of end-to-end event latencies with 1 ms resolution. Latencies above the range are
+* counted in the last bucket.
+*/
+class LatencyHistogram
+{
+public:
+
+	static const uint32_t MAX_MS = 60000;
+
+	LatencyHistogram() : buckets(MAX_MS + 1, 0)
+	{}
+
+	void Record(int64_t ms);
+
+	/// latency in ms below which fraction 'p' of the samples lie
+	uint32_t Percentile(double p) const;
+
+	uint64_t Count() const
+	{
+		return count;
+	}
+
+	uint32_t Max() const
+	{
+		return max;
+	}
+
+private:
+
+	std::vector<uint64_t> buckets;
+	uint64_t count = 0;
+	uint32_t max = 0;
+};
+
+/**
+* Master side SOE handler that counts the generated events it receives and measures their age
+* from the timestamp given to them by the change process
+*/
+class DeliveryCounter final : public opendnp3::ISOEHandler
+{
+public:
+
+	struct Snapshot
+	{
+		ChangeCounts delivered;
+		uint64_t numLatencySamples = 0;
+		uint32_t latencyP50Ms = 0;
+		uint32_t latencyP90Ms = 0;
+		uint32_t latencyP99Ms = 0;
+		uint32_t latencyMaxMs = 0;
+	};
+
+	Snapshot GetSnapshot() const;
+
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Binary>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Analog>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Counter>>& values) override;
+
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::DoubleBitBinary>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::FrozenCounter>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::BinaryOutputStatus>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::AnalogOutputStatus>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::OctetString>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::TimeAndInterval>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::BinaryCommandEvent>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::AnalogCommandEvent>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::SecurityStat>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::DNPTime>& values) override {}
+
+protected:
+
+	virtual void Start() override {}
+	virtual void End() override {}
+
+private:
+
+	template <class T>
+	void Count(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<T>>& values, uint64_t ChangeCounts::* field);
+
+	mutable std::mutex mutex;
+	ChangeCounts delivered;
+	LatencyHistogram latency;
+};
+
+}
+
+#endif
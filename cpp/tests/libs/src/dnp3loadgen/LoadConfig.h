@@ -0,0 +1,136 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef DNP3LOADGEN_LOADCONFIG_H
+#define DNP3LOADGEN_LOADCONFIG_H
+
+#include <openpal/executor/TimeDuration.h>
+
+#include <cstdint>
+#include <string>
+
+namespace dnp3loadgen
+{
+
+/**
+* How the outstations are exposed to masters
+*/
+enum class Topology : uint8_t
+{
+	/// every outstation listens on its own port, starting at LoadConfig::basePort
+	PortPerOutstation,
+	/// every outstation shares a single listener on LoadConfig::basePort and is selected by its link address
+	SharedListener
+};
+
+/**
+* Random walk of analog values. Each step moves one point by a uniformly distributed amount in
+* [-stepSize, stepSize] and only steps that move a point by more than 'deadband' since its last
+* reported value produce an update.
+*/
+struct AnalogProcess
+{
+	uint16_t numPoints = 10;
+
+	/// mean random walk steps per second per outstation, as a Poisson process
+	double stepsPerSecond = 10;
+
+	double stepSize = 1.0;
+
+	double deadband = 2.0;
+};
+
+/**
+* Binary points that toggle as a Poisson process
+*/
+struct BinaryProcess
+{
+	uint16_t numPoints = 10;
+
+	/// mean toggles per second per outstation
+	double togglesPerSecond = 1;
+};
+
+/**
+* Counters that increment as a Poisson process
+*/
+struct CounterProcess
+{
+	uint16_t numPoints = 10;
+
+	/// mean increments per second per outstation
+	double incrementsPerSecond = 1;
+};
+
+/**
+* Configuration of a set of synthetic outstations
+*/
+struct LoadConfig
+{
+	uint32_t numOutstations = 100;
+
+	Topology topology = Topology::PortPerOutstation;
+
+	/// address the outstations listen on
+	std::string endpoint = "127.0.0.1";
+
+	uint16_t basePort = 20000;
+
+	/// link address of the master(s)
+	uint16_t masterAddress = 1;
+
+	/// link address of the first outstation. With a shared listener, outstation 'i' uses baseAddress + i
+	uint16_t baseAddress = 10;
+
+	AnalogProcess analogs;
+	BinaryProcess binaries;
+	CounterProcess counters;
+
+	/// changes are generated and applied to every outstation once per tick
+	openpal::TimeDuration tickPeriod = openpal::TimeDuration::Milliseconds(100);
+
+	/// events buffered per type in each outstation
+	uint16_t eventBufferSize = 1000;
+
+	/// allow the outstations to report events unsolicited
+	bool unsolicited = false;
+
+	/// when non-zero, changes are pushed through IOutstation::Enqueue and a ring of this capacity instead of IOutstation::Apply
+	uint32_t ingestionCapacity = 0;
+
+	/// threads in the pool running the stacks
+	uint32_t numThreads = 4;
+
+	/// run an in-process master for every outstation that counts the events delivered and their latency
+	bool verify = false;
+
+	/// how often the verifying masters read classes 1, 2 and 3 when unsolicited reporting is disabled
+	openpal::TimeDuration pollPeriod = openpal::TimeDuration::Seconds(1);
+
+	/// seed of the change processes, outstation 'i' uses seed + i
+	uint32_t seed = 1;
+
+	/// log levels of every channel and stack
+	uint32_t logLevels = 0;
+};
+
+}
+
+#endif
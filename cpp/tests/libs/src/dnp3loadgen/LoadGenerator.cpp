@@ -0,0 +1,277 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "LoadGenerator.h"
+
+#include <asiodnp3/DefaultMasterApplication.h>
+#include <asiodnp3/UpdateBuilder.h>
+#include <asiopal/UTCTimeSource.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+
+#include <chrono>
+#include <string>
+
+using namespace openpal;
+using namespace opendnp3;
+using namespace asiopal;
+using namespace asiodnp3;
+
+namespace dnp3loadgen
+{
+
+struct LoadGenerator::Outstation
+{
+	Outstation(const LoadConfig& config, uint32_t seed, const std::shared_ptr<IOutstation>& stack) :
+		process(config, seed),
+		stack(stack)
+	{}
+
+	ChangeProcess process;
+	std::shared_ptr<IOutstation> stack;
+};
+
+namespace
+{
+
+/// collects the changes of one tick into a single Apply call
+class ApplySink
+{
+public:
+
+	template <class T>
+	void Update(const T& meas, uint16_t index)
+	{
+		builder.Update(meas, index, EventMode::Force);
+		empty = false;
+	}
+
+	UpdateBuilder builder;
+	bool empty = true;
+};
+
+/// pushes every change through the outstation's ingestion ring
+class EnqueueSink
+{
+public:
+
+	explicit EnqueueSink(IOutstation& outstation) : outstation(&outstation)
+	{}
+
+	template <class T>
+	void Update(const T& meas, uint16_t index)
+	{
+		if (!outstation->Enqueue(meas, index, EventMode::Force))
+		{
+			++numRejected;
+		}
+	}
+
+	IOutstation* outstation;
+	uint64_t numRejected = 0;
+};
+
+}
+
+LoadGenerator::LoadGenerator(const LoadConfig& config, std::shared_ptr<ILogHandler> handler) :
+	config(config),
+	manager(new DNP3Manager(config.numThreads, handler)),
+	delivery(std::make_shared<DeliveryCounter>()),
+	running(false)
+{
+	this->AddOutstations();
+
+	if (config.verify)
+	{
+		this->AddVerifyingMasters();
+	}
+}
+
+LoadGenerator::~LoadGenerator()
+{
+	this->Stop();
+
+	// stop the stacks before the change processes and counters they reference go away
+	manager->Shutdown();
+}
+
+void LoadGenerator::AddOutstations()
+{
+	const DatabaseSizes sizes(config.binaries.numPoints, 0, config.analogs.numPoints, config.counters.numPoints, 0, 0, 0, 0);
+
+	std::shared_ptr<IChannel> shared;
+	if (config.topology == Topology::SharedListener)
+	{
+		shared = manager->AddTCPServer("outstations", config.logLevels, ChannelRetry::Default(), config.endpoint, config.basePort, nullptr);
+	}
+
+	for (uint32_t i = 0; i < config.numOutstations; ++i)
+	{
+		OutstationStackConfig stackConfig(sizes);
+		stackConfig.outstation.eventBufferConfig = EventBufferConfig::AllTypes(config.eventBufferSize);
+		stackConfig.outstation.params.allowUnsolicited = config.unsolicited;
+		stackConfig.ingestion.capacity = config.ingestionCapacity;
+		stackConfig.link.LocalAddr = (config.topology == Topology::SharedListener) ? static_cast<uint16_t>(config.baseAddress + i) : config.baseAddress;
+		stackConfig.link.RemoteAddr = config.masterAddress;
+		stackConfig.link.KeepAliveTimeout = TimeDuration::Max();
+
+		// events carry the time they were generated so their latency can be measured end to end
+		for (uint16_t j = 0; j < stackConfig.dbConfig.binary.Size(); ++j)
+		{
+			stackConfig.dbConfig.binary[j].evariation = EventBinaryVariation::Group2Var2;
+		}
+		for (uint16_t j = 0; j < stackConfig.dbConfig.analog.Size(); ++j)
+		{
+			stackConfig.dbConfig.analog[j].evariation = EventAnalogVariation::Group32Var7;
+		}
+		for (uint16_t j = 0; j < stackConfig.dbConfig.counter.Size(); ++j)
+		{
+			stackConfig.dbConfig.counter[j].evariation = EventCounterVariation::Group22Var5;
+		}
+
+		const auto id = "outstation-" + std::to_string(i);
+		auto channel = shared ? shared : manager->AddTCPServer(id, config.logLevels, ChannelRetry::Default(), config.endpoint, static_cast<uint16_t>(config.basePort + i), nullptr);
+		auto stack = channel->AddOutstation(id, SuccessCommandHandler::Create(), DefaultOutstationApplication::Create(), stackConfig);
+
+		outstations.push_back(std::unique_ptr<Outstation>(new Outstation(config, config.seed + i, stack)));
+	}
+}
+
+void LoadGenerator::AddVerifyingMasters()
+{
+	std::shared_ptr<IChannel> shared;
+	if (config.topology == Topology::SharedListener)
+	{
+		shared = manager->AddTCPClient("masters", config.logLevels, ChannelRetry::Default(), config.endpoint, "0.0.0.0", config.basePort, nullptr);
+	}
+
+	for (uint32_t i = 0; i < config.numOutstations; ++i)
+	{
+		MasterStackConfig stackConfig;
+		stackConfig.master.disableUnsolOnStartup = !config.unsolicited;
+		stackConfig.link.LocalAddr = config.masterAddress;
+		stackConfig.link.RemoteAddr = (config.topology == Topology::SharedListener) ? static_cast<uint16_t>(config.baseAddress + i) : config.baseAddress;
+		stackConfig.link.KeepAliveTimeout = TimeDuration::Max();
+
+		const auto id = "master-" + std::to_string(i);
+		auto channel = shared ? shared : manager->AddTCPClient(id, config.logLevels, ChannelRetry::Default(), config.endpoint, "0.0.0.0", static_cast<uint16_t>(config.basePort + i), nullptr);
+		auto master = channel->AddMaster(id, delivery, DefaultMasterApplication::Create(), stackConfig);
+
+		if (!config.unsolicited)
+		{
+			master->AddClassScan(ClassField::AllEventClasses(), config.pollPeriod);
+		}
+
+		master->Enable();
+	}
+}
+
+void LoadGenerator::Start()
+{
+	if (running.exchange(true))
+	{
+		return;
+	}
+
+	for (auto& outstation : outstations)
+	{
+		outstation->stack->Enable();
+	}
+
+	thread = std::thread([this]()
+	{
+		this->Run();
+	});
+}
+
+void LoadGenerator::Stop()
+{
+	if (running.exchange(false))
+	{
+		thread.join();
+	}
+}
+
+LoadStatistics LoadGenerator::GetStatistics() const
+{
+	LoadStatistics statistics;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		statistics.generated = generated;
+		statistics.numRejected = numRejected;
+	}
+	statistics.delivery = delivery->GetSnapshot();
+	return statistics;
+}
+
+void LoadGenerator::Run()
+{
+	const auto period = std::chrono::milliseconds(config.tickPeriod.GetMilliseconds());
+	auto last = std::chrono::steady_clock::now();
+	auto next = last + period;
+
+	while (running)
+	{
+		std::this_thread::sleep_until(next);
+
+		// generate for the time that actually elapsed so that the rates hold even if a tick runs late
+		const auto now = std::chrono::steady_clock::now();
+		const auto seconds = std::chrono::duration<double>(now - last).count();
+		last = now;
+		next += period;
+
+		const auto timeMs = static_cast<int64_t>(UTCTimeSource::Instance().Now().msSinceEpoch);
+		for (auto& outstation : outstations)
+		{
+			this->Tick(*outstation, seconds, timeMs);
+		}
+	}
+}
+
+void LoadGenerator::Tick(Outstation& outstation, double seconds, int64_t timeMs)
+{
+	const auto before = outstation.process.Counts();
+	uint64_t rejected = 0;
+
+	if (config.ingestionCapacity > 0)
+	{
+		EnqueueSink sink(*outstation.stack);
+		outstation.process.Tick(seconds, timeMs, sink);
+		rejected = sink.numRejected;
+	}
+	else
+	{
+		ApplySink sink;
+		outstation.process.Tick(seconds, timeMs, sink);
+		if (!sink.empty)
+		{
+			outstation.stack->Apply(sink.builder.Build());
+		}
+	}
+
+	const auto& after = outstation.process.Counts();
+
+	std::lock_guard<std::mutex> lock(mutex);
+	generated.numBinary += after.numBinary - before.numBinary;
+	generated.numAnalog += after.numAnalog - before.numAnalog;
+	generated.numCounter += after.numCounter - before.numCounter;
+	numRejected += rejected;
+}
+
+}
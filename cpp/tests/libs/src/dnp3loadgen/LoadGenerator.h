@@ -0,0 +1,101 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef DNP3LOADGEN_LOADGENERATOR_H
+#define DNP3LOADGEN_LOADGENERATOR_H
+
+#include "LoadConfig.h"
+#include "ChangeProcess.h"
+#include "DeliveryCounter.h"
+
+#include <asiodnp3/DNP3Manager.h>
+#include <asiodnp3/IOutstation.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dnp3loadgen
+{
+
+/**
+* Generated versus delivered totals since the generator started
+*/
+struct LoadStatistics
+{
+	/// updates generated by the change processes
+	ChangeCounts generated;
+
+	/// updates refused by a full ingestion ring
+	uint64_t numRejected = 0;
+
+	/// events received by the verifying masters, only populated when LoadConfig::verify is set
+	DeliveryCounter::Snapshot delivery;
+};
+
+/**
+* Runs a set of synthetic outstations on a DNP3Manager and drives each one with its own change processes.
+*
+* Every tick, the changes of an outstation are applied in one IOutstation::Apply call, or pushed through its
+* ingestion ring, so the cost of generating load stays small compared to the stacks themselves. Optionally
+* runs a master for every outstation that verifies what was generated is delivered.
+*/
+class LoadGenerator final : private openpal::Uncopyable
+{
+	struct Outstation;
+
+public:
+
+	LoadGenerator(const LoadConfig& config, std::shared_ptr<openpal::ILogHandler> handler);
+	~LoadGenerator();
+
+	/// enable every stack and start generating changes
+	void Start();
+
+	/// stop generating changes. The stacks keep running so that buffered events can still be delivered.
+	void Stop();
+
+	LoadStatistics GetStatistics() const;
+
+private:
+
+	void AddOutstations();
+	void AddVerifyingMasters();
+	void Run();
+	void Tick(Outstation& outstation, double seconds, int64_t timeMs);
+
+	const LoadConfig config;
+	std::unique_ptr<asiodnp3::DNP3Manager> manager;
+	std::vector<std::unique_ptr<Outstation>> outstations;
+	std::shared_ptr<DeliveryCounter> delivery;
+
+	std::atomic<bool> running;
+	std::thread thread;
+
+	mutable std::mutex mutex;
+	ChangeCounts generated;
+	uint64_t numRejected = 0;
+};
+
+}
+
+#endif
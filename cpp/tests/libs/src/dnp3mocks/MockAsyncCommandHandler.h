@@ -0,0 +1,139 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MOCK_ASYNC_COMMAND_HANDLER_H
+#define OPENDNP3_MOCK_ASYNC_COMMAND_HANDLER_H
+
+#include <opendnp3/outstation/IAsyncCommandHandler.h>
+
+#include <deque>
+
+namespace opendnp3
+{
+
+/**
+* Records the completion handle of every command so that tests can complete them later
+*/
+class MockAsyncCommandHandler final : public IAsyncCommandHandler
+{
+public:
+
+	virtual void Select(const ControlRelayOutputBlock& command, uint16_t index, const CommandCompletion& completion) override
+	{
+		this->Record(true, completion);
+	}
+
+	virtual void Operate(const ControlRelayOutputBlock& command, uint16_t index, OperateType opType, const CommandCompletion& completion) override
+	{
+		this->Record(false, completion);
+	}
+
+	virtual void Select(const AnalogOutputInt16& command, uint16_t index, const CommandCompletion& completion) override
+	{
+		this->Record(true, completion);
+	}
+
+	virtual void Operate(const AnalogOutputInt16& command, uint16_t index, OperateType opType, const CommandCompletion& completion) override
+	{
+		this->Record(false, completion);
+	}
+
+	virtual void Select(const AnalogOutputInt32& command, uint16_t index, const CommandCompletion& completion) override
+	{
+		this->Record(true, completion);
+	}
+
+	virtual void Operate(const AnalogOutputInt32& command, uint16_t index, OperateType opType, const CommandCompletion& completion) override
+	{
+		this->Record(false, completion);
+	}
+
+	virtual void Select(const AnalogOutputFloat32& command, uint16_t index, const CommandCompletion& completion) override
+	{
+		this->Record(true, completion);
+	}
+
+	virtual void Operate(const AnalogOutputFloat32& command, uint16_t index, OperateType opType, const CommandCompletion& completion) override
+	{
+		this->Record(false, completion);
+	}
+
+	virtual void Select(const AnalogOutputDouble64& command, uint16_t index, const CommandCompletion& completion) override
+	{
+		this->Record(true, completion);
+	}
+
+	virtual void Operate(const AnalogOutputDouble64& command, uint16_t index, OperateType opType, const CommandCompletion& completion) override
+	{
+		this->Record(false, completion);
+	}
+
+	/// complete the oldest outstanding command
+	bool CompleteNext(CommandStatus status)
+	{
+		if (pending.empty())
+		{
+			return false;
+		}
+
+		pending.front().Complete(status);
+		pending.pop_front();
+		return true;
+	}
+
+	std::deque<CommandCompletion> pending;
+
+	uint32_t numSelect = 0;
+	uint32_t numOperate = 0;
+	uint32_t numStart = 0;
+	uint32_t numEnd = 0;
+
+protected:
+
+	virtual void Start() override
+	{
+		++numStart;
+	}
+
+	virtual void End() override
+	{
+		++numEnd;
+	}
+
+private:
+
+	void Record(bool isSelect, const CommandCompletion& completion)
+	{
+		if (isSelect)
+		{
+			++numSelect;
+		}
+		else
+		{
+			++numOperate;
+		}
+
+		pending.push_back(completion);
+	}
+};
+
+}
+
+#endif
@@ -164,10 +164,32 @@ public:
 	std::map<uint16_t, Record<SecurityStat>> securityStatSOE;
 	std::vector<DNPTime> timeSOE;
 
+	virtual void BeginResponse(MasterTaskType type, TaskId id) override
+	{
+		++numResponseBegin;
+	}
+
+	virtual void EndResponse(MasterTaskType type, TaskId id, bool success) override
+	{
+		responseResults.push_back(success);
+	}
+
+	uint32_t numStart = 0;
+	uint32_t numEnd = 0;
+	uint32_t numResponseBegin = 0;
+	std::vector<bool> responseResults;
+
 protected:
 
-	void Start() override {}
-	void End() override {}
+	void Start() override
+	{
+		++numStart;
+	}
+
+	void End() override
+	{
+		++numEnd;
+	}
 
 private:
 
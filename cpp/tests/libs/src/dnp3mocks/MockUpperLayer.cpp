@@ -50,6 +50,12 @@ bool MockUpperLayer::OnReceive(const openpal::RSlice& input)
 	return true;
 }
 
+bool MockUpperLayer::OnReceiveBroadcast(const openpal::RSlice& input)
+{
+	++numBroadcastRx;
+	return this->OnReceive(input);
+}
+
 bool MockUpperLayer::OnSendResult(bool isSuccess)
 {
 	if (isSuccess)
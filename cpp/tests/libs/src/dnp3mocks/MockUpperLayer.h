@@ -93,8 +93,12 @@ public:
 		mOnReceiveHandler = arHandler;
 	}
 
+	/// number of APDUs received through OnReceiveBroadcast
+	size_t numBroadcastRx = 0;
+
 	//these are the NVII delegates
 	virtual bool OnReceive(const openpal::RSlice& buffer) override final;
+	virtual bool OnReceiveBroadcast(const openpal::RSlice& buffer) override final;
 	virtual bool OnSendResult(bool isSuccess) override final;
 	virtual bool OnLowerLayerUp() override final;
 	virtual bool OnLowerLayerDown() override final;
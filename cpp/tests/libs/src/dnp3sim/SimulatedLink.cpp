@@ -0,0 +1,119 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "SimulatedLink.h"
+
+#include <memory>
+#include <vector>
+
+using namespace openpal;
+using namespace opendnp3;
+
+namespace dnp3sim
+{
+
+SimulatedLink::SimulatedLink(IExecutor& executor, std::mt19937& random, const LinkParams& params) :
+	executor(&executor),
+	random(&random),
+	master(*this),
+	outstation(*this)
+{
+	master.peer = &outstation;
+	master.params = params;
+	outstation.peer = &master;
+	outstation.params = params;
+}
+
+void SimulatedLink::Bind(IUpperLayer& masterUpper, IUpperLayer& outstationUpper)
+{
+	master.SetUpperLayer(masterUpper);
+	outstation.SetUpperLayer(outstationUpper);
+}
+
+void SimulatedLink::Up()
+{
+	master.pUpperLayer->OnLowerLayerUp();
+	outstation.pUpperLayer->OnLowerLayerUp();
+}
+
+uint32_t SimulatedLink::WireSize(uint32_t size)
+{
+	// each transport segment carries 249 bytes of the fragment behind a 1 byte header
+	const uint32_t MAX_SEGMENT = 249;
+	// each link frame has a 10 byte header and a 2 byte CRC for every 16 bytes of user data
+	const uint32_t HEADER_SIZE = 10;
+
+	uint32_t total = 0;
+	uint32_t remaining = size;
+
+	do
+	{
+		const uint32_t payload = ((remaining > MAX_SEGMENT) ? MAX_SEGMENT : remaining) + 1;
+		total += HEADER_SIZE + payload + 2 * ((payload + 15) / 16);
+		remaining = (remaining > MAX_SEGMENT) ? (remaining - MAX_SEGMENT) : 0;
+	}
+	while (remaining > 0);
+
+	return total;
+}
+
+bool SimulatedLink::Endpoint::BeginTransmit(const RSlice& fragment)
+{
+	link->Transmit(*this, fragment);
+	return true;
+}
+
+void SimulatedLink::Transmit(Endpoint& source, const RSlice& fragment)
+{
+	const auto now = executor->GetTime();
+	const auto wireSize = WireSize(fragment.Size());
+
+	const auto start = (source.busyUntil.milliseconds > now.milliseconds) ? source.busyUntil : now;
+	const int64_t txMs = (source.params.bitsPerSecond > 0) ? ((static_cast<int64_t>(wireSize) * 8 * 1000) / source.params.bitsPerSecond) : 0;
+	const auto sent = MonotonicTimestamp(start.milliseconds + txMs);
+	source.busyUntil = sent;
+
+	++source.statistics.numFragments;
+	source.statistics.numWireBytes += wireSize;
+
+	// the layer above owns the buffer until the send completes, so completion is always reported
+	executor->Start(sent, [&source]()
+	{
+		source.pUpperLayer->OnSendResult(true);
+	});
+
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+	if ((source.params.lossProbability > 0.0) && (uniform(*random) < source.params.lossProbability))
+	{
+		++source.statistics.numLost;
+		return;
+	}
+
+	const uint8_t* bytes = fragment;
+	auto copy = std::make_shared<std::vector<uint8_t>>(bytes, bytes + fragment.Size());
+	auto peer = source.peer;
+
+	executor->Start(sent.Add(source.params.latency), [peer, copy]()
+	{
+		peer->pUpperLayer->OnReceive(RSlice(copy->data(), static_cast<uint32_t>(copy->size())));
+	});
+}
+
+}
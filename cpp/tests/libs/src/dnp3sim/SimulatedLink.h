@@ -0,0 +1,136 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef DNP3SIM_SIMULATEDLINK_H
+#define DNP3SIM_SIMULATEDLINK_H
+
+#include <opendnp3/LayerInterfaces.h>
+
+#include <openpal/executor/IExecutor.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <random>
+
+namespace dnp3sim
+{
+
+/**
+* Characteristics of one direction of a simulated link
+*/
+struct LinkParams
+{
+	/// one-way propagation delay added to every fragment
+	openpal::TimeDuration latency = openpal::TimeDuration::Milliseconds(10);
+
+	/// serialization rate of the link, 0 for unlimited
+	uint32_t bitsPerSecond = 0;
+
+	/// probability in [0, 1] that a fragment is lost in transit
+	double lossProbability = 0.0;
+};
+
+/// counters for one direction of a simulated link
+struct LinkStatistics
+{
+	uint64_t numFragments = 0;
+	uint64_t numLost = 0;
+	uint64_t numWireBytes = 0;
+};
+
+/**
+* Connects two upper layers (an MContext and an OContext) through the executor, in place of the
+* transport, link and physical layers. Each direction serializes fragments one at a time at the
+* configured rate, so large responses delay the ones queued behind them like they would on a channel.
+*
+* Fragments are sized on the wire with DNP3 link and transport framing. Loss is decided by a
+* generator owned by the caller so that a whole topology is reproducible from a single seed.
+*/
+class SimulatedLink final : private openpal::Uncopyable
+{
+	class Endpoint final : public opendnp3::ILowerLayer, public opendnp3::HasUpperLayer
+	{
+		friend class SimulatedLink;
+
+	public:
+
+		Endpoint(SimulatedLink& link) : link(&link)
+		{}
+
+		virtual bool BeginTransmit(const openpal::RSlice& fragment) override;
+
+	private:
+
+		SimulatedLink* link;
+		Endpoint* peer = nullptr;
+		LinkParams params;
+		LinkStatistics statistics;
+		openpal::MonotonicTimestamp busyUntil = openpal::MonotonicTimestamp(0);
+	};
+
+public:
+
+	SimulatedLink(openpal::IExecutor& executor, std::mt19937& random, const LinkParams& params);
+
+	/// the lower layer for the master end of the link
+	opendnp3::ILowerLayer& Master()
+	{
+		return master;
+	}
+
+	/// the lower layer for the outstation end of the link
+	opendnp3::ILowerLayer& Outstation()
+	{
+		return outstation;
+	}
+
+	void Bind(opendnp3::IUpperLayer& masterUpper, opendnp3::IUpperLayer& outstationUpper);
+
+	/// notify both upper layers that the link is up
+	void Up();
+
+	/// fragments sent by the master
+	const LinkStatistics& MasterToOutstation() const
+	{
+		return master.statistics;
+	}
+
+	/// fragments sent by the outstation
+	const LinkStatistics& OutstationToMaster() const
+	{
+		return outstation.statistics;
+	}
+
+	/// number of bytes a fragment of 'size' bytes occupies on the wire with link and transport framing
+	static uint32_t WireSize(uint32_t size);
+
+private:
+
+	void Transmit(Endpoint& source, const openpal::RSlice& fragment);
+
+	openpal::IExecutor* executor;
+	std::mt19937* random;
+
+	Endpoint master;
+	Endpoint outstation;
+};
+
+}
+
+#endif
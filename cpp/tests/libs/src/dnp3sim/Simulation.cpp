@@ -0,0 +1,393 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Simulation.h"
+
+#include <opendnp3/master/MasterContext.h>
+#include <opendnp3/master/ISOEHandler.h>
+#include <opendnp3/master/ITaskCallback.h>
+#include <opendnp3/outstation/OutstationContext.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+
+#include <ctime>
+
+using namespace openpal;
+using namespace opendnp3;
+
+namespace dnp3sim
+{
+
+namespace
+{
+double CpuSeconds()
+{
+	return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+class SimulatedMasterApplication final : public IMasterApplication
+{
+public:
+
+	explicit SimulatedMasterApplication(IExecutor& executor) : executor(&executor)
+	{}
+
+	virtual UTCTimestamp Now() override
+	{
+		return UTCTimestamp(executor->GetTime().milliseconds);
+	}
+
+	virtual bool AssignClassDuringStartup() override
+	{
+		return false;
+	}
+
+private:
+
+	IExecutor* executor;
+};
+}
+
+SimulationConfig::SimulationConfig()
+{
+	master.disableUnsolOnStartup = false;
+	master.startupIntegrityClassMask = ClassField::None();
+	master.unsolClassMask = ClassField::None();
+	master.integrityOnEventOverflowIIN = false;
+
+	outstation.eventBufferConfig = EventBufferConfig::AllTypes(100);
+}
+
+/// counts task completions and the events delivered to every master
+class Simulation::Counters final : public ISOEHandler, public ITaskCallback
+{
+public:
+
+	uint64_t numSuccess = 0;
+	uint64_t numFailure = 0;
+	uint64_t numEvents = 0;
+
+	void Reset()
+	{
+		numSuccess = numFailure = numEvents = 0;
+	}
+
+	void Complete(bool success)
+	{
+		if (success)
+		{
+			++numSuccess;
+		}
+		else
+		{
+			++numFailure;
+		}
+	}
+
+	// ------- ITaskCallback -------
+
+	virtual void OnStart() override {}
+	virtual void OnComplete(TaskCompletion result) override
+	{
+		this->Complete(result == TaskCompletion::SUCCESS);
+	}
+	virtual void OnDestroyed() override {}
+
+	// ------- ISOEHandler -------
+
+	virtual void Start() override {}
+	virtual void End() override {}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override {}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<SecurityStat>>& values) override
+	{
+		Count(info, values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override {}
+
+private:
+
+	template <class T>
+	void Count(const HeaderInfo& info, const ICollection<T>& values)
+	{
+		if (info.isEventVariation)
+		{
+			numEvents += values.Count();
+		}
+	}
+};
+
+/// a master and an outstation connected by a simulated link
+class Simulation::Pair final : private Uncopyable
+{
+public:
+
+	Pair(const SimulationConfig& config, const std::shared_ptr<VirtualTimeExecutor>& executor, std::mt19937& random, const std::shared_ptr<Counters>& counters) :
+		link(std::make_shared<SimulatedLink>(*executor, random, config.link)),
+		master(std::make_shared<MContext>(
+		           Logger::Empty(),
+		           executor,
+		           std::shared_ptr<ILowerLayer>(link, &link->Master()),
+		           counters,
+		           std::make_shared<SimulatedMasterApplication>(*executor),
+		           config.master,
+		           NullTaskLock::Instance())),
+		outstation(std::unique_ptr<OContext>(new OContext(
+		               config.outstation,
+		               config.database,
+		               Logger::Empty(),
+		               executor,
+		               std::shared_ptr<ILowerLayer>(link, &link->Outstation()),
+		               SuccessCommandHandler::Create(),
+		               DefaultOutstationApplication::Create())))
+	{
+		link->Bind(*master, *outstation);
+	}
+
+	const std::shared_ptr<SimulatedLink> link;
+	const std::shared_ptr<MContext> master;
+	const std::unique_ptr<OContext> outstation;
+
+	double analogValue = 0;
+};
+
+Simulation::Simulation(const SimulationConfig& config) :
+	config(config),
+	executor(std::make_shared<VirtualTimeExecutor>()),
+	random(config.seed),
+	counters(std::make_shared<Counters>())
+{
+	pairs.reserve(config.numPairs);
+	for (uint32_t i = 0; i < config.numPairs; ++i)
+	{
+		pairs.push_back(std::unique_ptr<Pair>(new Pair(config, executor, random, counters)));
+	}
+}
+
+Simulation::~Simulation()
+{}
+
+void Simulation::Start()
+{
+	for (auto& pair : pairs)
+	{
+		pair->link->Up();
+	}
+
+	executor->RunFor(config.master.responseTimeout);
+}
+
+const SimulatedLink& Simulation::Link(uint32_t pair) const
+{
+	return *pairs[pair]->link;
+}
+
+WorkloadResult Simulation::RunPolls(const TimeDuration& period, const TimeDuration& duration)
+{
+	auto callback = counters.get();
+
+	Driver poll
+	{
+		[period]()
+		{
+			return period;
+		},
+		[callback](Pair & pair)
+		{
+			pair.master->ScanClasses(ClassField(PointClass::Class0), TaskConfig::With(*callback));
+		}
+	};
+
+	auto result = this->Run(duration, { poll });
+	result.numOperations = counters->numSuccess;
+	return result;
+}
+
+WorkloadResult Simulation::RunEvents(double eventsPerSecond, const TimeDuration& period, const TimeDuration& duration)
+{
+	auto callback = counters.get();
+	auto rand = &random;
+	const auto numAnalogs = config.database.numAnalog;
+
+	Driver poll
+	{
+		[period]()
+		{
+			return period;
+		},
+		[callback](Pair & pair)
+		{
+			pair.master->ScanClasses(ClassField::AllEventClasses(), TaskConfig::With(*callback));
+		}
+	};
+
+	Driver change
+	{
+		[rand, eventsPerSecond]()
+		{
+			std::exponential_distribution<double> arrival(eventsPerSecond);
+			return TimeDuration::Milliseconds(static_cast<int64_t>(arrival(*rand) * 1000.0));
+		},
+		[rand, numAnalogs](Pair & pair)
+		{
+			if (numAnalogs == 0)
+			{
+				return;
+			}
+
+			std::uniform_int_distribution<uint16_t> index(0, numAnalogs - 1);
+			std::normal_distribution<double> step(0.0, 1.0);
+			pair.analogValue += step(*rand);
+
+			pair.outstation->GetUpdateHanlder().Update(Analog(pair.analogValue, 0x01), index(*rand), EventMode::Force);
+			pair.outstation->CheckForTaskStart();
+		}
+	};
+
+	auto result = this->Run(duration, { poll, change });
+	result.numOperations = counters->numEvents;
+	return result;
+}
+
+WorkloadResult Simulation::RunCommands(const TimeDuration& period, const TimeDuration& duration)
+{
+	auto callback = counters.get();
+
+	Driver command
+	{
+		[period]()
+		{
+			return period;
+		},
+		[callback](Pair & pair)
+		{
+			CommandSet commands({ WithIndex(ControlRelayOutputBlock(ControlCode::LATCH_ON), 0) });
+			pair.master->DirectOperate(std::move(commands), [callback](const ICommandTaskResult & result)
+			{
+				callback->Complete(result.summary == TaskCompletion::SUCCESS);
+			}, TaskConfig::Default());
+		}
+	};
+
+	auto result = this->Run(duration, { command });
+	result.numOperations = counters->numSuccess;
+	return result;
+}
+
+WorkloadResult Simulation::Run(const TimeDuration& duration, const std::vector<Driver>& drivers)
+{
+	counters->Reset();
+
+	const auto bytesBefore = this->TotalWireBytes();
+	const auto handlersBefore = executor->NumHandlersRun();
+	const auto end = executor->GetTime().Add(duration);
+
+	for (auto& driver : drivers)
+	{
+		auto shared = std::make_shared<Driver>(driver);
+		for (auto& pair : pairs)
+		{
+			// spread the first activity of each pair over one interval so that the pairs are not synchronized
+			std::uniform_int_distribution<int64_t> phase(0, driver.interval().GetMilliseconds());
+			this->Schedule(*pair, TimeDuration::Milliseconds(phase(random)), end, shared);
+		}
+	}
+
+	const auto start = CpuSeconds();
+
+	executor->RunUntil(end);
+
+	// let the operations started before the end complete or time out
+	executor->RunFor(config.master.responseTimeout);
+
+	WorkloadResult result;
+	result.cpuSeconds = CpuSeconds() - start;
+	result.numFailures = counters->numFailure;
+	result.numHandlers = executor->NumHandlersRun() - handlersBefore;
+	result.numWireBytes = this->TotalWireBytes() - bytesBefore;
+	return result;
+}
+
+void Simulation::Schedule(Pair& pair, const TimeDuration& delay, const MonotonicTimestamp& end, const std::shared_ptr<Driver>& driver)
+{
+	const auto expiration = executor->GetTime().Add(delay);
+	if (expiration.milliseconds >= end.milliseconds)
+	{
+		return;
+	}
+
+	auto pPair = &pair;
+	executor->Start(expiration, [this, pPair, end, driver]()
+	{
+		driver->action(*pPair);
+		this->Schedule(*pPair, driver->interval(), end, driver);
+	});
+}
+
+uint64_t Simulation::TotalWireBytes() const
+{
+	uint64_t total = 0;
+	for (auto& pair : pairs)
+	{
+		total += pair->link->MasterToOutstation().numWireBytes + pair->link->OutstationToMaster().numWireBytes;
+	}
+	return total;
+}
+
+}
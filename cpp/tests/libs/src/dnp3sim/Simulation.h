@@ -0,0 +1,157 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef DNP3SIM_SIMULATION_H
+#define DNP3SIM_SIMULATION_H
+
+#include "VirtualTimeExecutor.h"
+#include "SimulatedLink.h"
+
+#include <opendnp3/master/MasterParams.h>
+#include <opendnp3/outstation/DatabaseSizes.h>
+#include <opendnp3/outstation/OutstationConfig.h>
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace dnp3sim
+{
+
+/**
+* Describes a topology of independent master / outstation pairs
+*/
+struct SimulationConfig
+{
+	/// number of master / outstation pairs
+	uint32_t numPairs = 100;
+
+	/// characteristics of every link
+	LinkParams link;
+
+	/// points in each outstation database
+	opendnp3::DatabaseSizes database = opendnp3::DatabaseSizes::AllTypes(10);
+
+	/// outstation configuration, including the event buffer sizes
+	opendnp3::OutstationConfig outstation;
+
+	/// master configuration. Startup scans are disabled by default so that workloads only measure themselves
+	opendnp3::MasterParams master;
+
+	/// seed for loss, event arrivals and the phase of every periodic driver
+	uint32_t seed = 1;
+
+	SimulationConfig();
+};
+
+/**
+* Result of running a single workload over every pair
+*/
+struct WorkloadResult
+{
+	/// polls, events or commands that completed successfully
+	uint64_t numOperations = 0;
+
+	/// polls or commands that failed, e.g. because of loss
+	uint64_t numFailures = 0;
+
+	/// executor handlers that ran during the workload
+	uint64_t numHandlers = 0;
+
+	/// bytes on the wire in both directions, including link and transport framing
+	uint64_t numWireBytes = 0;
+
+	/// process CPU time spent running the workload
+	double cpuSeconds = 0;
+
+	double CpuMicrosPerOperation() const
+	{
+		return (numOperations > 0) ? (cpuSeconds * 1000000.0 / numOperations) : 0;
+	}
+};
+
+/**
+* Runs many MContext / OContext pairs over simulated links on a single virtual time executor.
+*
+* Nothing depends on wall clock time or thread scheduling, so a given configuration always produces the
+* same traffic. Each workload drives one kind of activity and reports the CPU time spent per operation,
+* which makes it suitable for capacity planning and for CI.
+*/
+class Simulation final : private openpal::Uncopyable
+{
+	class Pair;
+	class Counters;
+
+public:
+
+	explicit Simulation(const SimulationConfig& config);
+	~Simulation();
+
+	/// bring every link up and let the stacks settle
+	void Start();
+
+	/// every master reads class 0 once per period
+	WorkloadResult RunPolls(const openpal::TimeDuration& period, const openpal::TimeDuration& duration);
+
+	/// every outstation changes analogs as a Poisson process and every master reads classes 1, 2 and 3 once per period
+	WorkloadResult RunEvents(double eventsPerSecond, const openpal::TimeDuration& period, const openpal::TimeDuration& duration);
+
+	/// every master sends a direct operate CROB once per period
+	WorkloadResult RunCommands(const openpal::TimeDuration& period, const openpal::TimeDuration& duration);
+
+	VirtualTimeExecutor& Executor()
+	{
+		return *executor;
+	}
+
+	uint32_t NumPairs() const
+	{
+		return static_cast<uint32_t>(pairs.size());
+	}
+
+	/// link statistics of a pair
+	const SimulatedLink& Link(uint32_t pair) const;
+
+private:
+
+	/// an activity repeated on every pair at intervals obtained from 'interval'
+	struct Driver
+	{
+		std::function<openpal::TimeDuration ()> interval;
+		std::function<void (Pair&)> action;
+	};
+
+	WorkloadResult Run(const openpal::TimeDuration& duration, const std::vector<Driver>& drivers);
+
+	void Schedule(Pair& pair, const openpal::TimeDuration& delay, const openpal::MonotonicTimestamp& end, const std::shared_ptr<Driver>& driver);
+
+	uint64_t TotalWireBytes() const;
+
+	const SimulationConfig config;
+	const std::shared_ptr<VirtualTimeExecutor> executor;
+	std::mt19937 random;
+	std::shared_ptr<Counters> counters;
+	std::vector<std::unique_ptr<Pair>> pairs;
+};
+
+}
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "VirtualTimeExecutor.h"
+
+using namespace openpal;
+
+namespace dnp3sim
+{
+
+VirtualTimeExecutor::~VirtualTimeExecutor()
+{
+	for (auto& entry : timers)
+	{
+		delete entry.second;
+	}
+}
+
+MonotonicTimestamp VirtualTimeExecutor::GetTime()
+{
+	return now;
+}
+
+ITimer* VirtualTimeExecutor::Start(const TimeDuration& duration, const action_t& runnable)
+{
+	return this->Start(now.Add(duration), runnable);
+}
+
+ITimer* VirtualTimeExecutor::Start(const MonotonicTimestamp& expiration, const action_t& runnable)
+{
+	auto timer = new VirtualTimer(*this, runnable);
+
+	// timers already in the past expire on the next run, after the ones that are already due
+	const auto time = (expiration.milliseconds < now.milliseconds) ? now.milliseconds : expiration.milliseconds;
+
+	// equal keys are inserted after the existing ones, which keeps timers with the same expiration in FIFO order
+	timer->position = timers.insert(TimerMap::value_type(time, timer));
+	return timer;
+}
+
+void VirtualTimeExecutor::Post(const action_t& runnable)
+{
+	posted.push_back(runnable);
+}
+
+uint64_t VirtualTimeExecutor::RunPosted()
+{
+	uint64_t count = 0;
+	while (!posted.empty())
+	{
+		auto runnable = std::move(posted.front());
+		posted.pop_front();
+		runnable();
+		++count;
+	}
+	numHandlersRun += count;
+	return count;
+}
+
+uint64_t VirtualTimeExecutor::RunUntil(const MonotonicTimestamp& time)
+{
+	uint64_t count = this->RunPosted();
+
+	while (!timers.empty() && (timers.begin()->first <= time.milliseconds))
+	{
+		auto first = timers.begin();
+		auto timer = first->second;
+		now = MonotonicTimestamp(first->first);
+		timers.erase(first);
+
+		auto runnable = std::move(timer->runnable);
+		delete timer;
+
+		runnable();
+		++count;
+		++numHandlersRun;
+
+		count += this->RunPosted();
+	}
+
+	if (time.milliseconds > now.milliseconds)
+	{
+		now = time;
+	}
+
+	return count;
+}
+
+uint64_t VirtualTimeExecutor::RunFor(const TimeDuration& duration)
+{
+	return this->RunUntil(now.Add(duration));
+}
+
+void VirtualTimeExecutor::Cancel(VirtualTimer* timer)
+{
+	timers.erase(timer->position);
+	delete timer;
+}
+
+void VirtualTimer::Cancel()
+{
+	executor->Cancel(this);
+}
+
+MonotonicTimestamp VirtualTimer::ExpiresAt()
+{
+	return MonotonicTimestamp(position->first);
+}
+
+}
@@ -0,0 +1,112 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef DNP3SIM_VIRTUALTIMEEXECUTOR_H
+#define DNP3SIM_VIRTUALTIMEEXECUTOR_H
+
+#include <openpal/executor/IExecutor.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <cstddef>
+#include <deque>
+#include <map>
+
+namespace dnp3sim
+{
+
+class VirtualTimer;
+
+/**
+* Single-threaded executor whose clock only moves when it is told to. Timers are kept ordered by
+* expiration, and timers that expire at the same time run in the order they were started, so a run
+* with the same inputs always executes the same handlers in the same order.
+*
+* Unlike testlib::MockExecutor, starting, canceling and expiring a timer is O(log n) so that
+* thousands of stacks can share one executor.
+*/
+class VirtualTimeExecutor final : public openpal::IExecutor, private openpal::Uncopyable
+{
+	friend class VirtualTimer;
+
+public:
+
+	VirtualTimeExecutor() = default;
+	~VirtualTimeExecutor();
+
+	virtual openpal::MonotonicTimestamp GetTime() override;
+	virtual openpal::ITimer* Start(const openpal::TimeDuration& duration, const openpal::action_t& runnable) override;
+	virtual openpal::ITimer* Start(const openpal::MonotonicTimestamp& expiration, const openpal::action_t& runnable) override;
+	virtual void Post(const openpal::action_t& runnable) override;
+
+	/// Run every posted handler and every timer that expires up to and including 'time', then set the clock to 'time'
+	/// @return the number of handlers that ran
+	uint64_t RunUntil(const openpal::MonotonicTimestamp& time);
+
+	/// Advance the clock by 'duration', running everything that becomes due
+	uint64_t RunFor(const openpal::TimeDuration& duration);
+
+	/// Run posted handlers without advancing the clock
+	uint64_t RunPosted();
+
+	/// total number of handlers run since construction
+	uint64_t NumHandlersRun() const
+	{
+		return numHandlersRun;
+	}
+
+	size_t NumPendingTimers() const
+	{
+		return timers.size();
+	}
+
+private:
+
+	typedef std::multimap<int64_t, VirtualTimer*> TimerMap;
+
+	void Cancel(VirtualTimer* timer);
+
+	openpal::MonotonicTimestamp now = openpal::MonotonicTimestamp(0);
+	uint64_t numHandlersRun = 0;
+	std::deque<openpal::action_t> posted;
+	TimerMap timers;
+};
+
+class VirtualTimer final : public openpal::ITimer
+{
+	friend class VirtualTimeExecutor;
+
+public:
+
+	virtual void Cancel() override;
+	virtual openpal::MonotonicTimestamp ExpiresAt() override;
+
+private:
+
+	VirtualTimer(VirtualTimeExecutor& executor, const openpal::action_t& runnable) : executor(&executor), runnable(runnable)
+	{}
+
+	VirtualTimeExecutor* executor;
+	openpal::action_t runnable;
+	VirtualTimeExecutor::TimerMap::iterator position;
+};
+
+}
+
+#endif
@@ -0,0 +1,224 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <opendnp3/app/BitPacking.h>
+#include <opendnp3/app/BitfieldRangeWriteIterator.h>
+#include <opendnp3/app/parsing/BitReader.h>
+#include <opendnp3/app/parsing/BitfieldCollection.h>
+#include <opendnp3/app/MeasurementTypes.h>
+
+#include <openpal/container/Buffer.h>
+#include <openpal/serialization/Serialization.h>
+
+#include <vector>
+
+using namespace std;
+using namespace openpal;
+using namespace opendnp3;
+
+#define SUITE(name) "BitPackingTestSuite - " name
+
+namespace
+{
+vector<uint8_t> Pattern(uint32_t count)
+{
+	vector<uint8_t> values(count);
+	uint32_t seed = 0x12345678;
+	for (auto& value : values)
+	{
+		seed = seed * 1103515245 + 12345;
+		value = (seed >> 16) & 0x01;
+	}
+	return values;
+}
+}
+
+TEST_CASE(SUITE("PacksAndUnpacksEveryByte"))
+{
+	for (uint32_t byte = 0; byte < 256; ++byte)
+	{
+		uint8_t values[8];
+		UnpackBitsFromByte(static_cast<uint8_t>(byte), values);
+
+		for (uint32_t bit = 0; bit < 8; ++bit)
+		{
+			REQUIRE(values[bit] == ((byte >> bit) & 0x01));
+		}
+
+		REQUIRE(PackBitsInByte(values) == byte);
+	}
+}
+
+TEST_CASE(SUITE("UnpackMatchesBitReaderAtAnyOffset"))
+{
+	const auto values = Pattern(200);
+	Buffer packed(NumBytesInBits(200));
+	PackBits(values.data(), 200, packed());
+	const RSlice buffer = packed.ToRSlice();
+
+	for (uint32_t position = 0; position < 16; ++position)
+	{
+		const uint32_t count = 200 - position - (position % 5);
+		vector<uint8_t> unpacked(count);
+		UnpackBits(buffer, position, count, unpacked.data());
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			REQUIRE(unpacked[i] == (GetBit(buffer, position + i) ? 1 : 0));
+			REQUIRE(unpacked[i] == values[position + i]);
+		}
+	}
+}
+
+TEST_CASE(SUITE("DoubleBitUnpackMatchesBitReaderAtAnyOffset"))
+{
+	Buffer packed(25);
+	for (uint32_t i = 0; i < packed.Size(); ++i)
+	{
+		packed()[i] = static_cast<uint8_t>(i * 37 + 11);
+	}
+	const RSlice buffer = packed.ToRSlice();
+
+	for (uint32_t position = 0; position < 8; ++position)
+	{
+		const uint32_t count = 100 - position - (position % 3);
+		vector<uint8_t> unpacked(count);
+		UnpackDoubleBits(buffer, position, count, unpacked.data());
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			REQUIRE(DoubleBitFromType(unpacked[i]) == GetDoubleBit(buffer, position + i));
+		}
+	}
+}
+
+TEST_CASE(SUITE("BlockWriteMatchesSingleBitWrites"))
+{
+	const auto values = Pattern(100);
+
+	Buffer single(20);
+	Buffer block(20);
+
+	{
+		auto dest = single.GetWSlice();
+		BitfieldRangeWriteIterator<UInt8> iter(3, dest);
+		for (auto value : values)
+		{
+			REQUIRE(iter.Write(value != 0));
+		}
+	}
+
+	{
+		auto dest = block.GetWSlice();
+		BitfieldRangeWriteIterator<UInt8> iter(3, dest);
+		// an unaligned first block exercises the per-bit head and tail
+		REQUIRE(iter.Write(values.data(), 5) == 5);
+		REQUIRE(iter.Write(values.data() + 5, 95) == 95);
+	}
+
+	REQUIRE(single.ToRSlice().Equals(block.ToRSlice()));
+}
+
+TEST_CASE(SUITE("BlockWriteStopsWhenBufferIsFull"))
+{
+	const auto values = Pattern(40);
+	Buffer buffer(4); // start/stop + 2 bytes of bits
+
+	auto dest = buffer.GetWSlice();
+	{
+		BitfieldRangeWriteIterator<UInt8> iter(0, dest);
+		REQUIRE(iter.Write(values.data(), 40) == 16);
+		REQUIRE_FALSE(iter.Write(true));
+	}
+
+	REQUIRE(buffer()[1] == 15);
+	REQUIRE(dest.Size() == 0);
+}
+
+TEST_CASE(SUITE("CollectionVisitsEveryValueWithItsIndex"))
+{
+	const auto values = Pattern(150);
+	Buffer packed(NumBytesInBits(150));
+	PackBits(values.data(), 150, packed());
+
+	auto convert = [](uint8_t value)
+	{
+		return Binary(value != 0);
+	};
+	auto collection = CreateBitfieldCollection<Binary>(packed.ToRSlice(), 10, 150, convert);
+
+	uint32_t count = 0;
+	collection.ForeachItem([&](const Indexed<Binary>& item)
+	{
+		REQUIRE(item.index == 10 + count);
+		REQUIRE(item.value.value == (values[count] != 0));
+		++count;
+	});
+
+	REQUIRE(count == 150);
+}
+
+TEST_CASE(SUITE("FullRangeRoundTripsThroughBlockPackAndUnpack"))
+{
+	const uint32_t NUM_VALUES = 65535;
+	const auto values = Pattern(NUM_VALUES);
+
+	Buffer single(NumBytesInBits(NUM_VALUES) + 4);
+	Buffer block(NumBytesInBits(NUM_VALUES) + 4);
+
+	{
+		auto dest = single.GetWSlice();
+		BitfieldRangeWriteIterator<UInt16> iter(0, dest);
+		uint32_t numWritten = 0;
+		for (auto value : values)
+		{
+			numWritten += iter.Write(value != 0) ? 1 : 0;
+		}
+		REQUIRE(numWritten == NUM_VALUES);
+	}
+
+	{
+		auto dest = block.GetWSlice();
+		BitfieldRangeWriteIterator<UInt16> iter(0, dest);
+		REQUIRE(iter.Write(values.data(), NUM_VALUES) == NUM_VALUES);
+	}
+
+	REQUIRE(single.ToRSlice().Equals(block.ToRSlice()));
+
+	const RSlice packed = block.ToRSlice().Skip(4);
+	uint8_t batch[64];
+	uint32_t numMismatched = 0;
+	for (uint32_t pos = 0; pos < NUM_VALUES; pos += 64)
+	{
+		const uint32_t num = ((NUM_VALUES - pos) < 64) ? (NUM_VALUES - pos) : 64;
+		UnpackBits(packed, pos, num, batch);
+		for (uint32_t j = 0; j < num; ++j)
+		{
+			if (batch[j] != values[pos + j] || GetBit(packed, pos + j) != (values[pos + j] != 0))
+			{
+				++numMismatched;
+			}
+		}
+	}
+
+	REQUIRE(numMismatched == 0);
+}
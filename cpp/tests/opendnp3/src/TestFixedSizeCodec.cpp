@@ -0,0 +1,264 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <opendnp3/app/FixedSizeCodec.h>
+#include <opendnp3/app/RangeWriteIterator.h>
+
+#include <openpal/container/Buffer.h>
+
+#include <limits>
+#include <vector>
+
+using namespace std;
+using namespace openpal;
+using namespace opendnp3;
+
+#define SUITE(name) "FixedSizeCodecTestSuite - " name
+
+namespace
+{
+// produce a spread of values including ones that overflow the smaller wire types
+double AnalogValue(uint32_t i)
+{
+	const double values[] = { 0.0, -1.5, 32767.0, 32768.0, -32769.0, 2147483648.0, -1.0e10, 3.4e39, 12345.678, -0.25 };
+	return values[i % 10] + i;
+}
+
+Flags FlagsValue(uint32_t i)
+{
+	return Flags(static_cast<uint8_t>((i * 37) & 0xDF));
+}
+
+DNPTime TimeValue(uint32_t i)
+{
+	return DNPTime(1514764800000ULL + i * 1001ULL);
+}
+
+void Make(uint32_t i, Binary& out)
+{
+	out = Binary((i % 3) == 0, FlagsValue(i), TimeValue(i));
+}
+void Make(uint32_t i, DoubleBitBinary& out)
+{
+	out = DoubleBitBinary(DoubleBitFromType(i % 4), FlagsValue(i), TimeValue(i));
+}
+void Make(uint32_t i, BinaryOutputStatus& out)
+{
+	out = BinaryOutputStatus((i % 2) == 0, FlagsValue(i), TimeValue(i));
+}
+void Make(uint32_t i, Counter& out)
+{
+	out = Counter(i * 2654435761u, FlagsValue(i), TimeValue(i));
+}
+void Make(uint32_t i, FrozenCounter& out)
+{
+	out = FrozenCounter(i * 2654435761u, FlagsValue(i), TimeValue(i));
+}
+void Make(uint32_t i, Analog& out)
+{
+	out = Analog(AnalogValue(i), FlagsValue(i), TimeValue(i));
+}
+void Make(uint32_t i, AnalogOutputStatus& out)
+{
+	out = AnalogOutputStatus(AnalogValue(i), FlagsValue(i), TimeValue(i));
+}
+
+template <class GV>
+vector<typename GV::Target> MakeValues(uint32_t count)
+{
+	vector<typename GV::Target> values(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		Make(i, values[i]);
+	}
+	return values;
+}
+
+// the codec must produce and consume exactly the same bytes as the generated serializer
+template <class GV>
+void TestMatchesGeneratedSerializer()
+{
+	typedef FixedSizeCodec<GV> Codec;
+
+	REQUIRE(Codec::Size() == GV::Size());
+	REQUIRE(Codec::ID().group == GV::ID().group);
+	REQUIRE(Codec::ID().variation == GV::ID().variation);
+
+	for (auto& value : MakeValues<GV>(100))
+	{
+		Buffer expected(GV::Size());
+		Buffer actual(GV::Size());
+
+		auto dest = expected.GetWSlice();
+		REQUIRE(GV::WriteTarget(value, dest));
+		Codec::Encode(value, actual());
+		REQUIRE(expected.ToRSlice().Equals(actual.ToRSlice()));
+
+		typename GV::Target fromGenerated;
+		typename GV::Target fromCodec;
+		auto input1 = expected.ToRSlice();
+		auto input2 = expected.ToRSlice();
+		REQUIRE(GV::ReadTarget(input1, fromGenerated));
+		REQUIRE(Codec::Read(input2, fromCodec));
+		REQUIRE(input2.IsEmpty());
+
+		Buffer reencoded1(GV::Size());
+		Buffer reencoded2(GV::Size());
+		auto out1 = reencoded1.GetWSlice();
+		auto out2 = reencoded2.GetWSlice();
+		GV::WriteTarget(fromGenerated, out1);
+		GV::WriteTarget(fromCodec, out2);
+		REQUIRE(reencoded1.ToRSlice().Equals(reencoded2.ToRSlice()));
+	}
+}
+
+// a range written through FixedSizeCodec is identical to one written through the serializer function pointer
+template <class GV>
+void TestRangeWriteMatchesSerializer()
+{
+	const uint32_t NUM_VALUES = 256;
+
+	const auto values = MakeValues<GV>(NUM_VALUES);
+	Buffer buffer(NUM_VALUES * GV::Size() + 4);
+	Buffer buffer2(NUM_VALUES * GV::Size() + 4);
+
+	{
+		auto dest = buffer.GetWSlice();
+		RangeWriteIterator<UInt16, typename GV::Target> iter(0, GV::Inst(), dest);
+		for (auto& value : values)
+		{
+			REQUIRE(iter.Write(value));
+		}
+	}
+
+	{
+		auto dest = buffer2.GetWSlice();
+		RangeWriteIterator<UInt16, typename GV::Target, FixedSizeCodec<GV>> iter(0, FixedSizeCodec<GV>(), dest);
+		REQUIRE(iter.Write(NUM_VALUES, [&values](uint32_t j) -> const typename GV::Target&
+		{
+			return values[j];
+		}) == NUM_VALUES);
+	}
+
+	REQUIRE(buffer.ToRSlice().Equals(buffer2.ToRSlice()));
+}
+}
+
+TEST_CASE(SUITE("BinaryCodecsMatchGeneratedSerializers"))
+{
+	TestMatchesGeneratedSerializer<Group1Var2>();
+	TestMatchesGeneratedSerializer<Group2Var1>();
+	TestMatchesGeneratedSerializer<Group2Var2>();
+	TestMatchesGeneratedSerializer<Group3Var2>();
+	TestMatchesGeneratedSerializer<Group4Var1>();
+	TestMatchesGeneratedSerializer<Group4Var2>();
+	TestMatchesGeneratedSerializer<Group10Var2>();
+	TestMatchesGeneratedSerializer<Group11Var1>();
+	TestMatchesGeneratedSerializer<Group11Var2>();
+}
+
+TEST_CASE(SUITE("CounterCodecsMatchGeneratedSerializers"))
+{
+	TestMatchesGeneratedSerializer<Group20Var1>();
+	TestMatchesGeneratedSerializer<Group20Var2>();
+	TestMatchesGeneratedSerializer<Group20Var5>();
+	TestMatchesGeneratedSerializer<Group20Var6>();
+	TestMatchesGeneratedSerializer<Group21Var1>();
+	TestMatchesGeneratedSerializer<Group21Var5>();
+	TestMatchesGeneratedSerializer<Group22Var1>();
+	TestMatchesGeneratedSerializer<Group22Var2>();
+	TestMatchesGeneratedSerializer<Group22Var5>();
+	TestMatchesGeneratedSerializer<Group22Var6>();
+}
+
+TEST_CASE(SUITE("AnalogCodecsMatchGeneratedSerializers"))
+{
+	TestMatchesGeneratedSerializer<Group30Var1>();
+	TestMatchesGeneratedSerializer<Group30Var2>();
+	TestMatchesGeneratedSerializer<Group30Var3>();
+	TestMatchesGeneratedSerializer<Group30Var4>();
+	TestMatchesGeneratedSerializer<Group30Var5>();
+	TestMatchesGeneratedSerializer<Group30Var6>();
+	TestMatchesGeneratedSerializer<Group32Var1>();
+	TestMatchesGeneratedSerializer<Group32Var2>();
+	TestMatchesGeneratedSerializer<Group32Var3>();
+	TestMatchesGeneratedSerializer<Group32Var4>();
+	TestMatchesGeneratedSerializer<Group32Var5>();
+	TestMatchesGeneratedSerializer<Group32Var6>();
+	TestMatchesGeneratedSerializer<Group32Var7>();
+	TestMatchesGeneratedSerializer<Group32Var8>();
+}
+
+TEST_CASE(SUITE("AnalogOutputStatusCodecsMatchGeneratedSerializers"))
+{
+	TestMatchesGeneratedSerializer<Group40Var1>();
+	TestMatchesGeneratedSerializer<Group40Var2>();
+	TestMatchesGeneratedSerializer<Group40Var3>();
+	TestMatchesGeneratedSerializer<Group40Var4>();
+	TestMatchesGeneratedSerializer<Group42Var1>();
+	TestMatchesGeneratedSerializer<Group42Var2>();
+	TestMatchesGeneratedSerializer<Group42Var3>();
+	TestMatchesGeneratedSerializer<Group42Var4>();
+	TestMatchesGeneratedSerializer<Group42Var5>();
+	TestMatchesGeneratedSerializer<Group42Var6>();
+	TestMatchesGeneratedSerializer<Group42Var7>();
+	TestMatchesGeneratedSerializer<Group42Var8>();
+}
+
+TEST_CASE(SUITE("BulkWriteStopsAtTheEndOfTheBuffer"))
+{
+	const auto values = MakeValues<Group30Var1>(10);
+	Buffer buffer(4 + 3 * Group30Var1::Size() + 2);
+
+	auto dest = buffer.GetWSlice();
+	RangeWriteIterator<UInt16, Analog, FixedSizeCodec<Group30Var1>> iter(0, FixedSizeCodec<Group30Var1>(), dest);
+	REQUIRE(iter.Write(10, [&values](uint32_t i) -> const Analog&
+	{
+		return values[i];
+	}) == 3);
+	REQUIRE(dest.Size() == 2);
+	REQUIRE_FALSE(iter.Write(values[3]));
+}
+
+TEST_CASE(SUITE("RangeWritesMatchSerializers"))
+{
+	TestRangeWriteMatchesSerializer<Group1Var2>();
+	TestRangeWriteMatchesSerializer<Group2Var2>();
+	TestRangeWriteMatchesSerializer<Group3Var2>();
+	TestRangeWriteMatchesSerializer<Group4Var2>();
+	TestRangeWriteMatchesSerializer<Group10Var2>();
+	TestRangeWriteMatchesSerializer<Group11Var2>();
+	TestRangeWriteMatchesSerializer<Group20Var1>();
+	TestRangeWriteMatchesSerializer<Group20Var2>();
+	TestRangeWriteMatchesSerializer<Group20Var5>();
+	TestRangeWriteMatchesSerializer<Group21Var1>();
+	TestRangeWriteMatchesSerializer<Group22Var1>();
+	TestRangeWriteMatchesSerializer<Group22Var5>();
+	TestRangeWriteMatchesSerializer<Group30Var1>();
+	TestRangeWriteMatchesSerializer<Group30Var2>();
+	TestRangeWriteMatchesSerializer<Group30Var5>();
+	TestRangeWriteMatchesSerializer<Group32Var1>();
+	TestRangeWriteMatchesSerializer<Group32Var3>();
+	TestRangeWriteMatchesSerializer<Group32Var7>();
+	TestRangeWriteMatchesSerializer<Group40Var1>();
+	TestRangeWriteMatchesSerializer<Group42Var3>();
+}
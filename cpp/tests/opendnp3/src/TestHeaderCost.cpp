@@ -0,0 +1,137 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "mocks/OutstationTestObject.h"
+
+#include <opendnp3/app/HeaderCost.h>
+
+#include <functional>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "HeaderCostTestSuite - " name
+
+namespace
+{
+// number of bytes in the first fragment of a class 0 read of analogs assigned to the given virtual indices
+uint32_t Class0ResponseSize(const std::vector<uint16_t>& indices, bool optimizeQualifiers)
+{
+	OutstationConfig config;
+	config.params.indexMode = IndexMode::Discontiguous;
+	config.params.optimizeQualifiers = optimizeQualifiers;
+	OutstationTestObject t(config, DatabaseSizes::AnalogOnly(static_cast<uint16_t>(indices.size())));
+
+	{
+		auto view = t.context.GetConfigView();
+		for (uint16_t i = 0; i < indices.size(); ++i)
+		{
+			view.analogs[i].config.vIndex = indices[i];
+		}
+	}
+
+	t.LowerLayerUp();
+	t.SendToOutstation("C0 01 3C 01 06");
+	const auto hex = t.lower->PopWriteAsHex();
+	return static_cast<uint32_t>((hex.size() + 1) / 3);
+}
+
+std::vector<uint16_t> Indices(uint32_t count, const std::function<uint16_t(uint32_t)>& indexOf)
+{
+	std::vector<uint16_t> indices;
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		indices.push_back(indexOf(i));
+	}
+	return indices;
+}
+
+void RequireBytesPerResponse(const std::vector<uint16_t>& indices, uint32_t expectedBaseline, uint32_t expectedOptimized)
+{
+	REQUIRE(Class0ResponseSize(indices, false) == expectedBaseline);
+	REQUIRE(Class0ResponseSize(indices, true) == expectedOptimized);
+}
+}
+
+TEST_CASE(SUITE("HeaderSizes"))
+{
+	// g30v1 is 5 bytes
+	REQUIRE(HeaderCost::StartStop(1, 4, 5) == 25);
+	REQUIRE(HeaderCost::StartStop(2, 4, 5) == 27);
+	REQUIRE(HeaderCost::CountWithPrefix(1, 4, 5) == 28);
+	REQUIRE(HeaderCost::CountWithPrefix(2, 4, 5) == 33);
+}
+
+TEST_CASE(SUITE("SmallestIndexSizes"))
+{
+	REQUIRE(HeaderCost::StartStopIndexSize(0, 255) == 1);
+	REQUIRE(HeaderCost::StartStopIndexSize(0, 256) == 2);
+	REQUIRE(HeaderCost::PrefixSize(255, 255) == 1);
+	REQUIRE(HeaderCost::PrefixSize(256, 10) == 2);
+	REQUIRE(HeaderCost::PrefixSize(2, 256) == 2);
+}
+
+TEST_CASE(SUITE("BytesPerResponseForPointDistributions"))
+{
+	// contiguous points already use a single start/stop header
+	RequireBytesPerResponse(Indices(100, [](uint32_t i)
+	{
+		return static_cast<uint16_t>(i);
+	}), 509, 509);
+
+	RequireBytesPerResponse(Indices(60, [](uint32_t i)
+	{
+		return static_cast<uint16_t>(4 * i);
+	}), 604, 368);
+
+	RequireBytesPerResponse(Indices(60, [](uint32_t i)
+	{
+		return static_cast<uint16_t>(1000 + 20 * i);
+	}), 724, 429);
+
+	RequireBytesPerResponse(Indices(60, [](uint32_t i)
+	{
+		return static_cast<uint16_t>(50 * (i / 3) + (i % 3));
+	}), 444, 424);
+
+	RequireBytesPerResponse(Indices(60, [](uint32_t i)
+	{
+		return static_cast<uint16_t>(50 * (i / 10) + (i % 10));
+	}), 346, 346);
+}
+
+TEST_CASE(SUITE("OptimizedQualifiersNeverIncreaseResponseSize"))
+{
+	// the distribution is implementation defined, so only the relative size is checked
+	std::mt19937 gen(42);
+	std::uniform_int_distribution<uint16_t> dist(0, 2000);
+	std::set<uint16_t> random;
+	while (random.size() < 60)
+	{
+		random.insert(dist(gen));
+	}
+
+	const std::vector<uint16_t> indices(random.begin(), random.end());
+	REQUIRE(Class0ResponseSize(indices, true) <= Class0ResponseSize(indices, false));
+}
@@ -102,6 +102,33 @@ TEST_CASE(SUITE("UnconfirmedDataPassedUpFromIdleUnreset"))
 	REQUIRE(t.upper->receivedQueue.front() == bs.ToHex());
 }
 
+TEST_CASE(SUITE("BroadcastPassedUpByOutstation"))
+{
+	LinkLayerTest t(LinkConfig(false, false)); t.link.OnLowerLayerUp();
+	ByteStr bs(250, 0);
+	t.OnFrame(LinkFunction::PRI_UNCONFIRMED_USER_DATA, true, false, false, 0xFFFD, 1, bs.ToRSlice());
+	REQUIRE(t.upper->receivedQueue.empty());
+	REQUIRE(t.upper->broadcastQueue.front() == bs.ToHex());
+}
+
+TEST_CASE(SUITE("ConfirmedBroadcastIsNotAcknowledged"))
+{
+	LinkLayerTest t(LinkConfig(false, false)); t.link.OnLowerLayerUp();
+	ByteStr bs(250, 0);
+	t.OnFrame(LinkFunction::PRI_CONFIRMED_USER_DATA, true, false, false, 0xFFFF, 1, bs.ToRSlice());
+	REQUIRE(t.upper->broadcastQueue.empty());
+	REQUIRE(t.NumTotalWrites() == 0);
+}
+
+TEST_CASE(SUITE("BroadcastIgnoredByMaster"))
+{
+	LinkLayerTest t; t.link.OnLowerLayerUp();
+	ByteStr bs(250, 0);
+	t.OnFrame(LinkFunction::PRI_UNCONFIRMED_USER_DATA, false, false, false, 0xFFFD, 1024, bs.ToRSlice());
+	REQUIRE(t.upper->broadcastQueue.empty());
+	REQUIRE(t.link.GetStatistics().numUnknownDestination == 1);
+}
+
 // Show that the base state of idle forwards unconfirmed user data
 TEST_CASE(SUITE("ConfirmedDataIgnoredFromIdleUnreset"))
 {
@@ -500,3 +527,93 @@ TEST_CASE(SUITE("SendDataSuccess"))
 	REQUIRE(t.PopLastWriteAsHex() == LinkHex::ConfirmedUserData(true, false, 1024, 1, IncrementHex(0x00, 250)));
 }
 
+
+TEST_CASE(SUITE("AdaptiveTimeoutFollowsMeasuredRoundTrip"))
+{
+	LinkConfig cfg = LinkLayerTest::DefaultConfig();
+	cfg.UseConfirms = true;
+	cfg.AdaptiveTimeout = true;
+	cfg.MinTimeout = TimeDuration::Milliseconds(50);
+
+	LinkLayerTest t(cfg);
+	t.link.OnLowerLayerUp();
+	REQUIRE(t.link.GetStatistics().responseTimeoutMs == 1000);
+
+	BufferSegment segments(250, IncrementHex(0, 250));
+	t.link.Send(segments);
+	t.link.OnTransmitResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(40));
+	t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024); // ACK the reset links after 40ms
+
+	REQUIRE(t.link.GetStatistics().smoothedRttMs == 40);
+	REQUIRE(t.link.GetStatistics().rttVarianceMs == 20);
+	REQUIRE(t.link.GetStatistics().responseTimeoutMs == 120);
+
+	// the confirmed data now times out long before the configured 1 second
+	t.link.OnTransmitResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(120));
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.upper->CountersEqual(0, 1));
+
+	// and the next timeout is backed off
+	REQUIRE(t.link.GetStatistics().responseTimeoutMs == 240);
+}
+
+TEST_CASE(SUITE("AdaptiveTimeoutIsResetWhenTheLayerCloses"))
+{
+	LinkConfig cfg = LinkLayerTest::DefaultConfig();
+	cfg.UseConfirms = true;
+	cfg.AdaptiveTimeout = true;
+	cfg.MinTimeout = TimeDuration::Milliseconds(50);
+
+	LinkLayerTest t(cfg);
+	t.link.OnLowerLayerUp();
+
+	BufferSegment segments(250, IncrementHex(0, 250));
+	t.link.Send(segments);
+	t.link.OnTransmitResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(40));
+	t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+	REQUIRE(t.link.GetStatistics().responseTimeoutMs == 120);
+
+	t.link.OnLowerLayerDown();
+	REQUIRE(t.link.GetStatistics().smoothedRttMs == 0);
+	REQUIRE(t.link.GetStatistics().responseTimeoutMs == 1000);
+
+	// the first request of the next session uses the configured timeout again
+	t.link.OnLowerLayerUp();
+	t.link.Send(segments);
+	t.link.OnTransmitResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(999));
+	REQUIRE(t.exe->RunMany() == 0);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(1));
+	REQUIRE(t.exe->RunMany() > 0);
+}
+
+TEST_CASE(SUITE("RetransmittedFramesAreNotSampled"))
+{
+	LinkConfig cfg = LinkLayerTest::DefaultConfig();
+	cfg.NumRetry = 1;
+	cfg.UseConfirms = true;
+	cfg.AdaptiveTimeout = true;
+
+	LinkLayerTest t(cfg);
+	t.link.OnLowerLayerUp();
+
+	BufferSegment segments(250, IncrementHex(0, 250));
+	t.link.Send(segments);
+	t.link.OnTransmitResult(true);
+	t.exe->AdvanceTime(cfg.Timeout);
+	REQUIRE(t.exe->RunMany() > 0); // timeout the reset links, it's retransmitted
+	REQUIRE(t.NumTotalWrites() == 2);
+	t.link.OnTransmitResult(true);
+
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(30));
+	t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+	REQUIRE(t.link.GetStatistics().smoothedRttMs == 0); // ambiguous, could be the ACK of the first transmission
+
+	t.link.OnTransmitResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(30));
+	t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+	REQUIRE(t.link.GetStatistics().smoothedRttMs == 30);
+}
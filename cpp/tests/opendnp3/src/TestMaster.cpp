@@ -77,6 +77,120 @@ TEST_CASE(SUITE("SolicitedResponseWithData"))
 	REQUIRE((Binary(true, 0x01) == t.meas->binarySOE[2].meas));
 }
 
+TEST_CASE(SUITE("SolicitedResponseWithDataIsCached"))
+{
+	MasterParams params;
+	params.disableUnsolOnStartup = false;
+	params.unsolClassMask = 0;
+	params.cacheSizes = DatabaseSizes::BinaryOnly(3);
+	MasterTestObject t(params);
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.SendToMaster("C0 81 00 00 01 02 00 02 02 81");
+	REQUIRE(t.meas->TotalReceived() == 1);
+
+	CachedValue<Binary> value;
+	REQUIRE(t.context->cache->Read(2, value));
+	REQUIRE((Binary(true, 0x01) == value.value));
+	REQUIRE(t.context->cache->GetSequence() == 1);
+}
+
+TEST_CASE(SUITE("UnchangedStaticValuesAreFiltered"))
+{
+	MasterParams params = NoStartupTasks();
+	params.filterUnchangedStatic = true;
+	MasterTestObject t(params);
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+
+	auto scan = t.context->AddClassScan(~0, TimeDuration::Seconds(10));
+
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.SendToMaster("C0 81 00 00 01 02 00 01 02 81 81"); // g1v2, indices 1-2, both online/true
+	REQUIRE(t.meas->TotalReceived() == 2);
+
+	t.meas->Clear();
+	t.exe->AdvanceTime(TimeDuration::Seconds(10));
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(1));
+	t.context->OnSendResult(true);
+	t.SendToMaster("C1 81 00 00 01 02 00 01 02 81 01"); // index 2 is now false
+
+	REQUIRE(t.meas->TotalReceived() == 1);
+	REQUIRE((Binary(false, 0x01) == t.meas->binarySOE[2].meas));
+
+	auto stats = t.context->GetStatistics();
+	REQUIRE(stats.numStaticForwarded == 3);
+	REQUIRE(stats.numStaticSuppressed == 1);
+}
+
+TEST_CASE(SUITE("EventsRefreshTheStaticFilter"))
+{
+	MasterParams params = NoStartupTasks();
+	params.filterUnchangedStatic = true;
+	MasterTestObject t(params);
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+
+	auto scan = t.context->AddClassScan(~0, TimeDuration::Seconds(10));
+
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.SendToMaster("C0 81 00 00 02 01 17 01 02 81 01 02 00 02 02 81"); // g2v1 event then g1v2 static for index 2
+	REQUIRE(t.meas->TotalReceived() == 1);
+	REQUIRE(t.context->GetStatistics().numStaticSuppressed == 1);
+}
+
+TEST_CASE(SUITE("StaticFilterIsResetWhenTheLayerCloses"))
+{
+	MasterParams params = NoStartupTasks();
+	params.startupIntegrityClassMask = ClassField::AllClasses();
+	params.filterUnchangedStatic = true;
+	MasterTestObject t(params);
+
+	for (uint32_t i = 0; i < 2; ++i)
+	{
+		t.meas->Clear();
+		t.context->OnLowerLayerUp();
+		REQUIRE(t.exe->RunMany() > 0);
+		REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+		t.context->OnSendResult(true);
+		t.SendToMaster("C0 81 00 00 01 02 00 02 02 81");
+		REQUIRE(t.meas->TotalReceived() == 1);
+		t.context->OnLowerLayerDown();
+	}
+}
+
+TEST_CASE(SUITE("PooledTxBufferIsReleasedAfterTransmit"))
+{
+	MasterParams params;
+	params.disableUnsolOnStartup = false;
+	params.unsolClassMask = 0;
+	params.bufferPool = BufferPool::Create(params.maxTxFragSize);
+	MasterTestObject t(params);
+	t.context->OnLowerLayerUp();
+
+	REQUIRE(params.bufferPool->GetStatistics().bytesInUse == 0);
+
+	t.exe->RunMany();
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	REQUIRE(params.bufferPool->GetStatistics().bytesInUse == params.maxTxFragSize);
+
+	t.context->OnSendResult(true);
+	REQUIRE(params.bufferPool->GetStatistics().bytesInUse == 0);
+	REQUIRE(params.bufferPool->GetStatistics().bytesCached == params.maxTxFragSize);
+}
+
 TEST_CASE(SUITE("UnsolDisableEnableOnStartup"))
 {
 	MasterParams params;
@@ -150,6 +264,88 @@ TEST_CASE(SUITE("SolicitedResponseTimeout"))
 	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(1));
 }
 
+TEST_CASE(SUITE("AdaptiveResponseTimeoutFollowsMeasuredRoundTrip"))
+{
+	MasterParams params = NoStartupTasks();
+	params.adaptiveResponseTimeout = true;
+	params.minResponseTimeout = TimeDuration::Milliseconds(100);
+	MasterTestObject t(params);
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+
+	auto scan = t.context->AddClassScan(~0, TimeDuration::Seconds(10));
+
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(300));
+	t.SendToMaster("C0 81 00 00");
+
+	auto stats = t.context->GetStatistics();
+	REQUIRE(stats.smoothedRttMs == 300);
+	REQUIRE(stats.rttVarianceMs == 150);
+	REQUIRE(stats.responseTimeoutMs == 900);
+
+	t.exe->AdvanceTime(TimeDuration::Seconds(10));
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(1));
+	t.context->OnSendResult(true);
+
+	// the next poll times out after 900ms instead of the configured 5 seconds
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(899));
+	REQUIRE(t.exe->RunMany() == 0);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(1));
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.context->GetStatistics().responseTimeoutMs == 1800);
+}
+
+TEST_CASE(SUITE("AdaptiveResponseTimeoutIsResetWhenTheLayerCloses"))
+{
+	MasterParams params = NoStartupTasks();
+	params.adaptiveResponseTimeout = true;
+	params.minResponseTimeout = TimeDuration::Milliseconds(100);
+	MasterTestObject t(params);
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+
+	auto scan = t.context->AddClassScan(~0, TimeDuration::Seconds(10));
+
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(300));
+	t.SendToMaster("C0 81 00 00");
+	REQUIRE(t.context->GetStatistics().responseTimeoutMs == 900);
+
+	t.context->OnLowerLayerDown();
+
+	auto stats = t.context->GetStatistics();
+	REQUIRE(stats.smoothedRttMs == 0);
+	REQUIRE(stats.responseTimeoutMs == 5000);
+}
+
+TEST_CASE(SUITE("RoundTripIsNotMeasuredWithoutAdaptiveResponseTimeout"))
+{
+	MasterTestObject t(NoStartupTasks());
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+
+	auto scan = t.context->AddClassScan(~0, TimeDuration::Seconds(10));
+
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(300));
+	t.SendToMaster("C0 81 00 00");
+
+	auto stats = t.context->GetStatistics();
+	REQUIRE(stats.smoothedRttMs == 0);
+	REQUIRE(stats.responseTimeoutMs == 5000);
+}
+
 TEST_CASE(SUITE("AllObjectsScan"))
 {
 	MasterTestObject t(NoStartupTasks());
@@ -163,6 +359,66 @@ TEST_CASE(SUITE("AllObjectsScan"))
 	REQUIRE(t.lower->PopWriteAsHex() == "C0 01 6E 00 06");
 }
 
+TEST_CASE(SUITE("DueCoalescableScansShareOneRequest"))
+{
+	MasterTestObject t(NoStartupTasks());
+
+	auto config1 = TaskConfig::Coalesced();
+	config1.taskId = TaskId::Defined(1);
+	auto config2 = TaskConfig::Coalesced();
+	config2.taskId = TaskId::Defined(2);
+
+	auto scan1 = t.context->AddAllObjectsScan(GroupVariationID(30, 1), TimeDuration::Seconds(1), config1);
+	auto scan2 = t.context->AddAllObjectsScan(GroupVariationID(1, 2), TimeDuration::Seconds(1), config2);
+	auto scan3 = t.context->AddAllObjectsScan(GroupVariationID(20, 1), TimeDuration::Seconds(1));
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 01 1E 01 06 01 02 06");
+	REQUIRE(t.application->taskStartEvents.size() == 2);
+	t.context->OnSendResult(true);
+	t.SendToMaster("C0 81 00 00");
+
+	REQUIRE(t.application->taskCompletionEvents.size() == 2);
+	for (auto& info : t.application->taskCompletionEvents)
+	{
+		REQUIRE(info.result == TaskCompletion::SUCCESS);
+	}
+	REQUIRE(t.application->taskCompletionEvents[0].id.GetId() == 1);
+	REQUIRE(t.application->taskCompletionEvents[1].id.GetId() == 2);
+
+	// the scan that didn't opt in runs on its own
+	t.exe->RunMany();
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 01 14 01 06");
+	t.context->OnSendResult(true);
+	t.SendToMaster("C1 81 00 00");
+
+	// both coalesced scans are rescheduled and merged again
+	t.exe->AdvanceTime(TimeDuration::Seconds(1));
+	t.exe->RunMany();
+	REQUIRE(t.lower->PopWriteAsHex() == "C2 01 1E 01 06 01 02 06");
+}
+
+TEST_CASE(SUITE("CoalescingIsLimitedByTheMaxTxFragmentSize"))
+{
+	auto params = NoStartupTasks();
+	params.maxTxFragSize = 7;
+	MasterTestObject t(params);
+
+	auto scan1 = t.context->AddAllObjectsScan(GroupVariationID(30, 1), TimeDuration::Seconds(1), TaskConfig::Coalesced());
+	auto scan2 = t.context->AddAllObjectsScan(GroupVariationID(1, 2), TimeDuration::Seconds(1), TaskConfig::Coalesced());
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 01 1E 01 06");
+	t.context->OnSendResult(true);
+	t.SendToMaster("C0 81 00 00");
+
+	t.exe->RunMany();
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 01 01 02 06");
+}
+
 TEST_CASE(SUITE("ClassScanCanRepeat"))
 {
 	MasterParams params = NoStartupTasks();
@@ -230,6 +486,71 @@ TEST_CASE(SUITE("SolicitedMultiFragResponse"))
 	REQUIRE((Binary(false, 0x02) == t.meas->binarySOE[3].meas));
 }
 
+TEST_CASE(SUITE("SolicitedMultiFragResponseIsATransactionPerFragmentByDefault"))
+{
+	auto config = NoStartupTasks();
+	config.startupIntegrityClassMask = ClassField::AllClasses();
+	MasterTestObject t(config);
+	t.context->OnLowerLayerUp();
+
+	REQUIRE(t.exe->RunMany() > 0);
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.SendToMaster("80 81 00 00 01 02 00 02 02 81");
+	t.SendToMaster("41 81 00 00 01 02 00 03 03 02");
+	REQUIRE(t.meas->numStart == 2);
+	REQUIRE(t.meas->numEnd == 2);
+	REQUIRE(t.meas->numResponseBegin == 0);
+}
+
+TEST_CASE(SUITE("SolicitedMultiFragResponseIsOneTransactionWhenGrouped"))
+{
+	auto config = NoStartupTasks();
+	config.startupIntegrityClassMask = ClassField::AllClasses();
+	config.groupResponseFragments = true;
+	MasterTestObject t(config);
+	t.context->OnLowerLayerUp();
+
+	REQUIRE(t.exe->RunMany() > 0);
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.SendToMaster("80 81 00 00 01 02 00 02 02 81");
+	REQUIRE(t.meas->numResponseBegin == 1);
+	REQUIRE(t.meas->numStart == 1);
+	REQUIRE(t.meas->numEnd == 0);
+
+	t.SendToMaster("41 81 00 00 01 02 00 03 03 02");
+	REQUIRE(2 == t.meas->TotalReceived());
+	REQUIRE(t.meas->numStart == 1);
+	REQUIRE(t.meas->numEnd == 1);
+	REQUIRE(t.meas->responseResults == std::vector<bool>({ true }));
+}
+
+TEST_CASE(SUITE("GroupedTransactionEndsWhenTheResponseTimesOut"))
+{
+	auto config = NoStartupTasks();
+	config.startupIntegrityClassMask = ClassField::AllClasses();
+	config.groupResponseFragments = true;
+	MasterTestObject t(config);
+	t.context->OnLowerLayerUp();
+
+	REQUIRE(t.exe->RunMany() > 0);
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.SendToMaster("80 81 00 00 01 02 00 02 02 81");
+	REQUIRE(t.meas->numEnd == 0);
+
+	REQUIRE(t.exe->AdvanceToNextTimer());
+	REQUIRE(t.exe->RunMany() > 0);
+
+	REQUIRE(t.meas->numStart == 1);
+	REQUIRE(t.meas->numEnd == 1);
+	REQUIRE(t.meas->responseResults == std::vector<bool>({ false }));
+}
+
 TEST_CASE(SUITE("EventPoll"))
 {
 	MasterTestObject t(NoStartupTasks());
@@ -626,4 +947,52 @@ TEST_CASE(SUITE("Warm restart fails with empty response"))
 	REQUIRE(queue.responses.size() == 1);
 	REQUIRE(queue.responses[0].summary == TaskCompletion::SUCCESS);
 	REQUIRE(queue.responses[0].restartTime.GetMilliseconds() == (0xBBBB * 1000));
-}
\ No newline at end of file
+}
+TEST_CASE(SUITE("RequestLatencyIsRecordedByTaskTypeAndId"))
+{
+	MasterParams params = NoStartupTasks();
+	params.maxTaskIdLatencyHistograms = 1;
+	MasterTestObject t(params);
+	t.context->OnLowerLayerUp();
+
+	TaskConfig config = TaskConfig::Default();
+	config.taskId = TaskId::Defined(7);
+	auto scan = t.context->AddClassScan(~0, TimeDuration::Seconds(10), config);
+
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(300));
+	t.SendToMaster("C0 81 00 00");
+
+	REQUIRE(t.context->latencies->RequestLatency(MasterTaskType::USER_TASK).Count() == 1);
+	REQUIRE(t.context->latencies->RequestLatency(MasterTaskType::USER_TASK).Max() == 300000);
+
+	auto byId = t.context->latencies->RequestLatency(TaskId::Defined(7));
+	REQUIRE(byId != nullptr);
+	REQUIRE(byId->Count() == 1);
+	REQUIRE(t.context->latencies->RequestLatency(TaskId::Defined(8)) == nullptr);
+
+	auto stats = t.context->GetStatistics();
+	REQUIRE(stats.requestLatency.count == 1);
+	REQUIRE(stats.requestLatency.p50 == 300000);
+	REQUIRE(stats.commandLatency.count == 0);
+}
+
+TEST_CASE(SUITE("LatencyHistogramsCanBeDisabled"))
+{
+	MasterParams params = NoStartupTasks();
+	params.latencyHistograms = false;
+	MasterTestObject t(params);
+	t.context->OnLowerLayerUp();
+
+	auto scan = t.context->AddClassScan(~0, TimeDuration::Seconds(10));
+
+	REQUIRE(t.exe->RunMany() > 0);
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+	t.SendToMaster("C0 81 00 00");
+
+	REQUIRE(t.context->latencies == nullptr);
+	REQUIRE(t.context->GetStatistics().requestLatency.count == 0);
+}
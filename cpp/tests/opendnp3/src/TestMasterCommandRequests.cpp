@@ -438,3 +438,138 @@ TEST_CASE(SUITE("Int16SetpointExecution"))
 
 
 
+
+// Receives a long integrity poll response, one fragment per period, submitting a command after the first fragment.
+// Returns the time between submitting the command and transmitting it.
+static TimeDuration MeasureCommandLatencyDuringPoll(bool preempt, uint8_t numFragments, TimeDuration fragmentPeriod)
+{
+	auto config = NoStartupTasks();
+	config.preemptPollsForCommands = preempt;
+	config.taskStartTimeout = TimeDuration::Minutes(1); // long enough that the command doesn't fail waiting for the poll
+	MasterTestObject t(config);
+	auto scan = t.context->AddClassScan(ClassField::AllClasses(), TimeDuration::Seconds(60));
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+
+	CommandCallbackQueue queue;
+	MonotonicTimestamp submitted;
+
+	// transmit anything the master writes, returning true when it's the command
+	auto transmit = [&t]() -> bool
+	{
+		t.exe->RunMany();
+		while (t.lower->NumWrites() > 0)
+		{
+			auto write = t.lower->PopWriteAsHex();
+			t.context->OnSendResult(true);
+			t.exe->RunMany();
+			if (write.substr(3, 2) == "05")
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	for (uint8_t seq = 0; seq < numFragments; ++seq)
+	{
+		if (seq > 0)
+		{
+			t.exe->AdvanceTime(fragmentPeriod);
+		}
+
+		AppControlField control(seq == 0, seq == (numFragments - 1), true, false, seq);
+		t.SendToMaster(testlib::AppendHex({ testlib::ByteToHex(control.ToByte()), "81 00 00 01 02 00 02 02 81" }));
+
+		if (seq == 0)
+		{
+			t.context->DirectOperate(CommandSet({ WithIndex(AnalogOutputInt16(100), 1) }), queue.Callback(), TaskConfig::Default());
+			submitted = t.exe->GetTime();
+		}
+
+		if (transmit())
+		{
+			return TimeDuration::Milliseconds(t.exe->GetTime().milliseconds - submitted.milliseconds);
+		}
+	}
+
+	return TimeDuration::Max();
+}
+
+TEST_CASE(SUITE("CommandLatencyDuringLongPollIsBoundedByOneFragmentWithPreemption"))
+{
+	const uint8_t NUM_FRAGMENTS = 40;
+	const auto PERIOD = TimeDuration::Milliseconds(500);
+
+	// without preemption, the command waits for the entire response
+	REQUIRE(MeasureCommandLatencyDuringPoll(false, NUM_FRAGMENTS, PERIOD).GetMilliseconds() == (NUM_FRAGMENTS - 1) * PERIOD.GetMilliseconds());
+	REQUIRE(MeasureCommandLatencyDuringPoll(true, NUM_FRAGMENTS, PERIOD).GetMilliseconds() == PERIOD.GetMilliseconds());
+}
+
+TEST_CASE(SUITE("PreemptedPollIsRestartedAfterTheCommand"))
+{
+	auto config = NoStartupTasks();
+	config.preemptPollsForCommands = true;
+	MasterTestObject t(config);
+	auto scan = t.context->AddClassScan(ClassField::AllClasses(), TimeDuration::Seconds(60));
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnSendResult(true);
+
+	t.SendToMaster("A0 81 00 00 01 02 00 02 02 81");
+	REQUIRE(t.lower->PopWriteAsHex() == hex::SolicitedConfirm(0));
+	t.context->OnSendResult(true);
+
+	CommandCallbackQueue queue;
+	t.context->DirectOperate(CommandSet({ WithIndex(AnalogOutputInt16(100), 1) }), queue.Callback(), TaskConfig::Default());
+	REQUIRE(t.lower->NumWrites() == 0);
+
+	// the next fragment isn't confirmed, the command goes out instead
+	t.SendToMaster("21 81 00 00 01 02 00 03 03 81");
+	t.exe->RunMany();
+	REQUIRE(t.lower->PopWriteAsHex() == "C2 05 29 02 28 01 00 01 00 64 00 00");
+	REQUIRE(t.lower->NumWrites() == 0);
+	t.context->OnSendResult(true);
+	t.SendToMaster("C2 81 00 00 29 02 28 01 00 01 00 64 00 00");
+	REQUIRE(queue.values.size() == 1);
+	REQUIRE(queue.values.front().summary == TaskCompletion::SUCCESS);
+
+	// then the poll starts over
+	t.exe->RunMany();
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(3));
+	REQUIRE(t.application->taskCompletionEvents.size() == 1);
+}
+
+TEST_CASE(SUITE("SelectAndOperateLatencyCoversBothRequests"))
+{
+	MasterTestObject t(NoStartupTasks());
+	t.context->OnLowerLayerUp();
+
+	CommandCallbackQueue queue;
+	t.context->SelectAndOperate(CommandSet({ WithIndex(ControlRelayOutputBlock(ControlCode::PULSE_ON), 1) }), queue.Callback(), TaskConfig::Default());
+
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 03 " + crob); // SELECT
+	t.context->OnSendResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(100));
+	t.SendToMaster("C0 81 00 00 " + crob);
+
+	t.exe->RunMany();
+
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 04 " + crob); // OPERATE
+	t.context->OnSendResult(true);
+	t.exe->AdvanceTime(TimeDuration::Milliseconds(200));
+	t.SendToMaster("C1 81 00 00 " + crob);
+
+	t.exe->RunMany();
+
+	REQUIRE(t.context->latencies->selectAndOperate.Count() == 1);
+	REQUIRE(t.context->latencies->selectAndOperate.Max() == 300000);
+	REQUIRE(t.context->latencies->directOperate.Count() == 0);
+	REQUIRE(t.context->latencies->RequestLatency().Count() == 2);
+	REQUIRE(t.context->GetStatistics().commandLatency.p50 == 300000);
+}
@@ -27,6 +27,8 @@
 
 #include <opendnp3/master/MultidropTaskLock.h>
 
+#include <memory>
+
 using namespace openpal;
 using namespace opendnp3;
 
@@ -102,3 +104,130 @@ TEST_CASE(SUITE("Shutting down a master causes 2nd master to acquire task lock")
 	REQUIRE(t2.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
 }
 
+
+class CountingScheduleCallback final : public IScheduleCallback
+{
+public:
+
+	virtual void OnPendingTask() override
+	{
+		++count;
+	}
+
+	uint32_t count = 0;
+};
+
+TEST_CASE(SUITE("Removing a master with a queued request skips it"))
+{
+	MultidropTaskLock taskLock;
+	taskLock.SetOnline();
+
+	CountingScheduleCallback first, third;
+	auto second = std::make_unique<CountingScheduleCallback>();
+
+	REQUIRE(taskLock.Acquire(first));
+	REQUIRE_FALSE(taskLock.Acquire(*second));
+	REQUIRE_FALSE(taskLock.Acquire(third));
+
+	taskLock.Remove(*second);
+	second.reset();
+
+	REQUIRE(taskLock.Release(first));
+	REQUIRE(third.count == 1);
+	REQUIRE(taskLock.Acquire(third));
+}
+
+TEST_CASE(SUITE("Removing the active master grants the lock to the next one"))
+{
+	MultidropTaskLock taskLock;
+	taskLock.SetOnline();
+
+	CountingScheduleCallback first, second;
+
+	REQUIRE(taskLock.Acquire(first));
+	REQUIRE_FALSE(taskLock.Acquire(second));
+
+	taskLock.Remove(first);
+	REQUIRE(second.count == 1);
+	REQUIRE(taskLock.Acquire(second));
+	REQUIRE_FALSE(taskLock.Release(first));
+}
+
+TEST_CASE(SUITE("Fair queuing grants the lock to the master that used the least bus time"))
+{
+	MultidropSchedulerConfig config;
+	config.fairQueuing = true;
+	MultidropTaskLock taskLock(config);
+	taskLock.SetOnline();
+
+	CountingScheduleCallback slow, fast1, fast2;
+
+	REQUIRE(taskLock.Acquire(slow));
+	REQUIRE_FALSE(taskLock.Acquire(fast1));
+	REQUIRE_FALSE(taskLock.Acquire(fast2));
+
+	taskLock.OnRequestComplete(slow, MonotonicTimestamp(5000), TimeDuration::Seconds(5), false);
+	REQUIRE(taskLock.Release(slow));
+	REQUIRE(fast1.count == 1);
+	REQUIRE_FALSE(taskLock.Acquire(slow));
+
+	taskLock.OnRequestComplete(fast1, MonotonicTimestamp(5100), TimeDuration::Milliseconds(100), true);
+	REQUIRE(taskLock.Release(fast1));
+	REQUIRE(fast2.count == 1);
+	REQUIRE_FALSE(taskLock.Acquire(fast1));
+
+	// fast1 asked after slow, but has been charged far less bus time
+	taskLock.OnRequestComplete(fast2, MonotonicTimestamp(5200), TimeDuration::Milliseconds(100), true);
+	REQUIRE(taskLock.Release(fast2));
+	REQUIRE(fast1.count == 2);
+	REQUIRE(slow.count == 0);
+	REQUIRE(taskLock.GetLatency(fast1).GetMilliseconds() == 100);
+}
+
+TEST_CASE(SUITE("Failing masters are demoted to a back-off probe schedule"))
+{
+	MultidropSchedulerConfig config;
+	config.fairQueuing = true;
+	config.timeoutsBeforeBackoff = 2;
+	config.minBackoff = TimeDuration::Seconds(10);
+	MultidropTaskLock taskLock(config);
+	taskLock.SetOnline();
+
+	CountingScheduleCallback failing, healthy, other;
+
+	for (int i = 0; i < 2; ++i)
+	{
+		REQUIRE(taskLock.Acquire(failing));
+		taskLock.OnRequestComplete(failing, MonotonicTimestamp(5000 * (i + 1)), TimeDuration::Seconds(5), false);
+		REQUIRE(taskLock.Release(failing));
+	}
+
+	REQUIRE(taskLock.IsBackedOff(failing));
+
+	// the failing master asked first, but its probe time hasn't been reached
+	REQUIRE(taskLock.Acquire(healthy));
+	REQUIRE_FALSE(taskLock.Acquire(failing));
+	REQUIRE_FALSE(taskLock.Acquire(other));
+	taskLock.OnRequestComplete(healthy, MonotonicTimestamp(10100), TimeDuration::Milliseconds(100), true);
+	REQUIRE(taskLock.Release(healthy));
+	REQUIRE(other.count == 1);
+	REQUIRE(failing.count == 0);
+
+	// the channel stays idle rather than letting it probe early
+	taskLock.OnRequestComplete(other, MonotonicTimestamp(10200), TimeDuration::Milliseconds(100), true);
+	REQUIRE(taskLock.Release(other));
+	REQUIRE(failing.count == 0);
+	REQUIRE(taskLock.Acquire(healthy));
+
+	// once the probe time has passed it's granted the channel
+	taskLock.OnRequestComplete(healthy, MonotonicTimestamp(20000), TimeDuration::Milliseconds(100), true);
+	REQUIRE(taskLock.Release(healthy));
+	REQUIRE(failing.count == 1);
+
+	// and a response ends the back-off
+	taskLock.OnRequestComplete(failing, MonotonicTimestamp(20100), TimeDuration::Milliseconds(100), true);
+	REQUIRE_FALSE(taskLock.IsBackedOff(failing));
+	REQUIRE_FALSE(taskLock.Acquire(healthy));
+	REQUIRE(taskLock.Release(failing));
+	REQUIRE(healthy.count == 1);
+}
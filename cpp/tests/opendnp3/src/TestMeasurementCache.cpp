@@ -0,0 +1,110 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <opendnp3/master/MeasurementCache.h>
+#include <opendnp3/app/parsing/Collections.h>
+
+using namespace opendnp3;
+
+#define SUITE(name) "MeasurementCacheTestSuite - " name
+
+namespace
+{
+void UpdateBinaries(MeasurementCache& cache, const Indexed<Binary>* values, size_t count)
+{
+	ArrayCollection<Indexed<Binary>> collection(values, count);
+	cache.BeginUpdate();
+	cache.Update(collection);
+	cache.EndUpdate();
+}
+}
+
+TEST_CASE(SUITE("DisabledWithEmptySizes"))
+{
+	REQUIRE_FALSE(MeasurementCache::IsEnabled(DatabaseSizes::Empty()));
+	REQUIRE(MeasurementCache::IsEnabled(DatabaseSizes::AnalogOnly(1)));
+}
+
+TEST_CASE(SUITE("ReadFailsForUnreceivedAndOutOfRangePoints"))
+{
+	MeasurementCache cache(DatabaseSizes::BinaryOnly(3));
+
+	CachedValue<Binary> value;
+	REQUIRE_FALSE(cache.Read(0, value));
+	REQUIRE_FALSE(cache.Read(3, value));
+
+	CachedValue<Analog> analog;
+	REQUIRE_FALSE(cache.Read(0, analog));
+	REQUIRE(cache.GetSequence() == 0);
+}
+
+TEST_CASE(SUITE("UpdatesAreReadable"))
+{
+	MeasurementCache cache(DatabaseSizes::BinaryOnly(3));
+
+	Indexed<Binary> values[] = { WithIndex(Binary(true), 1), WithIndex(Binary(false), 7) };
+	UpdateBinaries(cache, values, 2);
+
+	// index 7 is outside the cache and is ignored
+	REQUIRE(cache.GetSequence() == 1);
+
+	CachedValue<Binary> value;
+	REQUIRE(cache.Read(1, value));
+	REQUIRE(value.value.value);
+	REQUIRE(value.sequence == 1);
+}
+
+TEST_CASE(SUITE("SnapshotCopiesEveryPoint"))
+{
+	MeasurementCache cache(DatabaseSizes::BinaryOnly(3));
+
+	Indexed<Binary> values[] = { WithIndex(Binary(true), 0), WithIndex(Binary(true), 2) };
+	UpdateBinaries(cache, values, 2);
+
+	std::vector<CachedValue<Binary>> snapshot;
+	REQUIRE(cache.Snapshot(snapshot) == 2);
+	REQUIRE(snapshot.size() == 3);
+	REQUIRE(snapshot[0].sequence == 1);
+	REQUIRE(snapshot[1].sequence == 0);
+	REQUIRE(snapshot[2].sequence == 2);
+}
+
+TEST_CASE(SUITE("ChangedSinceReturnsOnlyNewerPoints"))
+{
+	MeasurementCache cache(DatabaseSizes::BinaryOnly(3));
+
+	Indexed<Binary> first[] = { WithIndex(Binary(true), 0), WithIndex(Binary(true), 1) };
+	UpdateBinaries(cache, first, 2);
+
+	std::vector<Indexed<Binary>> changed;
+	auto seq = cache.ChangedSince(0, changed);
+	REQUIRE(seq == 2);
+	REQUIRE(changed.size() == 2);
+
+	Indexed<Binary> second[] = { WithIndex(Binary(false), 1) };
+	UpdateBinaries(cache, second, 1);
+
+	REQUIRE(cache.ChangedSince(seq, changed) == 3);
+	REQUIRE(changed.size() == 1);
+	REQUIRE(changed[0].index == 1);
+	REQUIRE_FALSE(changed[0].value.value);
+}
@@ -69,6 +69,28 @@ TEST_CASE(SUITE("ReadUnknownObject"))
 	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 02"); // IIN = device restart + unknown object
 }
 
+TEST_CASE(SUITE("RequestProcessingTimeIncludesDeferral"))
+{
+	OutstationConfig config;
+	OutstationTestObject t(config);
+	t.LowerLayerUp();
+
+	t.SendToOutstation("C0 01"); // blank read
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00");
+
+	// the second read waits for the first response to finish transmitting
+	t.SendToOutstation("C1 01");
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+	t.AdvanceTime(TimeDuration::Milliseconds(50));
+	t.OnSendResult(true);
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00");
+
+	auto processing = t.context.GetLatencies().requestProcessing;
+	REQUIRE(processing.Count() == 2);
+	REQUIRE(processing.Min() == 0);
+	REQUIRE(processing.Max() == 50000);
+}
+
 TEST_CASE(SUITE("ColdRestart"))
 {
 	OutstationConfig config;
@@ -212,6 +234,36 @@ TEST_CASE(SUITE("WriteTimeDate"))
 
 }
 
+TEST_CASE(SUITE("BroadcastTimeDateIsNotAnsweredAndSetsIIN1.0Once"))
+{
+	OutstationConfig config;
+	OutstationTestObject t(config);
+	t.LowerLayerUp();
+
+	t.BroadcastToOutstation("C0 02 32 01 07 01 D2 04 00 00 00 00"); // write Grp50Var1, value = 1234 ms after epoch
+	REQUIRE(t.lower->NumWrites() == 0);
+	REQUIRE(t.application->timestamps.size() == 1);
+	REQUIRE(t.application->timestamps.front().msSinceEpoch == 1234);
+	REQUIRE(t.context.GetStatistics().numBroadcastRequests == 1);
+
+	t.SendToOutstation("C1 01");
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 81 81 00"); // restart and all stations
+	t.OnSendResult(true);
+
+	t.SendToOutstation("C2 01");
+	REQUIRE(t.lower->PopWriteAsHex() == "C2 81 80 00");
+}
+
+TEST_CASE(SUITE("BroadcastReadIsIgnored"))
+{
+	OutstationConfig config;
+	OutstationTestObject t(config);
+	t.LowerLayerUp();
+
+	t.BroadcastToOutstation("C0 01 3C 01 06"); // read class 0
+	REQUIRE(t.lower->NumWrites() == 0);
+}
+
 TEST_CASE(SUITE("WriteTimeDateNotAsking"))
 {
 	OutstationConfig config;
@@ -276,10 +328,131 @@ TEST_CASE(SUITE("TypesCanBeOmittedFromClass0ViaConfig"))
 	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 01 02 00 00 00 02");
 }
 
-TEST_CASE(SUITE("ReadClass0MultiFragAnalog"))
+TEST_CASE(SUITE("CompactStaticVariationsShrinkDefaultReads"))
+{
+	OutstationConfig config;
+	config.params.compactStaticTypes = StaticTypeBitField(static_cast<uint16_t>(StaticTypeBitmask::AnalogInput));
+	OutstationTestObject t(config, DatabaseSizes::AnalogOnly(3));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Analog(1, 0x01), 0);
+		db.Update(Analog(-2, 0x01), 1);
+		db.Update(Analog(300, 0x01), 2);
+	});
+
+	t.LowerLayerUp();
+
+	// every value is ONLINE and fits 16 bits, so g30v1 (the default) becomes g30v4
+	t.SendToOutstation("C0 01 3C 01 06");
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 1E 04 00 00 02 01 00 FE FF 2C 01");
+	t.OnSendResult(true);
+
+	REQUIRE(t.context.GetStatistics().numCompactedStaticValues == 3);
+	REQUIRE(t.context.GetStatistics().numStaticBytesSaved == 9);
+
+	// an explicitly requested variation is always honored
+	t.SendToOutstation("C1 01 1E 01 00 00 02");
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00 1E 01 00 00 02 01 01 00 00 00 01 FE FF FF FF 01 2C 01 00 00");
+	REQUIRE(t.context.GetStatistics().numCompactedStaticValues == 3);
+}
+
+TEST_CASE(SUITE("CompactStaticVariationsUseTheLargestValueInTheRange"))
+{
+	OutstationConfig config;
+	config.params.compactStaticTypes = StaticTypeBitField::AllTypes();
+	OutstationTestObject t(config, DatabaseSizes::CounterOnly(2));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Counter(5, 0x01), 0);
+		db.Update(Counter(70000, 0x01), 1);
+	});
+
+	t.LowerLayerUp();
+
+	// 32-bit without flags for the whole range, rather than splitting it into two headers
+	t.SendToOutstation("C0 01 3C 01 06");
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 14 05 00 00 01 05 00 00 00 70 11 01 00");
+	REQUIRE(t.context.GetStatistics().numStaticBytesSaved == 2);
+}
+
+TEST_CASE(SUITE("CompactStaticVariationsKeepFlagsThatAreNotOnline"))
+{
+	OutstationConfig config;
+	config.params.compactStaticTypes = StaticTypeBitField::AllTypes();
+	OutstationTestObject t(config, DatabaseSizes::AnalogOnly(2));
+
+	{
+		auto view = t.context.GetConfigView();
+		view.analogs[0].config.svariation = StaticAnalogVariation::Group30Var5;
+		view.analogs[1].config.svariation = StaticAnalogVariation::Group30Var5;
+	}
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Analog(7, 0x01), 0);
+	});
+
+	t.LowerLayerUp();
+
+	// index 1 still has RESTART, so the flags are kept in g30v2
+	t.SendToOutstation("C0 01 3C 01 06");
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 1E 02 00 00 01 01 07 00 02 00 00");
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Analog(7.5, 0x01), 1);
+	});
+
+	// a fractional value cannot be sent as an integer, so the configured float variation is used
+	t.OnSendResult(true);
+	t.SendToOutstation("C1 01 3C 01 06");
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00 1E 05 00 00 01 01 00 00 E0 40 01 00 00 F0 40");
+}
+
+TEST_CASE(SUITE("CompactStaticVariationsAreCountedWhenWritten"))
+{
+	OutstationConfig config;
+	config.params.maxTxFragSize = 20;
+	config.params.compactStaticTypes = StaticTypeBitField(static_cast<uint16_t>(StaticTypeBitmask::AnalogInput));
+	OutstationTestObject t(config, DatabaseSizes::AnalogOnly(8));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		for (uint16_t i = 0; i < 8; i++)
+		{
+			db.Update(Analog(0, 0x01), i);
+		}
+	});
+
+	t.LowerLayerUp();
+
+	// 5 of the 8 values fit in the first fragment as g30v4
+	t.SendToOutstation("C0 01 3C 01 06");
+	REQUIRE(t.lower->PopWriteAsHex() == "A0 81 80 00 1E 04 00 00 04 00 00 00 00 00 00 00 00 00 00");
+	t.OnSendResult(true);
+	REQUIRE(t.context.GetStatistics().numCompactedStaticValues == 5);
+	REQUIRE(t.context.GetStatistics().numStaticBytesSaved == 15);
+
+	// a new read cancels the rest of the response, so the remaining values are never counted
+	t.SendToOutstation("C1 01 3C 01 06");
+	REQUIRE(t.lower->PopWriteAsHex() == "A1 81 80 00 1E 04 00 00 04 00 00 00 00 00 00 00 00 00 00");
+	t.OnSendResult(true);
+	REQUIRE(t.context.GetStatistics().numCompactedStaticValues == 10);
+
+	t.SendToOutstation("C1 00");
+	REQUIRE(t.lower->PopWriteAsHex() == "42 81 80 00 1E 04 00 05 07 00 00 00 00 00 00");
+	t.OnSendResult(true);
+	REQUIRE(t.context.GetStatistics().numCompactedStaticValues == 13);
+	REQUIRE(t.context.GetStatistics().numStaticBytesSaved == 39);
+}
+
+void ReadClass0MultiFragAnalog(bool preEncode)
 {
 	OutstationConfig config;
 	config.params.maxTxFragSize = 20; // override to use a fragment length of 20
+	config.params.preEncodeResponses = preEncode;
 	OutstationTestObject t(config, DatabaseSizes::AnalogOnly(8));
 	t.LowerLayerUp();
 
@@ -313,6 +486,67 @@ TEST_CASE(SUITE("ReadClass0MultiFragAnalog"))
 	REQUIRE(t.lower->PopWriteAsHex() == "");
 }
 
+TEST_CASE(SUITE("ReadClass0MultiFragAnalog"))
+{
+	ReadClass0MultiFragAnalog(false);
+}
+
+TEST_CASE(SUITE("ReadClass0MultiFragAnalogPreEncoded"))
+{
+	ReadClass0MultiFragAnalog(true);
+}
+
+TEST_CASE(SUITE("PreEncodedFragmentDiscardedByNewRead"))
+{
+	OutstationConfig config;
+	config.params.maxTxFragSize = 20;
+	config.params.preEncodeResponses = true;
+	OutstationTestObject t(config, DatabaseSizes::AnalogOnly(4));
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		for (uint16_t i = 0; i < 4; i++)
+		{
+			db.Update(Analog(0, 0x01), i);
+		}
+	});
+
+	t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+	REQUIRE(t.lower->PopWriteAsHex() == "A0 81 80 00 1E 01 00 00 01 01 00 00 00 00 01 00 00 00 00");
+	t.OnSendResult(true);
+
+	// a new read while waiting for the confirm starts the response over
+	t.SendToOutstation("C1 01 3C 01 06");
+	REQUIRE(t.lower->PopWriteAsHex() == "A1 81 80 00 1E 01 00 00 01 01 00 00 00 00 01 00 00 00 00");
+	t.OnSendResult(true);
+	t.SendToOutstation("C1 00");
+	REQUIRE(t.lower->PopWriteAsHex() == "42 81 80 00 1E 01 00 02 03 01 00 00 00 00 01 00 00 00 00");
+	t.OnSendResult(true);
+	t.SendToOutstation("C2 00");
+
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+}
+
+TEST_CASE(SUITE("PreEncodedFragmentDiscardedByConfirmTimeout"))
+{
+	OutstationConfig config;
+	config.params.maxTxFragSize = 20;
+	config.params.preEncodeResponses = true;
+	OutstationTestObject t(config, DatabaseSizes::AnalogOnly(4));
+	t.LowerLayerUp();
+
+	t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+	REQUIRE(t.lower->PopWriteAsHex() == "A0 81 80 00 1E 01 00 00 01 02 00 00 00 00 02 00 00 00 00");
+	t.OnSendResult(true);
+
+	REQUIRE(t.AdvanceToNextTimer());
+
+	// a late confirm is ignored
+	t.SendToOutstation("C0 00");
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+}
+
 TEST_CASE(SUITE("ReadFuncNotSupported"))
 {
 	OutstationConfig config;
@@ -509,6 +743,50 @@ TEST_CASE(SUITE("ReadDiscontiguousClass0"))
 	REQUIRE(QueryDiscontiguousBinary("C0 01 3C 01 06") == "C0 81 80 00 01 02 00 02 02 81 01 02 00 04 05 01 02");
 }
 
+TEST_CASE(SUITE("OptimizedQualifiersPrefixSparseIndices"))
+{
+	OutstationConfig config;
+	config.params.indexMode = IndexMode::Discontiguous;
+	config.params.optimizeQualifiers = true;
+	OutstationTestObject t(config, DatabaseSizes::AnalogOnly(3));
+
+	{
+		auto view = t.context.GetConfigView();
+		view.analogs[0].config.vIndex = 0;
+		view.analogs[1].config.vIndex = 10;
+		view.analogs[2].config.vIndex = 20;
+	}
+
+	t.LowerLayerUp();
+
+	// one 0x17 header is 4 bytes smaller than three start-stop headers
+	t.SendToOutstation("C0 01 3C 01 06");
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 1E 01 17 03 00 02 00 00 00 00 0A 02 00 00 00 00 14 02 00 00 00 00");
+}
+
+TEST_CASE(SUITE("OptimizedQualifiersKeepStartStopForLongRuns"))
+{
+	OutstationConfig config;
+	config.params.indexMode = IndexMode::Discontiguous;
+	config.params.optimizeQualifiers = true;
+	OutstationTestObject t(config, DatabaseSizes::BinaryOnly(4));
+
+	{
+		auto view = t.context.GetConfigView();
+		for (uint16_t i = 0; i < 4; ++i)
+		{
+			view.binaries[i].config.svariation = StaticBinaryVariation::Group1Var2;
+		}
+		view.binaries[3].config.vIndex = 300;
+	}
+
+	t.LowerLayerUp();
+
+	// index 300 would need 2-byte prefixes for every point, so two start-stop headers are smaller
+	t.SendToOutstation("C0 01 3C 01 06");
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 01 02 01 00 00 02 00 02 02 02 01 02 01 2C 01 2C 01 02");
+}
+
 TEST_CASE(SUITE("ReadDiscontiguousBadRangeBelow"))
 {
 	// read 01 var 2, [00 : 01]
@@ -22,6 +22,8 @@
 
 #include "mocks/OutstationTestObject.h"
 
+#include <thread>
+
 using namespace std;
 using namespace opendnp3;
 using namespace openpal;
@@ -406,3 +408,114 @@ TEST_CASE(SUITE("DirectOperateGroup41Var4"))
 	REQUIRE(op.opType == OperateType::DirectOperate);
 }
 
+
+TEST_CASE(SUITE("AsyncDirectOperateDefersResponseUntilComplete"))
+{
+	OutstationConfig config;
+	auto handler = std::make_shared<MockAsyncCommandHandler>();
+	OutstationTestObject t(config, DatabaseSizes::Empty(), handler);
+	t.LowerLayerUp();
+
+	// direct operate group 12 Var 1, count = 1, index = 3
+	t.SendToOutstation("C0 05 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+	REQUIRE(handler->numOperate == 1);
+	REQUIRE(handler->numStart == 1);
+	REQUIRE(handler->numEnd == 1);
+
+	// the outstation keeps servicing other requests while the command is outstanding
+	t.SendToOutstation("C1 17"); // delay measure with a new sequence abandons the command
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00 34 02 07 01 00 00");
+	t.OnSendResult(true);
+
+	handler->CompleteNext(CommandStatus::SUCCESS);
+	t.RunExecutor();
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+}
+
+TEST_CASE(SUITE("AsyncDirectOperateRespondsWithRecordedStatuses"))
+{
+	OutstationConfig config;
+	auto handler = std::make_shared<MockAsyncCommandHandler>();
+	OutstationTestObject t(config, DatabaseSizes::Empty(), handler);
+	t.LowerLayerUp();
+
+	// direct operate group 12 Var 1, count = 2, index = 3 & 4
+	t.SendToOutstation("C0 05 0C 01 17 02 03 01 01 01 00 00 00 01 00 00 00 00 04 01 01 01 00 00 00 01 00 00 00 00");
+	REQUIRE(handler->pending.size() == 2);
+
+	handler->CompleteNext(CommandStatus::SUCCESS);
+	t.RunExecutor();
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+
+	// complete the 2nd command from another thread
+	auto completion = handler->pending.front();
+	handler->pending.pop_front();
+	std::thread([completion]()
+	{
+		completion.Complete(CommandStatus::HARDWARE_ERROR);
+	}).join();
+	t.RunExecutor();
+
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 0C 01 17 02 03 01 01 01 00 00 00 01 00 00 00 00 04 01 01 01 00 00 00 01 00 00 00 06");
+	t.OnSendResult(true);
+
+	// a repeat of the request is answered from the recorded response without invoking the handler again
+	t.SendToOutstation("C0 05 0C 01 17 02 03 01 01 01 00 00 00 01 00 00 00 00 04 01 01 01 00 00 00 01 00 00 00 00");
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 0C 01 17 02 03 01 01 01 00 00 00 01 00 00 00 00 04 01 01 01 00 00 00 01 00 00 00 06");
+	REQUIRE(handler->numOperate == 2);
+}
+
+TEST_CASE(SUITE("AsyncSelectOperateCROB"))
+{
+	OutstationConfig config;
+	auto handler = std::make_shared<MockAsyncCommandHandler>();
+	OutstationTestObject t(config, DatabaseSizes::Empty(), handler);
+	t.LowerLayerUp();
+
+	// Select group 12 Var 1, count = 1, index = 3
+	t.SendToOutstation("C0 03 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+	REQUIRE(handler->numSelect == 1);
+
+	// a repeat of the select while it's outstanding is ignored
+	t.SendToOutstation("C0 03 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+	REQUIRE(handler->numSelect == 1);
+
+	handler->CompleteNext(CommandStatus::SUCCESS);
+	handler->CompleteNext(CommandStatus::SUCCESS);
+	t.RunExecutor();
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+	t.OnSendResult(true);
+
+	// operate
+	t.SendToOutstation("C1 04 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+	REQUIRE(handler->numOperate == 1);
+	handler->CompleteNext(CommandStatus::SUCCESS);
+	t.RunExecutor();
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+}
+
+TEST_CASE(SUITE("AsyncCommandTimeout"))
+{
+	OutstationConfig config;
+	config.params.asyncCommandTimeout = TimeDuration::Seconds(2);
+	auto handler = std::make_shared<MockAsyncCommandHandler>();
+	OutstationTestObject t(config, DatabaseSizes::Empty(), handler);
+	t.LowerLayerUp();
+
+	// direct operate group 12 Var 1, count = 1, index = 3
+	t.SendToOutstation("C0 05 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+	REQUIRE(t.NumPendingTimers() == 1);
+
+	t.AdvanceTime(TimeDuration::Milliseconds(1999));
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+
+	t.AdvanceTime(TimeDuration::Milliseconds(1));
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 01"); // 0x01 status == CommandStatus::TIMEOUT
+	t.OnSendResult(true);
+
+	// late completions are ignored
+	handler->CompleteNext(CommandStatus::SUCCESS);
+	t.RunExecutor();
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+}
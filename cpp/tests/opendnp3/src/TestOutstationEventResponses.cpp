@@ -59,6 +59,36 @@ TEST_CASE(SUITE("ReadDiscontiguousEvent"))
 	REQUIRE(t.lower->PopWriteAsHex() == "E0 81 80 00 02 01 28 01 00 00 00 81");
 }
 
+TEST_CASE(SUITE("OptimizedQualifiersUseOneBytePrefixes"))
+{
+	OutstationConfig config;
+	config.eventBufferConfig = EventBufferConfig::AllTypes(10);
+	config.params.optimizeQualifiers = true;
+	OutstationTestObject t(config, DatabaseSizes::BinaryOnly(300));
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 3);
+		db.Update(Binary(false, 0x01), 7);
+	});
+
+	t.SendToOutstation(hex::ClassPoll(0, PointClass::Class1));
+	REQUIRE(t.lower->PopWriteAsHex() == "E0 81 80 00 02 01 17 02 03 81 07 01");
+	t.OnSendResult(true);
+	t.SendToOutstation(hex::SolicitedConfirm(0));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(false, 0x01), 3);
+		db.Update(Binary(true, 0x01), 299);
+	});
+
+	// an index above 255 requires 2-byte prefixes for the whole header
+	t.SendToOutstation(hex::ClassPoll(1, PointClass::Class1));
+	REQUIRE(t.lower->PopWriteAsHex() == "E1 81 80 00 02 01 28 02 00 03 00 01 2B 01 81");
+}
+
 TEST_CASE(SUITE("ReceiveNewRequestSolConfirmWait"))
 {
 	OutstationConfig config;
@@ -386,3 +416,26 @@ TEST_CASE(SUITE("ReadGrp2Var3TwoValuesDifferenceTooBigForCTO"))
 
 
 
+
+TEST_CASE(SUITE("EventAgeIsMeasuredWhenWritten"))
+{
+	OutstationConfig config;
+	config.eventBufferConfig = EventBufferConfig(5);
+	OutstationTestObject t(config, DatabaseSizes::BinaryOnly(1));
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true), 0);
+	});
+
+	t.AdvanceTime(TimeDuration::Milliseconds(200));
+
+	t.SendToOutstation("C0 01 3C 02 06"); // Read class 1
+	REQUIRE(t.lower->PopWriteAsHex() == "E0 81 80 00 02 01 28 01 00 00 00 81");
+
+	auto latencies = t.context.GetLatencies();
+	REQUIRE(latencies.eventAge.Count() == 1);
+	REQUIRE(latencies.eventAge.Max() == 200000);
+	REQUIRE(t.context.GetStatistics().eventAge.p50 == 200000);
+}
@@ -71,3 +71,23 @@ TEST_CASE(SUITE("Responds to non-READ request while waiting for unsolicited conf
 
 }
 
+TEST_CASE(SUITE("Unsolicited confirm timer keeps running after responding to non-READ request"))
+{
+	OutstationConfig config;
+	config.params.allowUnsolicited = true;
+	OutstationTestObject t(config, DatabaseSizes::AnalogOnly(1));
+	t.LowerLayerUp();
+
+	// the null unsolicited response never reaches the master
+	REQUIRE(t.lower->PopWriteAsHex() == "F0 82 80 00");
+	t.OnSendResult(true);
+
+	t.SendToOutstation("C0 02"); // empty write
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00");
+	t.OnSendResult(true);
+
+	// confirm timeout, then the null unsolicited response is retried
+	REQUIRE(t.AdvanceToNextTimer());
+	REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00");
+}
+
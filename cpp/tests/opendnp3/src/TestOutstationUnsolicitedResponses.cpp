@@ -160,6 +160,169 @@ TEST_CASE(SUITE("UnsolMultiFragments"))
 	REQUIRE(t.lower->PopWriteAsHex() == "");
 }
 
+TEST_CASE(SUITE("UnsolHoldTimeDelaysEvents"))
+{
+	OutstationConfig cfg;
+	cfg.params.allowUnsolicited = true;
+	cfg.params.unsolClassMask = ClassField::AllEventClasses();
+	cfg.params.unsolClass2HoldTime = TimeDuration::Seconds(5);
+	cfg.eventBufferConfig = EventBufferConfig(5);
+	OutstationTestObject t(cfg, DatabaseSizes::BinaryOnly(2));
+
+	auto view = t.context.GetConfigView();
+	view.binaries[0].config.clazz = PointClass::Class2;
+	view.binaries[1].config.clazz = PointClass::Class2;
+
+	t.LowerLayerUp();
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0, IINField(IINBit::DEVICE_RESTART)));
+	t.OnSendResult(true);
+	t.SendToOutstation(hex::UnsolConfirm(0));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+	});
+
+	// held, only the hold timer is pending
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+	REQUIRE(t.NumPendingTimers() == 1);
+
+	t.AdvanceTime(TimeDuration::Seconds(4));
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 1);
+	});
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+
+	// hold time is measured from the first event, both events go out together
+	t.AdvanceTime(TimeDuration::Seconds(1));
+	REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 02 00 00 00 81 01 00 81");
+	t.OnSendResult(true);
+	t.SendToOutstation(hex::UnsolConfirm(1));
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+
+	auto stats = t.context.GetStatistics();
+	REQUIRE(stats.numUnsolicitedFragments == 1);
+	REQUIRE(stats.numUnsolicitedEvents == 2);
+	REQUIRE(stats.AverageEventsPerUnsolicitedFragment() == 2.0);
+}
+
+TEST_CASE(SUITE("UnsolHoldTimeRestartsForEventsDuringConfirmWait"))
+{
+	OutstationConfig cfg;
+	cfg.params.allowUnsolicited = true;
+	cfg.params.unsolClassMask = ClassField::AllEventClasses();
+	cfg.params.unsolClass2HoldTime = TimeDuration::Seconds(5);
+	cfg.eventBufferConfig = EventBufferConfig(5);
+	OutstationTestObject t(cfg, DatabaseSizes::BinaryOnly(2));
+
+	auto view = t.context.GetConfigView();
+	view.binaries[0].config.clazz = PointClass::Class2;
+	view.binaries[1].config.clazz = PointClass::Class2;
+
+	t.LowerLayerUp();
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0, IINField(IINBit::DEVICE_RESTART)));
+	t.OnSendResult(true);
+	t.SendToOutstation(hex::UnsolConfirm(0));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+	});
+
+	t.AdvanceTime(TimeDuration::Seconds(5));
+	REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 01 00 00 00 81");
+	t.OnSendResult(true);
+
+	// arrives while waiting for the confirm
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 1);
+	});
+
+	t.SendToOutstation(hex::UnsolConfirm(1));
+
+	// the confirm does not release the new event, it is held for the full hold time
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+	t.AdvanceTime(TimeDuration::Seconds(4));
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+	t.AdvanceTime(TimeDuration::Seconds(1));
+	REQUIRE(t.lower->PopWriteAsHex() == "F2 82 80 00 02 01 28 01 00 01 00 81");
+}
+
+TEST_CASE(SUITE("UnsolMaxEventsReleasesHold"))
+{
+	OutstationConfig cfg;
+	cfg.params.allowUnsolicited = true;
+	cfg.params.unsolClassMask = ClassField::AllEventClasses();
+	cfg.params.unsolClass2HoldTime = TimeDuration::Seconds(60);
+	cfg.params.unsolClass2MaxEvents = 2;
+	cfg.eventBufferConfig = EventBufferConfig(5);
+	OutstationTestObject t(cfg, DatabaseSizes::BinaryOnly(2));
+
+	auto view = t.context.GetConfigView();
+	view.binaries[0].config.clazz = PointClass::Class2;
+	view.binaries[1].config.clazz = PointClass::Class2;
+
+	t.LowerLayerUp();
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0, IINField(IINBit::DEVICE_RESTART)));
+	t.OnSendResult(true);
+	t.SendToOutstation(hex::UnsolConfirm(0));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+	});
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 1);
+	});
+	REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 02 00 00 00 81 01 00 81");
+	t.OnSendResult(true);
+	t.SendToOutstation(hex::UnsolConfirm(1));
+
+	// the hold timer was canceled, only the confirm timer ran
+	REQUIRE(t.NumPendingTimers() == 0);
+}
+
+TEST_CASE(SUITE("UnsolClass1FlushesHeldEvents"))
+{
+	OutstationConfig cfg;
+	cfg.params.allowUnsolicited = true;
+	cfg.params.unsolClassMask = ClassField::AllEventClasses();
+	cfg.params.unsolClass2HoldTime = TimeDuration::Seconds(60);
+	cfg.eventBufferConfig = EventBufferConfig(5);
+	OutstationTestObject t(cfg, DatabaseSizes::BinaryOnly(2));
+
+	auto view = t.context.GetConfigView();
+	view.binaries[0].config.clazz = PointClass::Class1;
+	view.binaries[1].config.clazz = PointClass::Class2;
+
+	t.LowerLayerUp();
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0, IINField(IINBit::DEVICE_RESTART)));
+	t.OnSendResult(true);
+	t.SendToOutstation(hex::UnsolConfirm(0));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 1);
+	});
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+
+	// class 1 has no hold time and carries the held class 2 event with it
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+	});
+	REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 02 00 01 00 81 00 00 81");
+}
+
 void WriteDuringUnsol(bool beforeTx)
 {
 	OutstationConfig cfg;
@@ -0,0 +1,77 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <opendnp3/RTTEstimator.h>
+
+using namespace opendnp3;
+using namespace openpal;
+
+#define SUITE(name) "RTTEstimatorTestSuite - " name
+
+TEST_CASE(SUITE("UsesInitialTimeoutUntilFirstSample"))
+{
+	RTTEstimator rtt(TimeDuration::Seconds(5), TimeDuration::Milliseconds(100), TimeDuration::Seconds(5));
+
+	REQUIRE(rtt.GetTimeout() == TimeDuration::Seconds(5));
+	REQUIRE(rtt.NumSamples() == 0);
+
+	// first sample: srtt = R, rttvar = R/2, timeout = R + 4 * R/2
+	rtt.OnSample(TimeDuration::Milliseconds(200));
+	REQUIRE(rtt.GetSmoothedRTT() == TimeDuration::Milliseconds(200));
+	REQUIRE(rtt.GetVariance() == TimeDuration::Milliseconds(100));
+	REQUIRE(rtt.GetTimeout() == TimeDuration::Milliseconds(600));
+}
+
+TEST_CASE(SUITE("ConvergesOnStableRoundTripTime"))
+{
+	RTTEstimator rtt(TimeDuration::Seconds(5), TimeDuration::Milliseconds(100), TimeDuration::Seconds(5));
+
+	for (int i = 0; i < 50; ++i)
+	{
+		rtt.OnSample(TimeDuration::Milliseconds(400));
+	}
+
+	REQUIRE(rtt.GetSmoothedRTT() == TimeDuration::Milliseconds(400));
+	REQUIRE(rtt.GetVariance().GetMilliseconds() <= 2);
+	REQUIRE(rtt.GetTimeout().GetMilliseconds() < 410);
+}
+
+TEST_CASE(SUITE("TimeoutsBackOffWithinClamps"))
+{
+	RTTEstimator rtt(TimeDuration::Seconds(5), TimeDuration::Milliseconds(100), TimeDuration::Seconds(5));
+
+	rtt.OnSample(TimeDuration::Milliseconds(10));
+	REQUIRE(rtt.GetTimeout() == TimeDuration::Milliseconds(100)); // clamped to the minimum
+
+	rtt.OnTimeout();
+	REQUIRE(rtt.GetTimeout() == TimeDuration::Milliseconds(200));
+
+	for (int i = 0; i < 10; ++i)
+	{
+		rtt.OnTimeout();
+	}
+	REQUIRE(rtt.GetTimeout() == TimeDuration::Seconds(5)); // clamped to the maximum
+
+	rtt.Reset();
+	REQUIRE(rtt.NumSamples() == 0);
+	REQUIRE(rtt.GetTimeout() == TimeDuration::Seconds(5));
+}
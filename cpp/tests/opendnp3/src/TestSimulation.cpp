@@ -0,0 +1,177 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <dnp3sim/Simulation.h>
+
+#include <dnp3mocks/MockUpperLayer.h>
+
+#include <string>
+#include <vector>
+
+using namespace openpal;
+using namespace opendnp3;
+using namespace dnp3sim;
+
+#define SUITE(name) "SimulationTestSuite - " name
+
+TEST_CASE(SUITE("ExecutorRunsTimersInExpirationThenStartOrder"))
+{
+	VirtualTimeExecutor exe;
+	std::string order;
+
+	exe.Start(TimeDuration::Milliseconds(20), [&]()
+	{
+		order += "c";
+	});
+	exe.Start(TimeDuration::Milliseconds(10), [&]()
+	{
+		order += "a";
+	});
+	exe.Start(TimeDuration::Milliseconds(10), [&]()
+	{
+		order += "b";
+	});
+	auto canceled = exe.Start(TimeDuration::Milliseconds(15), [&]()
+	{
+		order += "x";
+	});
+	canceled->Cancel();
+
+	REQUIRE(exe.RunUntil(MonotonicTimestamp(15)) == 2);
+	REQUIRE(order == "ab");
+	REQUIRE(exe.GetTime().milliseconds == 15);
+
+	REQUIRE(exe.RunFor(TimeDuration::Milliseconds(5)) == 1);
+	REQUIRE(order == "abc");
+	REQUIRE(exe.NumPendingTimers() == 0);
+}
+
+TEST_CASE(SUITE("ExecutorRunsPostedHandlersBeforeLaterTimers"))
+{
+	VirtualTimeExecutor exe;
+	std::string order;
+
+	exe.Start(TimeDuration::Milliseconds(1), [&]()
+	{
+		order += "t";
+		exe.Post([&]()
+		{
+			order += "p";
+		});
+	});
+	exe.Start(TimeDuration::Milliseconds(2), [&]()
+	{
+		order += "u";
+	});
+
+	REQUIRE(exe.RunFor(TimeDuration::Milliseconds(2)) == 3);
+	REQUIRE(order == "tpu");
+}
+
+TEST_CASE(SUITE("WireSizeIncludesLinkAndTransportFraming"))
+{
+	REQUIRE(SimulatedLink::WireSize(2) == 15);
+	REQUIRE(SimulatedLink::WireSize(249) == 292);
+	REQUIRE(SimulatedLink::WireSize(250) == 306);
+}
+
+TEST_CASE(SUITE("LinkDelaysFragmentsBySerializationAndLatency"))
+{
+	VirtualTimeExecutor exe;
+	std::mt19937 random(1);
+
+	LinkParams params;
+	params.latency = TimeDuration::Milliseconds(100);
+	params.bitsPerSecond = 8000; // 1 byte per millisecond
+
+	SimulatedLink link(exe, random, params);
+	MockUpperLayer master;
+	MockUpperLayer outstation;
+	master.SetLowerLayer(link.Master());
+	outstation.SetLowerLayer(link.Outstation());
+	link.Bind(master, outstation);
+
+	// 15 bytes on the wire, twice
+	master.SendDown("C0 01");
+	master.SendDown("C1 01");
+
+	exe.RunUntil(MonotonicTimestamp(14));
+	REQUIRE(master.GetState().mSuccessCnt == 0);
+	exe.RunUntil(MonotonicTimestamp(15));
+	REQUIRE(master.GetState().mSuccessCnt == 1);
+
+	exe.RunUntil(MonotonicTimestamp(114));
+	REQUIRE(outstation.IsBufferEmpty());
+	exe.RunUntil(MonotonicTimestamp(115));
+	REQUIRE(outstation.BufferEqualsHex("C0 01"));
+
+	// the second fragment is serialized behind the first
+	exe.RunUntil(MonotonicTimestamp(130));
+	REQUIRE(outstation.BufferEqualsHex("C0 01 C1 01"));
+	REQUIRE(link.MasterToOutstation().numWireBytes == 30);
+}
+
+TEST_CASE(SUITE("WorkloadsCompleteOnEveryPair"))
+{
+	SimulationConfig config;
+	config.numPairs = 20;
+
+	Simulation sim(config);
+	sim.Start();
+
+	auto polls = sim.RunPolls(TimeDuration::Seconds(10), TimeDuration::Seconds(60));
+	REQUIRE(polls.numOperations == 120);
+	REQUIRE(polls.numFailures == 0);
+
+	auto commands = sim.RunCommands(TimeDuration::Seconds(10), TimeDuration::Seconds(60));
+	REQUIRE(commands.numOperations == 120);
+	REQUIRE(commands.numFailures == 0);
+
+	auto events = sim.RunEvents(2.0, TimeDuration::Seconds(1), TimeDuration::Seconds(60));
+	REQUIRE(events.numOperations > 0);
+	REQUIRE(events.numFailures == 0);
+}
+
+TEST_CASE(SUITE("SameSeedProducesTheSameTraffic"))
+{
+	auto run = [](uint32_t seed) -> std::vector<uint64_t>
+	{
+		SimulationConfig config;
+		config.numPairs = 20;
+		config.seed = seed;
+		config.link.bitsPerSecond = 9600;
+		config.link.lossProbability = 0.05;
+
+		Simulation sim(config);
+		sim.Start();
+
+		auto polls = sim.RunPolls(TimeDuration::Seconds(5), TimeDuration::Seconds(60));
+		auto events = sim.RunEvents(1.0, TimeDuration::Seconds(2), TimeDuration::Seconds(60));
+
+		return { polls.numOperations, polls.numFailures, polls.numHandlers, polls.numWireBytes, events.numOperations, events.numFailures, events.numHandlers, events.numWireBytes };
+	};
+
+	const auto first = run(3);
+	REQUIRE(first == run(3));
+	REQUIRE(first[1] > 0); // some polls were lost
+	REQUIRE_FALSE(first == run(4));
+}
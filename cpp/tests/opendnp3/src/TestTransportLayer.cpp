@@ -80,6 +80,27 @@ TEST_CASE(SUITE("StateReady"))
 	REQUIRE_FALSE(test.transport.OnSendResult(true));
 }
 
+TEST_CASE(SUITE("PooledRxBufferIsOnlyHeldWhileAssemblingAFragment"))
+{
+	auto pool = BufferPool::Create(DEFAULT_MAX_APDU_SIZE);
+	TransportTestObject test(true, DEFAULT_MAX_APDU_SIZE, pool);
+
+	test.link.SendUp("41 DE AD BE EF");
+	REQUIRE(pool->GetStatistics().bytesInUse == DEFAULT_MAX_APDU_SIZE);
+	REQUIRE(test.transport.AttachedBytes() == DEFAULT_MAX_APDU_SIZE);
+
+	test.link.SendUp("82");
+	REQUIRE(test.upper.GetBufferAsHexString() == "DE AD BE EF");
+	REQUIRE(pool->GetStatistics().bytesInUse == 0);
+	REQUIRE(pool->GetStatistics().bytesCached == DEFAULT_MAX_APDU_SIZE);
+	REQUIRE(test.transport.AttachedBytes() == 0);
+
+	// the next fragment reuses the cached buffer
+	test.link.SendUp("C3 01 02");
+	REQUIRE(pool->GetStatistics().numAllocations == 1);
+	REQUIRE(pool->GetStatistics().bytesInUse == 0);
+}
+
 TEST_CASE(SUITE("AllowsHeaderOnlyFinalFrame"))
 {
 	TransportTestObject test(true);
@@ -107,6 +128,34 @@ TEST_CASE(SUITE("ReceiveWrongSequence"))
 	REQUIRE(test.transport.GetStatistics().rx.numTransportIgnore == 1);
 }
 
+TEST_CASE(SUITE("AddressingChangeDiscardsPartialFragment"))
+{
+	TransportTestObject test(true);
+
+	test.link.SendUp("40 0A 0B");          // FIR/_/0 unicast
+	test.link.SendUpBroadcast("81 0C 0D"); // _/FIN/1 broadcast, must not complete the unicast fragment
+	REQUIRE(test.upper.IsBufferEmpty());
+	REQUIRE(test.transport.GetStatistics().rx.numTransportDiscard == 1);
+	REQUIRE(test.transport.GetStatistics().rx.numTransportIgnore == 1);
+
+	test.link.SendUpBroadcast("42 01 02"); // FIR/_/2 broadcast
+	test.link.SendUp("83 03 04");          // _/FIN/3 unicast, discards the broadcast fragment
+	REQUIRE(test.upper.IsBufferEmpty());
+	REQUIRE(test.transport.GetStatistics().rx.numTransportDiscard == 2);
+	REQUIRE(test.transport.GetStatistics().rx.numTransportIgnore == 2);
+
+	// complete fragments of either kind are still delivered the way they were addressed
+	test.link.SendUpBroadcast("44 05");
+	test.link.SendUpBroadcast("85 06");
+	REQUIRE(test.upper.GetBufferAsHexString() == "05 06");
+	REQUIRE(test.upper.numBroadcastRx == 1);
+	test.upper.ClearBuffer();
+
+	test.link.SendUp("C6 07");
+	REQUIRE(test.upper.GetBufferAsHexString() == "07");
+	REQUIRE(test.upper.numBroadcastRx == 1);
+}
+
 TEST_CASE(SUITE("PacketsCanBeOfVaryingSize"))
 {
 	TransportTestObject test(true);
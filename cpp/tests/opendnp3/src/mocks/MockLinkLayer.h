@@ -67,6 +67,17 @@ public:
 		return false;
 	}
 
+	bool SendUpBroadcast(const std::string& hex)
+	{
+		testlib::HexSequence hs(hex);
+		if (pUpperLayer)
+		{
+			auto buffer = hs.ToRSlice();
+			return pUpperLayer->OnReceiveBroadcast(buffer);
+		}
+		return false;
+	}
+
 	std::vector<std::string> sends;
 };
 
@@ -50,6 +50,12 @@ bool MockTransportLayer::OnReceive(const openpal::RSlice& buffer)
 	return true;
 }
 
+bool MockTransportLayer::OnReceiveBroadcast(const openpal::RSlice& buffer)
+{
+	broadcastQueue.push_back(ToHex(buffer));
+	return true;
+}
+
 bool MockTransportLayer::OnSendResult(bool isSuccess)
 {
 	if (isSuccess)
@@ -90,11 +90,13 @@ public:
 
 	// these are the NVII delegates
 	virtual bool OnReceive(const openpal::RSlice& buffer) override final;
+	virtual bool OnReceiveBroadcast(const openpal::RSlice& buffer) override final;
 	virtual bool OnSendResult(bool isSuccess) override final;
 	virtual bool OnLowerLayerUp() override final;
 	virtual bool OnLowerLayerDown() override final;
 
 	std::deque<std::string> receivedQueue;
+	std::deque<std::string> broadcastQueue;
 
 private:
 	ILinkLayer* pLinkLayer;
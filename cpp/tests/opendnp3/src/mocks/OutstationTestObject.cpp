@@ -35,12 +35,29 @@ OutstationTestObject::OutstationTestObject(
 	exe(std::make_shared<MockExecutor>()),
 	lower(std::make_shared<MockLowerLayer>()),
 	cmdHandler(std::make_shared<MockCommandHandler>(CommandStatus::SUCCESS)),
+	asyncCmdHandler(nullptr),
 	application(std::make_shared<MockOutstationApplication>()),
 	context(config, dbSizes, log.logger, exe, lower, cmdHandler, application)
 {
 	lower->SetUpperLayer(context);
 }
 
+OutstationTestObject::OutstationTestObject(
+    const OutstationConfig& config,
+    const DatabaseSizes& dbSizes,
+    const std::shared_ptr<MockAsyncCommandHandler>& asyncCmdHandler
+) :
+	log(),
+	exe(std::make_shared<MockExecutor>()),
+	lower(std::make_shared<MockLowerLayer>()),
+	cmdHandler(std::make_shared<MockCommandHandler>(CommandStatus::SUCCESS)),
+	asyncCmdHandler(asyncCmdHandler),
+	application(std::make_shared<MockOutstationApplication>()),
+	context(config, dbSizes, log.logger, exe, lower, asyncCmdHandler, application)
+{
+	lower->SetUpperLayer(context);
+}
+
 size_t OutstationTestObject::LowerLayerUp()
 {
 	context.OnLowerLayerUp();
@@ -66,6 +83,13 @@ size_t OutstationTestObject::SendToOutstation(const std::string& hex)
 	return exe->RunMany();
 }
 
+size_t OutstationTestObject::BroadcastToOutstation(const std::string& hex)
+{
+	HexSequence hs(hex);
+	context.OnReceiveBroadcast(hs.ToRSlice());
+	return exe->RunMany();
+}
+
 size_t OutstationTestObject::NumPendingTimers() const
 {
 	return exe->NumPendingTimers();
@@ -89,5 +113,10 @@ size_t OutstationTestObject::AdvanceTime(const openpal::TimeDuration& td)
 	return exe->RunMany();
 }
 
+size_t OutstationTestObject::RunExecutor()
+{
+	return exe->RunMany();
+}
+
 }
 
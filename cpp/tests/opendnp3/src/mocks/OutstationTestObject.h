@@ -32,6 +32,7 @@
 #include <testlib/MockLogHandler.h>
 
 #include <dnp3mocks/MockCommandHandler.h>
+#include <dnp3mocks/MockAsyncCommandHandler.h>
 #include <dnp3mocks/MockLowerLayer.h>
 #include <dnp3mocks/MockOutstationApplication.h>
 
@@ -46,9 +47,14 @@ class OutstationTestObject
 public:
 	OutstationTestObject(const OutstationConfig& config, const DatabaseSizes& dbSizes = DatabaseSizes::Empty());
 
+	/// dispatches commands to an asynchronous command handler instead of cmdHandler
+	OutstationTestObject(const OutstationConfig& config, const DatabaseSizes& dbSizes, const std::shared_ptr<MockAsyncCommandHandler>& asyncCmdHandler);
+
 
 	size_t SendToOutstation(const std::string& hex);
 
+	size_t BroadcastToOutstation(const std::string& hex);
+
 	size_t LowerLayerUp();
 
 	size_t LowerLayerDown();
@@ -61,6 +67,8 @@ public:
 
 	size_t AdvanceTime(const openpal::TimeDuration& td);
 
+	size_t RunExecutor();
+
 	testlib::MockLogHandler log;
 
 	void Transaction(const std::function<void (IUpdateHandler&)>& apply)
@@ -78,6 +86,7 @@ public:
 
 	const std::shared_ptr<MockLowerLayer> lower;
 	const std::shared_ptr<MockCommandHandler> cmdHandler;
+	const std::shared_ptr<MockAsyncCommandHandler> asyncCmdHandler;
 	const std::shared_ptr<MockOutstationApplication> application;
 	OContext context;
 };
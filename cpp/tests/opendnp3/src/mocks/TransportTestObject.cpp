@@ -35,10 +35,10 @@ using namespace testlib;
 namespace opendnp3
 {
 
-TransportTestObject::TransportTestObject(bool openOnStart, uint32_t maxRxFragmentSize) :
+TransportTestObject::TransportTestObject(bool openOnStart, uint32_t maxRxFragmentSize, const std::shared_ptr<BufferPool>& pool) :
 	log(),
 	exe(),
-	transport(log.logger, maxRxFragmentSize)
+	transport(log.logger, maxRxFragmentSize, pool)
 {
 	link.SetUpperLayer(transport);
 	transport.SetLinkLayer(link);
@@ -40,7 +40,7 @@ namespace opendnp3
 class TransportTestObject
 {
 public:
-	TransportTestObject(bool openOnStart = false, uint32_t maxRxFragmentSize = DEFAULT_MAX_APDU_SIZE);
+	TransportTestObject(bool openOnStart = false, uint32_t maxRxFragmentSize = DEFAULT_MAX_APDU_SIZE, const std::shared_ptr<BufferPool>& pool = nullptr);
 
 	// Generate a complete packet sequence inside the vector and
 	// return the corresponding reassembled APDU
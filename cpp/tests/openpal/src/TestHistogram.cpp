@@ -0,0 +1,114 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <openpal/util/Histogram.h>
+
+using namespace openpal;
+
+#define SUITE(name) "HistogramTestSuite - " name
+
+TEST_CASE(SUITE("EmptyHistogramSummarizesToZero"))
+{
+	Histogram histogram;
+	auto summary = histogram.Summarize();
+
+	REQUIRE(summary.count == 0);
+	REQUIRE(summary.min == 0);
+	REQUIRE(summary.max == 0);
+	REQUIRE(summary.p50 == 0);
+	REQUIRE(summary.p999 == 0);
+}
+
+TEST_CASE(SUITE("SmallValuesAreExact"))
+{
+	Histogram histogram;
+	for (uint64_t i = 1; i <= 20; ++i)
+	{
+		histogram.Record(i);
+	}
+
+	REQUIRE(histogram.Count() == 20);
+	REQUIRE(histogram.Min() == 1);
+	REQUIRE(histogram.Max() == 20);
+	REQUIRE(histogram.Mean() == 10);
+	REQUIRE(histogram.ValueAtPercentile(50) == 10);
+	REQUIRE(histogram.ValueAtPercentile(90) == 18);
+	REQUIRE(histogram.ValueAtPercentile(100) == 20);
+}
+
+TEST_CASE(SUITE("BucketsAreContiguousAndBounded"))
+{
+	for (uint32_t i = 0; i + 1 < Histogram::NUM_BUCKETS; ++i)
+	{
+		const auto upper = Histogram::BucketUpperBound(i);
+		REQUIRE(Histogram::BucketIndex(upper) == i);
+		REQUIRE(Histogram::BucketIndex(upper + 1) == i + 1);
+	}
+}
+
+TEST_CASE(SUITE("LargeValuesAreWithinRelativeError"))
+{
+	for (uint64_t value : { 1000ull, 12345ull, 999999ull, 60000000ull })
+	{
+		Histogram histogram;
+		histogram.Record(value);
+		const auto reported = histogram.ValueAtPercentile(50);
+
+		// the reported value is the highest value of the bucket, clamped to the maximum recorded
+		REQUIRE(reported == value);
+
+		const auto upper = Histogram::BucketUpperBound(Histogram::BucketIndex(value));
+		REQUIRE(upper >= value);
+		REQUIRE((upper - value) <= value / Histogram::SUB_BUCKETS);
+	}
+}
+
+TEST_CASE(SUITE("OutOfRangeValuesSaturateInLastBucket"))
+{
+	Histogram histogram;
+	histogram.Record(~0ull);
+
+	REQUIRE(Histogram::BucketIndex(~0ull) == Histogram::NUM_BUCKETS - 1);
+	REQUIRE(histogram.Count() == 1);
+	REQUIRE(histogram.Max() == ~0ull);
+}
+
+TEST_CASE(SUITE("MergeCombinesSamples"))
+{
+	Histogram a;
+	Histogram b;
+
+	a.Record(5);
+	a.Record(7);
+	b.Record(1);
+	b.Record(100);
+
+	a.Merge(b);
+
+	REQUIRE(a.Count() == 4);
+	REQUIRE(a.Min() == 1);
+	REQUIRE(a.Max() == 100);
+
+	a.Reset();
+	REQUIRE(a.Count() == 0);
+	REQUIRE(a.Max() == 0);
+}
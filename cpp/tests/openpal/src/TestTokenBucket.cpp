@@ -0,0 +1,61 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <openpal/executor/TokenBucket.h>
+
+using namespace openpal;
+
+#define SUITE(name) "TokenBucketTestSuite - " name
+
+TEST_CASE(SUITE("ZeroRateIsUnlimited"))
+{
+	TokenBucket bucket(0, 0);
+	REQUIRE_FALSE(bucket.IsLimited());
+
+	for (int i = 0; i < 100; ++i)
+	{
+		REQUIRE(bucket.TryConsume(MonotonicTimestamp(0)));
+	}
+}
+
+TEST_CASE(SUITE("StartsFullAndEmptiesAtBurst"))
+{
+	TokenBucket bucket(10, 3);
+
+	REQUIRE(bucket.TryConsume(MonotonicTimestamp(0)));
+	REQUIRE(bucket.TryConsume(MonotonicTimestamp(0)));
+	REQUIRE(bucket.TryConsume(MonotonicTimestamp(0)));
+	REQUIRE_FALSE(bucket.TryConsume(MonotonicTimestamp(0)));
+}
+
+TEST_CASE(SUITE("RefillsAtRate"))
+{
+	TokenBucket bucket(10, 1);
+
+	REQUIRE(bucket.TryConsume(MonotonicTimestamp(0)));
+	REQUIRE_FALSE(bucket.TryConsume(MonotonicTimestamp(99)));
+	REQUIRE(bucket.TryConsume(MonotonicTimestamp(100)));
+
+	// refill is capped by the burst size
+	REQUIRE(bucket.TryConsume(MonotonicTimestamp(10000)));
+	REQUIRE_FALSE(bucket.TryConsume(MonotonicTimestamp(10000)));
+}